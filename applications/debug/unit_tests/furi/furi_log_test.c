@@ -0,0 +1,132 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+#include "../minunit_bench.h"
+
+#define TAG "LogTest"
+
+#define FURI_LOG_TEST_CAPTURE_SIZE (2048U)
+#define FURI_LOG_TEST_FILL_COUNT (1000U)
+#define FURI_LOG_TEST_BENCH_COUNT (64U)
+
+typedef struct {
+    char data[FURI_LOG_TEST_CAPTURE_SIZE];
+    size_t size;
+    uint32_t fill_count;
+} FuriLogTestCapture;
+
+static void furi_log_test_callback(const uint8_t* data, size_t size, void* context) {
+    FuriLogTestCapture* capture = context;
+
+    if(size > 5 && memcmp(data, "fill ", 5) == 0) {
+        capture->fill_count++;
+    } else if(capture->size + size < FURI_LOG_TEST_CAPTURE_SIZE) {
+        memcpy(&capture->data[capture->size], data, size);
+        capture->size += size;
+        capture->data[capture->size] = '\0';
+    }
+}
+
+// Expected line is formatted directly, the same way as the synchronous log does
+static void furi_log_test_expect(
+    FuriLogTestCapture* capture,
+    const char* tag,
+    const char* format,
+    ...) {
+    char expected[128];
+    size_t size = snprintf(expected, sizeof(expected), "[%s] " _FURI_LOG_CLR_RESET, tag);
+    va_list args;
+    va_start(args, format);
+    size += vsnprintf(expected + size, sizeof(expected) - size, format, args);
+    va_end(args);
+    snprintf(expected + size, sizeof(expected) - size, "\r\n");
+    mu_assert(strstr(capture->data, expected) != NULL, expected);
+}
+
+static void furi_log_test_records(FuriLogTestCapture* capture) {
+    char buffer[16] = "stack string";
+    const char not_terminated[4] = {'a', 'b', 'c', 'd'};
+    char tag[16] = TAG "Ram";
+    char format[16] = "ram %d";
+    const char* long_string =
+        "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef0123456789";
+
+    capture->size = 0;
+    capture->data[0] = '\0';
+
+    FURI_LOG_I(TAG, "int %d %u %05x %-4d|", -1, 2U, 0xab, 3);
+    FURI_LOG_I(TAG, "long %lu %ld %lld", 4000000000UL, -5L, -6LL);
+    FURI_LOG_I(TAG, "size %zu %p", (size_t)7, (void*)0x20000000);
+    FURI_LOG_I(TAG, "string %s|%8s|%.3s|%.*s", buffer, "right", "cut here", 4, not_terminated);
+    FURI_LOG_I(TAG, "star %*d|%-*d|%%", 4, 1, 3, 2);
+    FURI_LOG_I(tag, format, 8);
+    FURI_LOG_I(TAG, "long string %s|", long_string);
+    // Arguments are copied, later changes must not affect the output
+    strcpy(buffer, "changed");
+
+    // Disabling deferred mode waits for the pending records
+    furi_log_set_deferred(false);
+
+    furi_log_test_expect(capture, TAG, "int %d %u %05x %-4d|", -1, 2U, 0xab, 3);
+    furi_log_test_expect(capture, TAG, "long %lu %ld %lld", 4000000000UL, -5L, -6LL);
+    furi_log_test_expect(capture, TAG, "size %zu %p", (size_t)7, (void*)0x20000000);
+    furi_log_test_expect(
+        capture, TAG, "string %s|%8s|%.3s|%.*s", "stack string", "right", "cut here", 4, "abcd");
+    furi_log_test_expect(capture, TAG, "star %*d|%-*d|%%", 4, 1, 3, 2);
+    furi_log_test_expect(capture, TAG "Ram", "ram %d", 8);
+    // Strings that don't fit into the record are not cut
+    furi_log_test_expect(capture, TAG, "long string %s|", long_string);
+}
+
+static void furi_log_test_run(void) {
+    FuriLogTestCapture* capture = malloc(sizeof(FuriLogTestCapture));
+    FuriLogHandler handler = {
+        .callback = furi_log_test_callback,
+        .context = capture,
+    };
+    FuriLogLevel level = furi_log_get_level();
+    furi_log_set_level(FuriLogLevelTrace);
+    mu_check(furi_log_add_handler(handler));
+
+    furi_log_set_deferred(true);
+    mu_check(furi_log_is_deferred());
+    furi_log_test_records(capture);
+    mu_check(!furi_log_is_deferred());
+
+    // Records are either delivered or counted as dropped
+    uint32_t dropped = furi_log_get_dropped_count();
+    furi_log_set_deferred(true);
+    for(size_t i = 0; i < FURI_LOG_TEST_FILL_COUNT; i++) {
+        FURI_LOG_T(TAG, "fill %zu", i);
+    }
+    furi_log_set_deferred(false);
+    dropped = furi_log_get_dropped_count() - dropped;
+    mu_assert_int_eq(FURI_LOG_TEST_FILL_COUNT, capture->fill_count + dropped);
+
+    // Cost of the log call itself, formatting is deferred to the drain thread
+    uint64_t sync_cycles = 0;
+    uint64_t deferred_cycles = 0;
+    for(size_t i = 0; i < FURI_LOG_TEST_BENCH_COUNT; i++) {
+        uint32_t start = DWT->CYCCNT;
+        FURI_LOG_T(TAG, "bench %zu %s %lu", i, "sync", furi_get_tick());
+        sync_cycles += DWT->CYCCNT - start;
+    }
+    furi_log_set_deferred(true);
+    for(size_t i = 0; i < FURI_LOG_TEST_BENCH_COUNT; i++) {
+        uint32_t start = DWT->CYCCNT;
+        FURI_LOG_T(TAG, "bench %zu %s %lu", i, "deferred", furi_get_tick());
+        deferred_cycles += DWT->CYCCNT - start;
+    }
+    furi_log_set_deferred(false);
+    minunit_bench_report("furi_log/sync", sync_cycles, FURI_LOG_TEST_BENCH_COUNT, "records");
+    minunit_bench_report(
+        "furi_log/deferred", deferred_cycles, FURI_LOG_TEST_BENCH_COUNT, "records");
+
+    mu_check(furi_log_remove_handler(handler));
+    furi_log_set_level(level);
+    free(capture);
+}
+
+void test_furi_log() {
+    furi_log_test_run();
+}
@@ -1,4 +1,7 @@
+#include <furi.h>
+#include <furi_hal.h>
 #include "../minunit.h"
+#include "../minunit_bench.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
@@ -36,3 +39,132 @@ void test_furi_memmgr() {
     }
     free(ptr);
 }
+
+#define FURI_MEMMGR_TEST_SLAB_OBJECTS (96U)
+#define FURI_MEMMGR_TEST_SLAB_ROUNDS (16U)
+
+static uint64_t test_furi_memmgr_slab_churn(void** objects) {
+    uint64_t cycles = 0;
+
+    for(size_t round = 0; round < FURI_MEMMGR_TEST_SLAB_ROUNDS; round++) {
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < FURI_MEMMGR_TEST_SLAB_OBJECTS; i++) {
+            // Typical small object sizes: strings, list nodes, decoder contexts
+            objects[i] = malloc(8 + (i * 37 + round * 11) % 200);
+        }
+        for(size_t i = 0; i < FURI_MEMMGR_TEST_SLAB_OBJECTS; i += 2) {
+            free(objects[i]);
+        }
+        for(size_t i = 1; i < FURI_MEMMGR_TEST_SLAB_OBJECTS; i += 2) {
+            free(objects[i]);
+        }
+        cycles += DWT->CYCCNT - start;
+    }
+
+    return cycles;
+}
+
+void test_furi_memmgr_slab() {
+    MemmgrHeapSlabStats stats;
+    const bool slab_enabled = memmgr_heap_is_slab_enabled();
+    memmgr_heap_set_slab_enabled(true);
+    const size_t class_count = memmgr_heap_get_slab_class_count();
+    mu_check(class_count > 0);
+    mu_check(!memmgr_heap_get_slab_stats(class_count, &stats));
+
+    uint8_t** objects = malloc(sizeof(uint8_t*) * FURI_MEMMGR_TEST_SLAB_OBJECTS);
+
+    // Objects of every class are zeroed and do not overlap
+    for(size_t i = 0; i < class_count; i++) {
+        mu_check(memmgr_heap_get_slab_stats(i, &stats));
+        const size_t size = stats.object_size;
+        const uint32_t allocations = stats.allocations + stats.fallbacks;
+
+        for(size_t j = 0; j < FURI_MEMMGR_TEST_SLAB_OBJECTS; j++) {
+            objects[j] = malloc(size);
+            for(size_t k = 0; k < size; k++) {
+                mu_assert_int_eq(0, objects[j][k]);
+            }
+            memset(objects[j], j + 1, size);
+        }
+        for(size_t j = 0; j < FURI_MEMMGR_TEST_SLAB_OBJECTS; j++) {
+            for(size_t k = 0; k < size; k++) {
+                mu_assert_int_eq(j + 1, objects[j][k]);
+            }
+            free(objects[j]);
+        }
+
+        mu_check(memmgr_heap_get_slab_stats(i, &stats));
+        mu_check(
+            stats.allocations + stats.fallbacks >= allocations + FURI_MEMMGR_TEST_SLAB_OBJECTS);
+    }
+
+    // Disabled slabs pass everything to the heap, live slab objects can still be freed
+    void* object = malloc(16);
+    memmgr_heap_set_slab_enabled(false);
+    mu_check(memmgr_heap_get_slab_stats(0, &stats));
+    const uint32_t allocations = stats.allocations;
+    uint64_t heap_cycles = test_furi_memmgr_slab_churn((void**)objects);
+    mu_check(memmgr_heap_get_slab_stats(0, &stats));
+    mu_assert_int_eq(allocations, stats.allocations);
+    free(object);
+    memmgr_heap_set_slab_enabled(true);
+
+    uint64_t slab_cycles = test_furi_memmgr_slab_churn((void**)objects);
+
+    const size_t items = FURI_MEMMGR_TEST_SLAB_OBJECTS * FURI_MEMMGR_TEST_SLAB_ROUNDS;
+    minunit_bench_report("memmgr/heap", heap_cycles, items, "objects");
+    minunit_bench_report("memmgr/slab", slab_cycles, items, "objects");
+
+    free(objects);
+    memmgr_heap_set_slab_enabled(slab_enabled);
+
+    // Give kept empty pages back to the heap, so they are not reported as leaked
+    memmgr_heap_slab_trim();
+    for(size_t i = 0; i < class_count; i++) {
+        mu_check(memmgr_heap_get_slab_stats(i, &stats));
+        if(stats.objects_used == 0) {
+            mu_assert_int_eq(0, stats.page_count);
+        }
+    }
+}
+
+void test_furi_memmgr_trace() {
+    MemmgrHeapTraceEvent events[4];
+
+    mu_check(memmgr_heap_trace_start(64));
+    mu_check(memmgr_heap_trace_is_running());
+    mu_check(!memmgr_heap_trace_start(64));
+
+    // Drop events of other threads recorded so far
+    while(memmgr_heap_trace_read(events, COUNT_OF(events)) > 0) {
+    }
+
+    void* ptr = malloc(100);
+    free(ptr);
+
+    // Other threads may allocate meanwhile, look for own events
+    const uint32_t thread = (uint32_t)furi_thread_get_current_id();
+    bool allocated = false;
+    bool freed = false;
+    size_t count;
+    while((count = memmgr_heap_trace_read(events, COUNT_OF(events))) > 0) {
+        for(size_t i = 0; i < count; i++) {
+            if(events[i].thread != thread || events[i].pointer != (uint32_t)ptr) continue;
+            if(events[i].type == MemmgrHeapTraceEventAlloc) {
+                mu_assert_int_eq(100, events[i].size);
+                mu_check(events[i].caller != 0);
+                allocated = true;
+            } else {
+                mu_check(allocated);
+                freed = true;
+            }
+        }
+    }
+    mu_check(allocated);
+    mu_check(freed);
+
+    memmgr_heap_trace_stop();
+    mu_check(!memmgr_heap_trace_is_running());
+    mu_assert_int_eq(0, memmgr_heap_trace_read(events, COUNT_OF(events)));
+}
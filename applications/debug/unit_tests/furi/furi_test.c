@@ -9,6 +9,10 @@ void test_furi_concurrent_access();
 void test_furi_pubsub();
 
 void test_furi_memmgr();
+void test_furi_memmgr_slab();
+void test_furi_memmgr_trace();
+
+void test_furi_log();
 
 static int foo = 0;
 
@@ -39,6 +43,18 @@ MU_TEST(mu_test_furi_memmgr) {
     test_furi_memmgr();
 }
 
+MU_TEST(mu_test_furi_memmgr_slab) {
+    test_furi_memmgr_slab();
+}
+
+MU_TEST(mu_test_furi_memmgr_trace) {
+    test_furi_memmgr_trace();
+}
+
+MU_TEST(mu_test_furi_log) {
+    test_furi_log();
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
 
@@ -48,6 +64,9 @@ MU_TEST_SUITE(test_suite) {
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_memmgr_slab);
+    MU_RUN_TEST(mu_test_furi_memmgr_trace);
+    MU_RUN_TEST(mu_test_furi_log);
 }
 
 int run_minunit_test_furi() {
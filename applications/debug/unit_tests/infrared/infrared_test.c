@@ -2,7 +2,9 @@
 #include <flipper_format.h>
 #include <infrared.h>
 #include <common/infrared_common_i.h>
+#include <furi_hal.h>
 #include "../minunit.h"
+#include "../minunit_bench.h"
 
 #define IR_TEST_FILES_DIR EXT_PATH("unit_tests/infrared/")
 #define IR_TEST_FILE_PREFIX "test_"
@@ -522,6 +524,74 @@ MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolRCA, 1);
 }
 
+static void infrared_test_bench_signal(
+    const uint32_t* timings,
+    uint32_t timings_count,
+    uint64_t* cycles,
+    size_t* frames) {
+    bool level = 0;
+
+    infrared_reset_decoder(test->decoder_handler);
+
+    uint32_t start = DWT->CYCCNT;
+    for(uint32_t i = 0; i < timings_count; ++i) {
+        if(timings[i] > INFRARED_RAW_RX_TIMING_DELAY_US) {
+            if(infrared_check_decoder_ready(test->decoder_handler)) ++*frames;
+        }
+        if(infrared_decode(test->decoder_handler, level, timings[i])) ++*frames;
+        level = !level;
+    }
+    if(infrared_check_decoder_ready(test->decoder_handler)) ++*frames;
+    *cycles += DWT->CYCCNT - start;
+}
+
+static void infrared_test_run_decoder_bench(void) {
+    FuriString* buf = furi_string_alloc();
+    uint64_t total_cycles = 0;
+    size_t total_frames = 0;
+    size_t total_timings = 0;
+
+    for(InfraredProtocol protocol = 0; protocol < InfraredProtocolMAX; ++protocol) {
+        const char* protocol_name = infrared_get_protocol_name(protocol);
+        if(!infrared_test_prepare_file(protocol_name)) continue;
+
+        uint64_t cycles = 0;
+        size_t frames = 0;
+        uint32_t* timings;
+        uint32_t timings_count;
+
+        // Inputs go in order, so every lookup continues from the previous one
+        for(uint32_t index = 1;; ++index) {
+            furi_string_printf(buf, "decoder_input%ld", index);
+            if(!infrared_test_load_raw_signal(
+                   test->ff, furi_string_get_cstr(buf), &timings, &timings_count)) {
+                break;
+            }
+            infrared_test_bench_signal(timings, timings_count, &cycles, &frames);
+            total_timings += timings_count;
+            free(timings);
+        }
+        flipper_format_buffered_file_close(test->ff);
+
+        if(frames) {
+            furi_string_printf(buf, "infrared_decode/%s", protocol_name);
+            minunit_bench_report(furi_string_get_cstr(buf), cycles, frames, "frames");
+        }
+        total_cycles += cycles;
+        total_frames += frames;
+    }
+
+    furi_string_free(buf);
+
+    mu_assert(total_frames > 0, "no frames decoded");
+    minunit_bench_report("infrared_decode", total_cycles, total_frames, "frames");
+    minunit_bench_report("infrared_decode/timings", total_cycles, total_timings, "timings");
+}
+
+MU_TEST(infrared_test_decoder_bench) {
+    infrared_test_run_decoder_bench();
+}
+
 MU_TEST_SUITE(infrared_test) {
     MU_SUITE_CONFIGURE(&infrared_test_alloc, &infrared_test_free);
 
@@ -541,6 +611,7 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_rca);
     MU_RUN_TEST(infrared_test_decoder_mixed);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
+    MU_RUN_TEST(infrared_test_decoder_bench);
 }
 
 int run_minunit_test_infrared() {
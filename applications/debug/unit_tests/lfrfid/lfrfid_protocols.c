@@ -3,9 +3,19 @@
 #include <toolbox/protocols/protocol_dict.h>
 #include <lfrfid/protocols/lfrfid_protocols.h>
 #include <toolbox/pulse_protocols/pulse_glue.h>
+#include <lfrfid/lfrfid_raw_file.h>
+#include <furi_hal.h>
+#include "../minunit_bench.h"
 
 #define LF_RFID_READ_TIMING_MULTIPLIER 8
 
+#define LFRFID_BENCH_DIR_NAME EXT_PATH("unit_tests/lfrfid")
+#define LFRFID_BENCH_FILE_SUFFIX ".raw"
+#define LFRFID_BENCH_PAIRS_MAX (4096)
+#define LFRFID_BENCH_SYNTH_PAIRS (160)
+#define LFRFID_BENCH_SYNTH_YIELDS (LFRFID_BENCH_SYNTH_PAIRS * 64)
+#define LFRFID_BENCH_PASSES (8)
+
 #define EM_TEST_DATA \
     { 0x58, 0x00, 0x85, 0x64, 0x02 }
 #define EM_TEST_DATA_SIZE 5
@@ -531,6 +541,214 @@ MU_TEST(test_lfrfid_protocol_fdxb_read_simple) {
     protocol_dict_free(dict);
 }
 
+typedef struct {
+    uint32_t pulse[LFRFID_BENCH_PAIRS_MAX];
+    uint32_t duration[LFRFID_BENCH_PAIRS_MAX];
+    size_t count;
+    size_t files;
+} LFRFIDBenchCapture;
+
+typedef struct {
+    uint64_t cycles;
+    uint32_t hits;
+    uint32_t hits_hash;
+} LFRFIDBenchResult;
+
+static void
+    lfrfid_bench_load_file(LFRFIDBenchCapture* capture, Storage* storage, const char* path) {
+    LFRFIDRawFile* file = lfrfid_raw_file_alloc(storage);
+    float frequency, duty_cycle;
+
+    if(lfrfid_raw_file_open_read(file, path) &&
+       lfrfid_raw_file_read_header(file, &frequency, &duty_cycle)) {
+        bool pass_end = false;
+        while(capture->count < LFRFID_BENCH_PAIRS_MAX) {
+            uint32_t duration, pulse;
+            if(!lfrfid_raw_file_read_pair(file, &duration, &pulse, &pass_end) || pass_end) break;
+
+            capture->pulse[capture->count] = pulse;
+            capture->duration[capture->count] = duration;
+            capture->count++;
+        }
+        capture->files++;
+    }
+
+    lfrfid_raw_file_free(file);
+}
+
+static void lfrfid_bench_load_dir(LFRFIDBenchCapture* capture, const char* dir_path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* dir = storage_file_alloc(storage);
+    FuriString* path = furi_string_alloc();
+    FileInfo fileinfo;
+    char name[128];
+
+    if(storage_dir_open(dir, dir_path)) {
+        while(storage_dir_read(dir, &fileinfo, name, sizeof(name))) {
+            furi_string_printf(path, "%s/%s", dir_path, name);
+            if(file_info_is_dir(&fileinfo) ||
+               !furi_string_end_with(path, LFRFID_BENCH_FILE_SUFFIX)) {
+                continue;
+            }
+            lfrfid_bench_load_file(capture, storage, furi_string_get_cstr(path));
+        }
+    }
+
+    storage_dir_close(dir);
+    furi_string_free(path);
+    storage_file_free(dir);
+    furi_record_close(RECORD_STORAGE);
+}
+
+// No recorded captures: emulate every protocol in turn, the way a reader sees random cards
+static void lfrfid_bench_synthesize(LFRFIDBenchCapture* capture) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    size_t data_size = protocol_dict_get_max_data_size(dict);
+    uint8_t* data = malloc(data_size);
+
+    for(size_t i = 0; i < LFRFIDProtocolMax; i++) {
+        for(size_t j = 0; j < data_size; j++) {
+            data[j] = (i << 4) + j;
+        }
+        protocol_dict_set_data(dict, i, data, data_size);
+        if(!protocol_dict_encoder_start(dict, i)) continue;
+
+        pulse_glue_reset(pulse_glue);
+        size_t pairs = 0;
+        for(size_t j = 0; j < LFRFID_BENCH_SYNTH_YIELDS && pairs < LFRFID_BENCH_SYNTH_PAIRS;
+            j++) {
+            if(capture->count >= LFRFID_BENCH_PAIRS_MAX) break;
+
+            LevelDuration level_duration = protocol_dict_encoder_yield(dict, i);
+            bool pulse_pop = pulse_glue_push(
+                pulse_glue,
+                level_duration_get_level(level_duration),
+                level_duration_get_duration(level_duration) * LF_RFID_READ_TIMING_MULTIPLIER);
+
+            if(pulse_pop) {
+                uint32_t length, period;
+                pulse_glue_pop(pulse_glue, &length, &period);
+                capture->pulse[capture->count] = period;
+                capture->duration[capture->count] = length;
+                capture->count++;
+                pairs++;
+            }
+        }
+    }
+
+    free(data);
+    pulse_glue_free(pulse_glue);
+    protocol_dict_free(dict);
+}
+
+static inline void lfrfid_bench_hit(LFRFIDBenchResult* result, size_t index, ProtocolId protocol) {
+    result->hits++;
+    result->hits_hash = result->hits_hash * 31 + index * LFRFIDProtocolMax + protocol;
+}
+
+static void lfrfid_bench_dict(const LFRFIDBenchCapture* capture, LFRFIDBenchResult* result) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+
+    for(size_t pass = 0; pass < LFRFID_BENCH_PASSES; pass++) {
+        protocol_dict_decoders_start(dict);
+
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < capture->count; i++) {
+            ProtocolId protocol = protocol_dict_decoders_feed(dict, true, capture->pulse[i]);
+            if(protocol == PROTOCOL_NO) {
+                protocol = protocol_dict_decoders_feed(
+                    dict, false, capture->duration[i] - capture->pulse[i]);
+            }
+            if(protocol != PROTOCOL_NO) {
+                lfrfid_bench_hit(result, i, protocol);
+                protocol_dict_decoders_start(dict);
+            }
+        }
+        result->cycles += DWT->CYCCNT - start;
+    }
+
+    protocol_dict_free(dict);
+}
+
+// Every decoder gets every pulse, as protocol_dict did before early rejection
+static ProtocolId lfrfid_bench_reference_feed(void** decoders, bool level, uint32_t duration) {
+    ProtocolId ready_protocol_id = PROTOCOL_NO;
+
+    for(size_t i = 0; i < LFRFIDProtocolMax; i++) {
+        if(lfrfid_protocols[i]->decoder.feed(decoders[i], level, duration)) {
+            if(ready_protocol_id == PROTOCOL_NO) ready_protocol_id = i;
+        }
+    }
+
+    return ready_protocol_id;
+}
+
+static void lfrfid_bench_reference_start(void** decoders) {
+    for(size_t i = 0; i < LFRFIDProtocolMax; i++) {
+        lfrfid_protocols[i]->decoder.start(decoders[i]);
+    }
+}
+
+static void lfrfid_bench_reference(const LFRFIDBenchCapture* capture, LFRFIDBenchResult* result) {
+    void** decoders = malloc(sizeof(void*) * LFRFIDProtocolMax);
+    for(size_t i = 0; i < LFRFIDProtocolMax; i++) {
+        decoders[i] = lfrfid_protocols[i]->alloc();
+    }
+
+    for(size_t pass = 0; pass < LFRFID_BENCH_PASSES; pass++) {
+        lfrfid_bench_reference_start(decoders);
+
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < capture->count; i++) {
+            ProtocolId protocol = lfrfid_bench_reference_feed(decoders, true, capture->pulse[i]);
+            if(protocol == PROTOCOL_NO) {
+                protocol = lfrfid_bench_reference_feed(
+                    decoders, false, capture->duration[i] - capture->pulse[i]);
+            }
+            if(protocol != PROTOCOL_NO) {
+                lfrfid_bench_hit(result, i, protocol);
+                lfrfid_bench_reference_start(decoders);
+            }
+        }
+        result->cycles += DWT->CYCCNT - start;
+    }
+
+    for(size_t i = 0; i < LFRFIDProtocolMax; i++) {
+        lfrfid_protocols[i]->free(decoders[i]);
+    }
+    free(decoders);
+}
+
+MU_TEST(test_lfrfid_protocol_dict_feed_bench) {
+    LFRFIDBenchCapture* capture = malloc(sizeof(LFRFIDBenchCapture));
+
+    lfrfid_bench_load_dir(capture, LFRFID_BENCH_DIR_NAME);
+    if(capture->count == 0) {
+        lfrfid_bench_synthesize(capture);
+        printf("No captures in %s, using emulated pulses\r\n", LFRFID_BENCH_DIR_NAME);
+    } else {
+        printf("Loaded %zu captures from %s\r\n", capture->files, LFRFID_BENCH_DIR_NAME);
+    }
+    mu_check(capture->count > 0);
+
+    LFRFIDBenchResult reference = {0};
+    LFRFIDBenchResult dict = {0};
+    lfrfid_bench_reference(capture, &reference);
+    lfrfid_bench_dict(capture, &dict);
+
+    // Early rejection must not change what gets decoded
+    mu_assert_int_eq(reference.hits, dict.hits);
+    mu_assert_int_eq(reference.hits_hash, dict.hits_hash);
+
+    size_t pulses = capture->count * 2 * LFRFID_BENCH_PASSES;
+    printf("%lu reads\r\n", dict.hits);
+    minunit_bench_report("lfrfid_feed/all_decoders", reference.cycles, pulses, "pulses");
+    minunit_bench_report("lfrfid_feed/protocol_dict", dict.cycles, pulses, "pulses");
+
+    free(capture);
+}
+
 MU_TEST_SUITE(test_lfrfid_protocols_suite) {
     MU_RUN_TEST(test_lfrfid_protocol_em_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_em_emulate_simple);
@@ -545,6 +763,8 @@ MU_TEST_SUITE(test_lfrfid_protocols_suite) {
 
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_emulate_simple);
+
+    MU_RUN_TEST(test_lfrfid_protocol_dict_feed_bench);
 }
 
 int run_minunit_test_lfrfid_protocols() {
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*  Throughput measurement for benchmark style tests
+ *
+ *  Results are printed in a fixed `[bench] <name>: ...` format, so CI logs
+ *  can be scraped and compared between builds. Measurement is based on the
+ *  core cycle counter, keep a single measured section under ~60 seconds.
+ */
+
+typedef struct {
+    const char* name;
+    uint32_t start;
+} MinunitBench;
+
+/*  Start measurement */
+void minunit_bench_start(MinunitBench* bench, const char* name);
+
+/*  Stop measurement, report elapsed time and items per second
+ *
+ *  Returns elapsed time in microseconds
+ */
+uint32_t minunit_bench_stop(MinunitBench* bench, size_t items, const char* unit);
+
+/*  Report cycles accumulated over several measured sections
+ *
+ *  Returns elapsed time in microseconds
+ */
+uint32_t minunit_bench_report(const char* name, uint64_t cycles, size_t items, const char* unit);
@@ -11,17 +11,23 @@
 #include <nfc/protocols/mf_ultralight/mf_ultralight.h>
 #include <nfc/protocols/mf_ultralight/mf_ultralight_poller_sync.h>
 #include <nfc/protocols/mf_classic/mf_classic_poller_sync.h>
+#include <nfc/protocols/mf_classic/crypto1.h>
 
 #include <toolbox/keys_dict.h>
 #include <nfc/nfc.h>
 
 #include "../minunit.h"
+#include "../minunit_bench.h"
 
 #define TAG "NfcTest"
 
 #define NFC_TEST_NFC_DEV_PATH EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
 
+#define NFC_TEST_CRYPTO1_ROUNDS (1000)
+#define NFC_TEST_CRYPTO1_BENCH_WORDS (20000)
+#define NFC_TEST_CRYPTO1_BENCH_BATCHES (2000)
+
 typedef struct {
     Storage* storage;
 } NfcTest;
@@ -479,6 +485,8 @@ MU_TEST(mf_classic_dict_test) {
         key_idx++;
     }
 
+    mu_assert(keys_dict_build_index(dict), "keys_dict_build_index() failed");
+
     uint32_t delete_keys_idx[] = {1, 3, 9, 11, 19, 27};
 
     for(size_t i = 0; i < COUNT_OF(delete_keys_idx); i++) {
@@ -496,12 +504,179 @@ MU_TEST(mf_classic_dict_test) {
         dict_keys_total == test_key_num - COUNT_OF(delete_keys_idx),
         "keys_dict_keys_total() failed");
 
+    for(size_t i = 0; i < COUNT_OF(delete_keys_idx); i++) {
+        MfClassicKey* key = &key_arr_ref[delete_keys_idx[i]];
+        mu_assert(
+            !keys_dict_is_key_present(dict, key->data, sizeof(MfClassicKey)),
+            "keys_dict_is_key_present() found deleted key");
+        mu_assert(
+            !keys_dict_delete_key(dict, key->data, sizeof(MfClassicKey)),
+            "keys_dict_delete_key() deleted missing key");
+    }
+
+    // Lookups above scanned the list, deletes dropped the index
+    mu_assert(keys_dict_build_index(dict), "keys_dict_build_index() failed");
+
+    uint64_t keys_bulk[4] = {};
+    size_t keys_bulk_read = 0;
+    key_idx = 0;
+    keys_dict_rewind(dict);
+    while((keys_bulk_read = keys_dict_get_next_keys(dict, keys_bulk, COUNT_OF(keys_bulk)))) {
+        for(size_t i = 0; i < keys_bulk_read; i++) {
+            for(size_t j = 0; j < sizeof(MfClassicKey); j++) {
+                key_dut.data[j] = keys_bulk[i] >> (8 * (sizeof(MfClassicKey) - 1 - j));
+            }
+            mu_assert(
+                keys_dict_is_key_present(dict, key_dut.data, sizeof(MfClassicKey)),
+                "Bulk loaded key data mismatch");
+        }
+        key_idx += keys_bulk_read;
+    }
+    mu_assert(key_idx == dict_keys_total, "keys_dict_get_next_keys() count mismatch");
+
     keys_dict_free(dict);
     free(key_arr_ref);
 
     mu_assert(
         storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
         "Remove test dict failed");
+    mu_assert(
+        storage_simply_remove(
+            storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH KEYS_DICT_INDEX_EXTENSION),
+        "Remove test dict index failed");
+}
+
+static uint64_t nfc_test_crypto1_random_key() {
+    uint64_t key = 0;
+    furi_hal_random_fill_buf((uint8_t*)&key, sizeof(MfClassicKey));
+    return key;
+}
+
+// Bit at a time reference, the way crypto1_byte() and crypto1_word() used to work
+static uint8_t nfc_test_crypto1_byte_ref(Crypto1* crypto, uint8_t in, int is_encrypted) {
+    uint8_t out = 0;
+    for(uint8_t i = 0; i < 8; i++) {
+        out |= crypto1_bit(crypto, FURI_BIT(in, i), is_encrypted) << i;
+    }
+    return out;
+}
+
+static uint32_t nfc_test_crypto1_word_ref(Crypto1* crypto, uint32_t in, int is_encrypted) {
+    uint32_t out = 0;
+    for(uint8_t i = 0; i < 32; i++) {
+        out |= (uint32_t)crypto1_bit(crypto, FURI_BIT(in, i ^ 24), is_encrypted) << (i ^ 24);
+    }
+    return out;
+}
+
+MU_TEST(mf_classic_crypto1_test) {
+    Crypto1 crypto = {};
+    Crypto1 crypto_ref = {};
+
+    for(size_t i = 0; i < NFC_TEST_CRYPTO1_ROUNDS; i++) {
+        uint64_t key = nfc_test_crypto1_random_key();
+        uint32_t in = furi_hal_random_get();
+        int is_encrypted = in & 0x01;
+
+        crypto1_init(&crypto, key);
+        crypto1_init(&crypto_ref, key);
+
+        mu_assert(
+            crypto1_word(&crypto, in, is_encrypted) ==
+                nfc_test_crypto1_word_ref(&crypto_ref, in, is_encrypted),
+            "crypto1_word() output mismatch");
+        mu_assert(
+            crypto1_byte(&crypto, in, !is_encrypted) ==
+                nfc_test_crypto1_byte_ref(&crypto_ref, in, !is_encrypted),
+            "crypto1_byte() output mismatch");
+        mu_assert(
+            (crypto.odd == crypto_ref.odd) && (crypto.even == crypto_ref.even),
+            "Crypto1 state mismatch");
+    }
+}
+
+MU_TEST(mf_classic_crypto1_batch_test) {
+    Crypto1Batch* batch = crypto1_batch_alloc();
+    uint64_t keys[CRYPTO1_BATCH_SIZE];
+    Crypto1 crypto[CRYPTO1_BATCH_SIZE];
+    uint32_t out[32];
+
+    for(size_t i = 0; i < CRYPTO1_BATCH_SIZE; i++) {
+        keys[i] = nfc_test_crypto1_random_key();
+        crypto1_init(&crypto[i], keys[i]);
+    }
+    crypto1_batch_init(batch, keys, CRYPTO1_BATCH_SIZE);
+
+    // Long enough to wrap around the batch history
+    for(size_t round = 0; round < 8; round++) {
+        uint32_t in = furi_hal_random_get();
+        int is_encrypted = round & 0x01;
+        crypto1_batch_word(batch, in, is_encrypted, out);
+
+        for(size_t i = 0; i < CRYPTO1_BATCH_SIZE; i++) {
+            uint32_t word = 0;
+            for(size_t bit = 0; bit < 32; bit++) {
+                word |= FURI_BIT(out[bit], i) << bit;
+            }
+            mu_assert(
+                word == crypto1_word(&crypto[i], in, is_encrypted),
+                "crypto1_batch_word() output mismatch");
+        }
+    }
+
+    // Reader side of authentication with one of the keys
+    size_t key_idx = furi_hal_random_get() % CRYPTO1_BATCH_SIZE;
+    uint32_t cuid = furi_hal_random_get();
+    uint32_t nt = furi_hal_random_get();
+    uint32_t nr = furi_hal_random_get();
+    Crypto1 reader = {};
+    crypto1_init(&reader, keys[key_idx]);
+    crypto1_word(&reader, nt ^ cuid, 0);
+    uint32_t nr_enc = crypto1_word(&reader, nr, 0) ^ nr;
+    uint32_t ar_enc = crypto1_word(&reader, 0, 0) ^ prng_successor(nt, 64);
+
+    uint32_t found = crypto1_batch_check_reader_auth(
+        batch, keys, CRYPTO1_BATCH_SIZE, cuid, nt, nr_enc, ar_enc);
+    mu_assert(found == (1UL << key_idx), "crypto1_batch_check_reader_auth() failed");
+
+    found = crypto1_batch_check_reader_auth(batch, keys, key_idx, cuid, nt, nr_enc, ar_enc);
+    mu_assert(found == 0, "crypto1_batch_check_reader_auth() checked extra keys");
+
+    crypto1_batch_free(batch);
+}
+
+MU_TEST(mf_classic_crypto1_bench) {
+    MinunitBench bench;
+    Crypto1 crypto = {};
+    uint32_t result = 0;
+
+    crypto1_init(&crypto, nfc_test_crypto1_random_key());
+    minunit_bench_start(&bench, "crypto1_word_bitwise");
+    for(size_t i = 0; i < NFC_TEST_CRYPTO1_BENCH_WORDS; i++) {
+        result ^= nfc_test_crypto1_word_ref(&crypto, i, 0);
+    }
+    minunit_bench_stop(&bench, NFC_TEST_CRYPTO1_BENCH_WORDS, "words");
+
+    minunit_bench_start(&bench, "crypto1_word");
+    for(size_t i = 0; i < NFC_TEST_CRYPTO1_BENCH_WORDS; i++) {
+        result ^= crypto1_word(&crypto, i, 0);
+    }
+    minunit_bench_stop(&bench, NFC_TEST_CRYPTO1_BENCH_WORDS, "words");
+
+    Crypto1Batch* batch = crypto1_batch_alloc();
+    uint64_t keys[CRYPTO1_BATCH_SIZE];
+    for(size_t i = 0; i < CRYPTO1_BATCH_SIZE; i++) {
+        keys[i] = nfc_test_crypto1_random_key();
+    }
+
+    minunit_bench_start(&bench, "crypto1_batch_check_reader_auth");
+    for(size_t i = 0; i < NFC_TEST_CRYPTO1_BENCH_BATCHES; i++) {
+        result ^= crypto1_batch_check_reader_auth(batch, keys, CRYPTO1_BATCH_SIZE, i, i, i, i);
+    }
+    minunit_bench_stop(&bench, NFC_TEST_CRYPTO1_BENCH_BATCHES * CRYPTO1_BATCH_SIZE, "keys");
+
+    crypto1_batch_free(batch);
+    FURI_LOG_T(TAG, "Crypto1 bench result %08lX", result);
 }
 
 MU_TEST_SUITE(nfc) {
@@ -545,6 +720,10 @@ MU_TEST_SUITE(nfc) {
 
     MU_RUN_TEST(mf_classic_dict_test);
 
+    MU_RUN_TEST(mf_classic_crypto1_test);
+    MU_RUN_TEST(mf_classic_crypto1_batch_test);
+    MU_RUN_TEST(mf_classic_crypto1_bench);
+
     nfc_test_free();
 }
 
@@ -62,6 +62,7 @@ typedef struct {
 } Protocol1Data;
 
 static const uint64_t protocol_1_decoder_result = 0x1234567890ABCDEF;
+static size_t protocol_1_feed_count = 0;
 
 static void* protocol_1_alloc() {
     void* data = malloc(sizeof(Protocol1Data));
@@ -81,6 +82,7 @@ static void protocol_1_decoder_start(Protocol1Data* data) {
 }
 
 static bool protocol_1_decoder_feed(Protocol1Data* data, bool level, uint32_t duration) {
+    protocol_1_feed_count++;
     if(level && duration == 543) {
         data->data = 0x1234567890ABCDEF;
         return true;
@@ -130,6 +132,12 @@ static const ProtocolBase protocol_1 = {
         {
             .start = (ProtocolDecoderStart)protocol_1_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_1_decoder_feed,
+            .timing =
+                {
+                    .min = 500,
+                    .max = 600,
+                    .reject_after = 2,
+                },
         },
     .encoder =
         {
@@ -212,8 +220,43 @@ MU_TEST(test_protocol_dict) {
     free(data);
 }
 
+MU_TEST(test_protocol_dict_early_rejection) {
+    ProtocolDict* dict = protocol_dict_alloc(test_protocols_base, TestDictProtocolMax);
+    protocol_dict_decoders_start(dict);
+    protocol_1_feed_count = 0;
+
+    // out of range pulses: protocol 1 gets only first two of them
+    for(size_t i = 0; i < 100; i++) {
+        mu_assert_int_eq(PROTOCOL_NO, protocol_dict_decoders_feed(dict, i % 2, 100));
+    }
+    mu_assert_int_eq(2, protocol_1_feed_count);
+
+    // in-range pulse re-arms decoder
+    mu_assert_int_eq(PROTOCOL_NO, protocol_dict_decoders_feed(dict, false, 543));
+    mu_assert_int_eq(3, protocol_1_feed_count);
+    mu_assert_int_eq(TestDictProtocol1, protocol_dict_decoders_feed(dict, true, 543));
+    mu_assert_int_eq(4, protocol_1_feed_count);
+
+    for(size_t i = 0; i < 10; i++) {
+        protocol_dict_decoders_feed(dict, true, 1000);
+    }
+    mu_assert_int_eq(6, protocol_1_feed_count);
+
+    // decoders without timing signature get every pulse
+    mu_assert_int_eq(TestDictProtocol0, protocol_dict_decoders_feed(dict, true, 666));
+    mu_assert_int_eq(6, protocol_1_feed_count);
+
+    // start resets rejection state
+    protocol_dict_decoders_start(dict);
+    protocol_dict_decoders_feed(dict, true, 1000);
+    mu_assert_int_eq(7, protocol_1_feed_count);
+
+    protocol_dict_free(dict);
+}
+
 MU_TEST_SUITE(test_protocol_dict_suite) {
     MU_RUN_TEST(test_protocol_dict);
+    MU_RUN_TEST(test_protocol_dict_early_rejection);
 }
 
 int run_minunit_test_protocol_dict() {
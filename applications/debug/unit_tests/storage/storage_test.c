@@ -1,4 +1,5 @@
 #include "../minunit.h"
+#include "../minunit_bench.h"
 #include <furi.h>
 #include <storage/storage.h>
 
@@ -186,6 +187,156 @@ MU_TEST_SUITE(storage_file_64k) {
     MU_RUN_TEST(storage_file_read_write_64k);
 }
 
+#define STORAGE_BATCH_FILE UNIT_TESTS_PATH("storage_batch.test")
+#define STORAGE_BATCH_CHUNK (512U)
+#define STORAGE_BATCH_CHUNKS (8U)
+
+static void storage_batch_test_callback(StorageOp* ops, size_t executed, void* context) {
+    UNUSED(ops);
+    FuriMessageQueue* queue = context;
+    // Runs in storage service thread, a lost result fails the test on the receiving side
+    furi_message_queue_put(queue, &executed, 0);
+}
+
+MU_TEST(storage_batch_read_write) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const size_t size = STORAGE_BATCH_CHUNK * STORAGE_BATCH_CHUNKS;
+    uint8_t* data = malloc(size);
+    uint8_t* buffer = malloc(size);
+    for(size_t i = 0; i < size; i++) {
+        data[i] = (i % 113);
+    }
+
+    StorageOp ops[STORAGE_BATCH_CHUNKS + 1];
+    mu_check(storage_file_open(file, STORAGE_BATCH_FILE, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNKS; i++) {
+        ops[i] = (StorageOp){
+            .type = StorageOpTypeWrite,
+            .write = {file, data + i * STORAGE_BATCH_CHUNK, STORAGE_BATCH_CHUNK},
+        };
+    }
+    mu_assert_int_eq(
+        STORAGE_BATCH_CHUNKS, storage_batch(storage, ops, STORAGE_BATCH_CHUNKS, true));
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNKS; i++) {
+        mu_assert_int_eq(FSE_OK, ops[i].error);
+        mu_assert_int_eq(STORAGE_BATCH_CHUNK, ops[i].result);
+    }
+
+    // Seek, read all and stat in one request, read past the end is not an error
+    FileInfo fileinfo;
+    ops[0] = (StorageOp){.type = StorageOpTypeSeek, .seek = {file, 0, true}};
+    ops[1] = (StorageOp){.type = StorageOpTypeRead, .read = {file, buffer, size}};
+    ops[2] = (StorageOp){.type = StorageOpTypeRead, .read = {file, buffer, size}};
+    ops[3] = (StorageOp){.type = StorageOpTypeStat, .stat = {STORAGE_BATCH_FILE, &fileinfo}};
+    mu_assert_int_eq(4, storage_batch(storage, ops, 4, true));
+    mu_assert_int_eq(1, ops[0].result);
+    mu_assert_int_eq(size, ops[1].result);
+    mu_assert_int_eq(0, ops[2].result);
+    mu_assert_int_eq(FSE_OK, ops[3].error);
+    mu_assert_int_eq(size, fileinfo.size);
+    mu_assert_mem_eq(data, buffer, size);
+
+    // Remaining operations are skipped after an error
+    ops[0] = (StorageOp){.type = StorageOpTypeStat, .stat = {UNIT_TESTS_PATH("missing"), NULL}};
+    mu_assert_int_eq(1, storage_batch(storage, ops, 4, true));
+    mu_assert_int_eq(FSE_NOT_EXIST, ops[0].error);
+    mu_assert_int_eq(4, storage_batch(storage, ops, 4, false));
+
+    // Malformed operations are rejected, not executed
+    ops[0] = (StorageOp){.type = StorageOpTypeStat, .stat = {NULL, &fileinfo}};
+    ops[1] = (StorageOp){.type = StorageOpTypeRead, .read = {NULL, buffer, size}};
+    mu_assert_int_eq(2, storage_batch(storage, ops, 2, false));
+    mu_assert_int_eq(FSE_INVALID_PARAMETER, ops[0].error);
+    mu_assert_int_eq(FSE_INVALID_PARAMETER, ops[1].error);
+    mu_assert_int_eq(0, ops[1].result);
+
+    // Asynchronous requests are completed in submission order
+    FuriMessageQueue* queue = furi_message_queue_alloc(STORAGE_BATCH_CHUNKS + 1, sizeof(size_t));
+    memset(buffer, 0, size);
+    ops[0] = (StorageOp){.type = StorageOpTypeSeek, .seek = {file, 0, true}};
+    storage_batch_submit(storage, ops, 1, true, storage_batch_test_callback, queue);
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNKS; i++) {
+        ops[i + 1] = (StorageOp){
+            .type = StorageOpTypeRead,
+            .read = {file, buffer + i * STORAGE_BATCH_CHUNK, STORAGE_BATCH_CHUNK},
+        };
+        storage_batch_submit(storage, &ops[i + 1], 1, true, storage_batch_test_callback, queue);
+    }
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNKS + 1; i++) {
+        size_t executed = 0;
+        mu_assert_int_eq(FuriStatusOk, furi_message_queue_get(queue, &executed, 1000));
+        mu_assert_int_eq(1, executed);
+    }
+    mu_assert_mem_eq(data, buffer, size);
+    furi_message_queue_free(queue);
+
+    // Round trip cost: one request per chunk against one request for all chunks
+    uint32_t start = DWT->CYCCNT;
+    storage_file_seek(file, 0, true);
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNKS; i++) {
+        storage_file_read(file, buffer + i * STORAGE_BATCH_CHUNK, STORAGE_BATCH_CHUNK);
+    }
+    minunit_bench_report(
+        "storage/sequential_read", DWT->CYCCNT - start, STORAGE_BATCH_CHUNKS, "chunks");
+
+    start = DWT->CYCCNT;
+    ops[0] = (StorageOp){.type = StorageOpTypeSeek, .seek = {file, 0, true}};
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNKS; i++) {
+        ops[i + 1] = (StorageOp){
+            .type = StorageOpTypeRead,
+            .read = {file, buffer + i * STORAGE_BATCH_CHUNK, STORAGE_BATCH_CHUNK},
+        };
+    }
+    storage_batch(storage, ops, STORAGE_BATCH_CHUNKS + 1, true);
+    minunit_bench_report(
+        "storage/batch_read", DWT->CYCCNT - start, STORAGE_BATCH_CHUNKS, "chunks");
+
+    storage_file_close(file);
+    storage_common_remove(storage, STORAGE_BATCH_FILE);
+    free(buffer);
+    free(data);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(storage_batch_dir_read) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* dir = storage_file_alloc(storage);
+    FileInfo fileinfo[STORAGE_BATCH_CHUNKS];
+    char names[STORAGE_BATCH_CHUNKS][32];
+    StorageOp ops[STORAGE_BATCH_CHUNKS];
+
+    storage_simply_mkdir(storage, STORAGE_TEST_DIR);
+    mu_check(storage_file_create(storage, STORAGE_TEST_DIR "/batch_a", "a"));
+    mu_check(storage_file_create(storage, STORAGE_TEST_DIR "/batch_b", "b"));
+
+    mu_check(storage_dir_open(dir, STORAGE_TEST_DIR));
+    for(size_t i = 0; i < STORAGE_BATCH_CHUNKS; i++) {
+        ops[i] = (StorageOp){
+            .type = StorageOpTypeDirRead,
+            .dir_read = {dir, &fileinfo[i], names[i], sizeof(names[i])},
+        };
+    }
+    // Reading stops at the end of the directory
+    const size_t executed = storage_batch(storage, ops, STORAGE_BATCH_CHUNKS, true);
+    mu_check(executed >= 3);
+    mu_check(executed < STORAGE_BATCH_CHUNKS);
+    mu_assert_int_eq(0, ops[executed - 1].result);
+    mu_assert_int_eq(FSE_NOT_EXIST, ops[executed - 1].error);
+    storage_dir_close(dir);
+
+    storage_simply_remove(storage, STORAGE_TEST_DIR "/batch_a");
+    storage_simply_remove(storage, STORAGE_TEST_DIR "/batch_b");
+    storage_file_free(dir);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(storage_batch_suite) {
+    MU_RUN_TEST(storage_batch_read_write);
+    MU_RUN_TEST(storage_batch_dir_read);
+}
+
 MU_TEST(storage_dir_open_close) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* file;
@@ -258,10 +409,52 @@ MU_TEST(storage_dir_exists_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+static size_t storage_dir_count_items(Storage* storage, const char* path) {
+    File* dir = storage_file_alloc(storage);
+    size_t count = 0;
+    if(storage_dir_open(dir, path)) {
+        while(storage_dir_read(dir, NULL, NULL, 0)) {
+            count++;
+        }
+    }
+    storage_dir_close(dir);
+    storage_file_free(dir);
+    return count;
+}
+
+MU_TEST(storage_dir_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    StorageDirCacheStats before, after;
+
+    mu_assert_int_eq(FSE_OK, storage_common_mkdir(storage, STORAGE_TEST_DIR));
+    mu_check(storage_file_create(storage, STORAGE_TEST_DIR "/cache_a", "a"));
+
+    // First listing is recorded, second one is served from the cache
+    mu_assert_int_eq(1, storage_dir_count_items(storage, STORAGE_TEST_DIR));
+    storage_get_dir_cache_stats(storage, &before);
+    mu_assert_int_eq(1, storage_dir_count_items(storage, STORAGE_TEST_DIR));
+    storage_get_dir_cache_stats(storage, &after);
+    mu_assert_int_eq(before.hits + 1, after.hits);
+
+    // New file invalidates the listing
+    mu_check(storage_file_create(storage, STORAGE_TEST_DIR "/cache_b", "b"));
+    storage_get_dir_cache_stats(storage, &before);
+    mu_assert_int_eq(2, storage_dir_count_items(storage, STORAGE_TEST_DIR));
+    storage_get_dir_cache_stats(storage, &after);
+    mu_assert_int_eq(before.misses + 1, after.misses);
+
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, STORAGE_TEST_DIR "/cache_a"));
+    mu_assert_int_eq(1, storage_dir_count_items(storage, STORAGE_TEST_DIR));
+
+    mu_check(storage_simply_remove_recursive(storage, STORAGE_TEST_DIR));
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_dir) {
     MU_RUN_TEST(storage_dir_open_close);
     MU_RUN_TEST(storage_dir_open_lock);
     MU_RUN_TEST(storage_dir_exists_test);
+    MU_RUN_TEST(storage_dir_cache_test);
 }
 
 static const char* const storage_copy_test_paths[] = {
@@ -705,6 +898,7 @@ MU_TEST_SUITE(test_md5_calc_suite) {
 int run_minunit_test_storage() {
     MU_RUN_SUITE(storage_file);
     MU_RUN_SUITE(storage_file_64k);
+    MU_RUN_SUITE(storage_batch_suite);
     MU_RUN_SUITE(storage_dir);
     MU_RUN_SUITE(storage_rename);
     MU_RUN_SUITE(test_data_path);
@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include "../minunit.h"
+#include "../minunit_bench.h"
 #include <lib/subghz/receiver.h>
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
@@ -18,12 +19,17 @@
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
 #define TEST_TIMEOUT 10000
+#define TEST_BATCH_SIZE 64
+#define TEST_REPLAY_DIR_NAME EXT_PATH("unit_tests/subghz")
+#define TEST_REPLAY_FILE_SUFFIX "_raw.sub"
 
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
 //static SubGhzTransmitter* transmitter_handler;
 static SubGhzFileEncoderWorker* file_worker_encoder_handler;
 static uint16_t subghz_test_decoder_count = 0;
+// Order sensitive hash of decoded signals, to compare decoding paths
+static uint32_t subghz_test_decoder_hash = 0;
 
 static void subghz_test_rx_callback(
     SubGhzReceiver* receiver,
@@ -36,6 +42,9 @@ static void subghz_test_rx_callback(
     subghz_protocol_decoder_base_get_string(decoder_base, text);
     subghz_receiver_reset(receiver_handler);
     FURI_LOG_T(TAG, "\r\n%s", furi_string_get_cstr(text));
+    for(const char* c = furi_string_get_cstr(text); *c; c++) {
+        subghz_test_decoder_hash = subghz_test_decoder_hash * 31 + *c;
+    }
     furi_string_free(text);
     subghz_test_decoder_count++;
 }
@@ -105,10 +114,13 @@ static bool subghz_decoder_test(const char* path, const char* name_decoder) {
     }
 }
 
-static bool subghz_decode_random_test(const char* path) {
+static bool subghz_decode_random_test(const char* path, bool batch) {
     subghz_test_decoder_count = 0;
+    subghz_test_decoder_hash = 0;
     subghz_receiver_reset(receiver_handler);
     uint32_t test_start = furi_get_tick();
+    LevelDuration* pulses = malloc(sizeof(LevelDuration) * TEST_BATCH_SIZE);
+    size_t pulse_count = 0;
 
     file_worker_encoder_handler = subghz_file_encoder_worker_alloc();
     if(subghz_file_encoder_worker_start(file_worker_encoder_handler, path, NULL)) {
@@ -124,17 +136,27 @@ static bool subghz_decode_random_test(const char* path) {
                 uint32_t duration = level_duration_get_duration(level_duration);
                 // Yield, to load data inside the worker
                 furi_thread_yield();
-                subghz_receiver_decode(receiver_handler, level, duration);
+                if(batch) {
+                    pulses[pulse_count++] = level_duration_make(level, duration);
+                    if(pulse_count == TEST_BATCH_SIZE) {
+                        subghz_receiver_decode_batch(receiver_handler, pulses, pulse_count);
+                        pulse_count = 0;
+                    }
+                } else {
+                    subghz_receiver_decode(receiver_handler, level, duration);
+                }
             } else {
                 break;
             }
         }
+        subghz_receiver_decode_batch(receiver_handler, pulses, pulse_count);
         furi_delay_ms(10);
         if(subghz_file_encoder_worker_is_running(file_worker_encoder_handler)) {
             subghz_file_encoder_worker_stop(file_worker_encoder_handler);
         }
         subghz_file_encoder_worker_free(file_worker_encoder_handler);
     }
+    free(pulses);
     FURI_LOG_D(TAG, "Decoder count parse %d", subghz_test_decoder_count);
     if(furi_get_tick() - test_start > TEST_TIMEOUT * 10) {
         printf("Random test ERROR TimeOut\r\n");
@@ -146,6 +168,192 @@ static bool subghz_decode_random_test(const char* path) {
     }
 }
 
+typedef struct {
+    size_t count;
+    SubGhzProtocolDecoderBase** decoders;
+    uint64_t* cycles;
+    uint32_t* hits;
+    uint64_t receiver_cycles;
+    size_t edges;
+    size_t files;
+    bool per_protocol;
+    int32_t* raw;
+    uint32_t raw_size;
+} SubGhzReplayBench;
+
+static void subghz_replay_bench_rx_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(receiver);
+    SubGhzReplayBench* bench = context;
+    // Hits are counted on the receiver pass only
+    if(bench->per_protocol) return;
+
+    for(size_t i = 0; i < bench->count; i++) {
+        if(bench->decoders[i] == decoder_base) {
+            bench->hits[i]++;
+            break;
+        }
+    }
+}
+
+static void subghz_replay_bench_feed(SubGhzReplayBench* bench, uint32_t raw_count) {
+    if(bench->per_protocol) {
+        // Decoders are independent, so every decoder gets the whole chunk in turn
+        for(size_t i = 0; i < bench->count; i++) {
+            SubGhzProtocolDecoderBase* decoder = bench->decoders[i];
+            if(!decoder) continue;
+
+            uint32_t start = DWT->CYCCNT;
+            for(uint32_t j = 0; j < raw_count; j++) {
+                int32_t value = bench->raw[j];
+                if(value > 0) {
+                    decoder->protocol->decoder->feed(decoder, true, value);
+                } else {
+                    decoder->protocol->decoder->feed(decoder, false, -value);
+                }
+            }
+            bench->cycles[i] += DWT->CYCCNT - start;
+        }
+    } else {
+        uint32_t start = DWT->CYCCNT;
+        for(uint32_t j = 0; j < raw_count; j++) {
+            int32_t value = bench->raw[j];
+            if(value > 0) {
+                subghz_receiver_decode(receiver_handler, true, value);
+            } else {
+                subghz_receiver_decode(receiver_handler, false, -value);
+            }
+        }
+        bench->receiver_cycles += DWT->CYCCNT - start;
+        bench->edges += raw_count;
+    }
+}
+
+static bool
+    subghz_replay_bench_file(SubGhzReplayBench* bench, Storage* storage, const char* path) {
+    FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
+    bool result = false;
+
+    subghz_receiver_reset(receiver_handler);
+    do {
+        if(!flipper_format_file_open_existing(fff_data_file, path)) {
+            FURI_LOG_E(TAG, "Error open file %s", path);
+            break;
+        }
+
+        // Stream the capture one RAW_Data line at a time, whole files don't fit in RAM
+        uint32_t raw_count = 0;
+        result = true;
+        while(flipper_format_get_value_count(fff_data_file, "RAW_Data", &raw_count)) {
+            if(raw_count > bench->raw_size) {
+                free(bench->raw);
+                bench->raw = malloc(raw_count * sizeof(int32_t));
+                bench->raw_size = raw_count;
+            }
+            if(!flipper_format_read_int32(fff_data_file, "RAW_Data", bench->raw, raw_count)) {
+                FURI_LOG_E(TAG, "Error read RAW_Data in %s", path);
+                result = false;
+                break;
+            }
+            subghz_replay_bench_feed(bench, raw_count);
+        }
+    } while(false);
+
+    flipper_format_free(fff_data_file);
+    return result;
+}
+
+static bool subghz_replay_bench_dir(SubGhzReplayBench* bench, const char* dir_path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* dir = storage_file_alloc(storage);
+    FuriString* path = furi_string_alloc();
+    FileInfo fileinfo;
+    char name[128];
+    bool result = storage_dir_open(dir, dir_path);
+
+    while(result && storage_dir_read(dir, &fileinfo, name, sizeof(name))) {
+        furi_string_printf(path, "%s/%s", dir_path, name);
+        if(file_info_is_dir(&fileinfo) || !furi_string_end_with(path, TEST_REPLAY_FILE_SUFFIX)) {
+            continue;
+        }
+
+        result = subghz_replay_bench_file(bench, storage, furi_string_get_cstr(path));
+        if(!bench->per_protocol) bench->files++;
+    }
+
+    storage_dir_close(dir);
+    furi_string_free(path);
+    storage_file_free(dir);
+    furi_record_close(RECORD_STORAGE);
+    return result;
+}
+
+static bool subghz_replay_bench_test(const char* dir_path) {
+    const SubGhzProtocolRegistry* registry = &subghz_protocol_registry;
+    SubGhzReplayBench bench = {0};
+    bench.count = subghz_protocol_registry_count(registry);
+    bench.decoders = malloc(bench.count * sizeof(SubGhzProtocolDecoderBase*));
+    bench.cycles = malloc(bench.count * sizeof(uint64_t));
+    bench.hits = malloc(bench.count * sizeof(uint32_t));
+
+    for(size_t i = 0; i < bench.count; i++) {
+        const SubGhzProtocol* protocol = subghz_protocol_registry_get_by_index(registry, i);
+        bench.decoders[i] =
+            subghz_receiver_search_decoder_base_by_name(receiver_handler, protocol->name);
+    }
+
+    // Whole registry, the way the receiver runs with every protocol enabled
+    subghz_receiver_set_filter(receiver_handler, (SubGhzProtocolFlag)UINT32_MAX);
+    subghz_receiver_set_rx_callback(receiver_handler, subghz_replay_bench_rx_callback, &bench);
+
+    // First pass is the real receive path, second one splits time between decoders
+    bool result = subghz_replay_bench_dir(&bench, dir_path);
+    if(result) {
+        bench.per_protocol = true;
+        result = subghz_replay_bench_dir(&bench, dir_path);
+    }
+
+    subghz_receiver_set_rx_callback(receiver_handler, subghz_test_rx_callback, NULL);
+    subghz_receiver_set_filter(receiver_handler, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_reset(receiver_handler);
+
+    if(result && bench.edges) {
+        uint64_t total_cycles = 0;
+        for(size_t i = 0; i < bench.count; i++) {
+            total_cycles += bench.cycles[i];
+        }
+
+        printf("Replayed %zu files from %s\r\n", bench.files, dir_path);
+        minunit_bench_report("subghz_replay", bench.receiver_cycles, bench.edges, "edges");
+
+        FuriString* name = furi_string_alloc();
+        for(size_t i = 0; i < bench.count; i++) {
+            if(!bench.decoders[i]) continue;
+
+            uint32_t share = total_cycles ? (bench.cycles[i] * 10000 / total_cycles) : 0;
+            furi_string_printf(name, "subghz_replay/%s", bench.decoders[i]->protocol->name);
+            minunit_bench_report(
+                furi_string_get_cstr(name), bench.cycles[i], bench.edges, "edges");
+            printf(
+                "%s: %lu.%02lu%% time, %lu hits\r\n",
+                furi_string_get_cstr(name),
+                share / 100,
+                share % 100,
+                bench.hits[i]);
+        }
+        furi_string_free(name);
+    }
+
+    free(bench.raw);
+    free(bench.hits);
+    free(bench.cycles);
+    free(bench.decoders);
+
+    return result && bench.edges;
+}
+
 static bool subghz_encoder_test(const char* path) {
     subghz_test_decoder_count = 0;
     uint32_t test_start = furi_get_tick();
@@ -827,7 +1035,36 @@ MU_TEST(subghz_decoder_acurite_592txr_test) {
 }
 
 MU_TEST(subghz_random_test) {
-    mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
+    mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME, false), "Random test error\r\n");
+}
+
+MU_TEST(subghz_random_batch_test) {
+    // Rx callback resets the receiver, like the receiver scene does, in the middle of batches
+    mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME, false), "Random test error\r\n");
+    const uint32_t hash = subghz_test_decoder_hash;
+
+    mu_assert(
+        subghz_decode_random_test(TEST_RANDOM_DIR_NAME, true), "Random batch test error\r\n");
+    mu_assert(
+        subghz_test_decoder_hash == hash,
+        "Batch decoding callbacks differ from per pulse decoding\r\n");
+}
+
+MU_TEST(subghz_random_prefilter_test) {
+    SubGhzReceiverStats stats;
+    subghz_receiver_set_prefilter(receiver_handler, true);
+    subghz_receiver_reset_stats(receiver_handler);
+
+    bool result = subghz_decode_random_test(TEST_RANDOM_DIR_NAME, false);
+    subghz_receiver_get_stats(receiver_handler, &stats);
+    subghz_receiver_set_prefilter(receiver_handler, false);
+
+    mu_assert(result, "Random prefilter test error\r\n");
+    mu_assert(stats.feeds_skipped > 0, "Prefilter skipped no feeds\r\n");
+}
+
+MU_TEST(subghz_replay_bench) {
+    mu_assert(subghz_replay_bench_test(TEST_REPLAY_DIR_NAME), "Replay benchmark error\r\n");
 }
 
 MU_TEST_SUITE(subghz) {
@@ -906,7 +1143,11 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_mastercode_test);
     MU_RUN_TEST(subghz_decoder_acurite_592txr_test);
 
+
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_random_batch_test);
+    MU_RUN_TEST(subghz_random_prefilter_test);
+    MU_RUN_TEST(subghz_replay_bench);
     subghz_test_deinit();
 }
 
@@ -2,6 +2,7 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include "minunit_vars.h"
+#include "minunit_bench.h"
 #include <notification/notification_messages.h>
 #include <cli/cli.h>
 #include <loader/loader.h>
@@ -90,6 +91,32 @@ void minunit_printf_warning(const char* format, ...) {
     furi_string_free(str);
 }
 
+void minunit_bench_start(MinunitBench* bench, const char* name) {
+    bench->name = name;
+    bench->start = DWT->CYCCNT;
+}
+
+uint32_t minunit_bench_stop(MinunitBench* bench, size_t items, const char* unit) {
+    uint32_t cycles = DWT->CYCCNT - bench->start;
+    return minunit_bench_report(bench->name, cycles, items, unit);
+}
+
+uint32_t minunit_bench_report(const char* name, uint64_t cycles, size_t items, const char* unit) {
+    uint32_t elapsed_us = cycles / furi_hal_cortex_instructions_per_microsecond();
+    uint64_t items_per_second = elapsed_us ? ((uint64_t)items * 1000000UL / elapsed_us) : 0;
+
+    printf(
+        "[bench] %s: %zu %s in %lu us, %lu %s/s\r\n",
+        name,
+        items,
+        unit,
+        elapsed_us,
+        (uint32_t)items_per_second,
+        unit);
+
+    return elapsed_us;
+}
+
 void unit_tests_cli(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
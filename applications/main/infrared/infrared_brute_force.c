@@ -3,9 +3,20 @@
 #include <stdlib.h>
 #include <m-dict.h>
 #include <flipper_format/flipper_format.h>
+#include <flipper_format/flipper_format_i.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include <infrared_worker.h>
 
 #include "infrared_signal.h"
 
+#define TAG "InfraredBruteForce"
+
+// Compiled index is stored next to the database
+#define INFRARED_BRUTE_FORCE_INDEX_EXTENSION ".idx"
+#define INFRARED_BRUTE_FORCE_INDEX_MAGIC (0x58425249UL) // "IRBX"
+#define INFRARED_BRUTE_FORCE_INDEX_VERSION (1U)
+#define INFRARED_BRUTE_FORCE_READ_WINDOW (4096U)
+
 typedef struct {
     uint32_t index;
     uint32_t count;
@@ -18,20 +29,305 @@ DICT_DEF2(
     InfraredBruteForceRecord,
     M_POD_OPLIST);
 
+/* Index file layout: InfraredBruteForceIndexHeader followed by record_count signals,
+ * each one is InfraredBruteForceIndexSignal, name_size bytes of the name and body_size bytes
+ * of the decoded body. Header is written last, so an interrupted build leaves an invalid file. */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t source_timestamp;
+    uint32_t record_count;
+} InfraredBruteForceIndexHeader;
+
+typedef enum {
+    InfraredBruteForceIndexSignalTypeParsed,
+    InfraredBruteForceIndexSignalTypeRaw,
+    // Signal that failed to load, stops the brute force just as the database would
+    InfraredBruteForceIndexSignalTypeInvalid,
+} InfraredBruteForceIndexSignalType;
+
+typedef struct {
+    uint32_t source_offset; /**< database offset of the signal, right after the name */
+    uint32_t body_size;
+    uint8_t name_size;
+    uint8_t type; /**< InfraredBruteForceIndexSignalType */
+    uint8_t reserved[2];
+} InfraredBruteForceIndexSignal;
+
+typedef struct {
+    uint32_t protocol;
+    uint32_t address;
+    uint32_t command;
+} InfraredBruteForceIndexParsed;
+
+typedef struct {
+    uint32_t frequency;
+    float duty_cycle;
+    uint32_t timings_size;
+    // followed by timings_size timings
+} InfraredBruteForceIndexRaw;
+
 struct InfraredBruteForce {
     FlipperFormat* ff;
+    Stream* index;
     const char* db_filename;
     FuriString* current_record_name;
     InfraredSignal* current_signal;
     InfraredBruteForceRecordDict_t records;
+    // Index offsets of the signals of the current record
+    uint32_t* signal_offsets;
+    uint32_t signal_count;
+    uint32_t signal_next;
     bool is_started;
 };
 
+static FuriString* infrared_brute_force_get_index_path(InfraredBruteForce* brute_force) {
+    return furi_string_alloc_printf(
+        "%s%s", brute_force->db_filename, INFRARED_BRUTE_FORCE_INDEX_EXTENSION);
+}
+
+static bool infrared_brute_force_get_source_info(
+    Storage* storage,
+    const char* db_filename,
+    InfraredBruteForceIndexHeader* header) {
+    FileInfo file_info;
+    if(storage_common_stat(storage, db_filename, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(storage, db_filename, &header->source_timestamp) != FSE_OK) {
+        return false;
+    }
+
+    header->magic = INFRARED_BRUTE_FORCE_INDEX_MAGIC;
+    header->version = INFRARED_BRUTE_FORCE_INDEX_VERSION;
+    header->source_size = file_info.size;
+    header->record_count = 0;
+    return true;
+}
+
+static bool infrared_brute_force_index_write_signal(
+    Stream* index,
+    const InfraredSignal* signal,
+    bool is_valid,
+    const FuriString* name,
+    uint32_t source_offset) {
+    const size_t name_size = furi_string_size(name);
+    if(name_size > UINT8_MAX) return false;
+
+    InfraredBruteForceIndexSignal header = {
+        .source_offset = source_offset,
+        .name_size = name_size,
+        .type = InfraredBruteForceIndexSignalTypeInvalid,
+    };
+    InfraredBruteForceIndexParsed parsed;
+    InfraredBruteForceIndexRaw raw;
+    const void* body = NULL;
+    const uint32_t* timings = NULL;
+
+    if(is_valid && infrared_signal_is_raw(signal)) {
+        const InfraredRawSignal* raw_signal = infrared_signal_get_raw_signal(signal);
+        raw.frequency = raw_signal->frequency;
+        raw.duty_cycle = raw_signal->duty_cycle;
+        raw.timings_size = raw_signal->timings_size;
+        timings = raw_signal->timings;
+        body = &raw;
+        header.type = InfraredBruteForceIndexSignalTypeRaw;
+        header.body_size = sizeof(raw) + raw.timings_size * sizeof(uint32_t);
+    } else if(is_valid) {
+        const InfraredMessage* message = infrared_signal_get_message(signal);
+        parsed.protocol = message->protocol;
+        parsed.address = message->address;
+        parsed.command = message->command;
+        body = &parsed;
+        header.type = InfraredBruteForceIndexSignalTypeParsed;
+        header.body_size = sizeof(parsed);
+    }
+
+    bool success = false;
+    do {
+        if(stream_write(index, (const uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+        if(stream_write(index, (const uint8_t*)furi_string_get_cstr(name), name_size) !=
+           name_size)
+            break;
+        if(header.type == InfraredBruteForceIndexSignalTypeRaw) {
+            const size_t timings_size = raw.timings_size * sizeof(uint32_t);
+            if(stream_write(index, body, sizeof(raw)) != sizeof(raw)) break;
+            if(stream_write(index, (const uint8_t*)timings, timings_size) != timings_size) break;
+        } else if(header.type == InfraredBruteForceIndexSignalTypeParsed) {
+            if(stream_write(index, body, sizeof(parsed)) != sizeof(parsed)) break;
+        }
+        success = true;
+    } while(false);
+
+    return success;
+}
+
+// Parse the whole database and store decoded signals in the index
+static bool infrared_brute_force_index_build(
+    Storage* storage,
+    const char* db_filename,
+    Stream* index,
+    InfraredBruteForceIndexHeader* header) {
+    FlipperFormat* ff =
+        flipper_format_buffered_file_alloc_ex(storage, INFRARED_BRUTE_FORCE_READ_WINDOW);
+    Stream* ff_stream = flipper_format_get_raw_stream(ff);
+    InfraredSignal* signal = infrared_signal_alloc();
+    FuriString* name = furi_string_alloc();
+    const InfraredBruteForceIndexHeader blank = {0};
+
+    bool success = false;
+    do {
+        if(!flipper_format_buffered_file_open_existing(ff, db_filename)) break;
+        if(stream_write(index, (const uint8_t*)&blank, sizeof(blank)) != sizeof(blank)) break;
+
+        bool error = false;
+        while(infrared_signal_read_name(ff, name)) {
+            const size_t source_offset = stream_tell(ff_stream);
+            const bool is_valid = infrared_signal_read_body(signal, ff);
+            if(!infrared_brute_force_index_write_signal(
+                   index, signal, is_valid, name, source_offset)) {
+                error = true;
+                break;
+            }
+            header->record_count++;
+            // Next name is searched from this one, as the database scan does when counting
+            if(!stream_seek(ff_stream, source_offset, StreamOffsetFromStart)) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        if(!stream_rewind(index)) break;
+        if(stream_write(index, (const uint8_t*)header, sizeof(*header)) != sizeof(*header)) break;
+
+        success = true;
+    } while(false);
+
+    furi_string_free(name);
+    infrared_signal_free(signal);
+    flipper_format_free(ff);
+    return success;
+}
+
+// Open the index, build it first if it is missing or older than the database
+static Stream* infrared_brute_force_index_open(
+    InfraredBruteForce* brute_force,
+    Storage* storage,
+    InfraredBruteForceIndexHeader* header) {
+    InfraredBruteForceIndexHeader expected;
+    if(!infrared_brute_force_get_source_info(storage, brute_force->db_filename, &expected)) {
+        return NULL;
+    }
+
+    FuriString* index_path = infrared_brute_force_get_index_path(brute_force);
+    Stream* index = buffered_file_stream_alloc_ex(storage, INFRARED_BRUTE_FORCE_READ_WINDOW);
+    bool success = false;
+
+    if(buffered_file_stream_open(
+           index, furi_string_get_cstr(index_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        success = (stream_read(index, (uint8_t*)header, sizeof(*header)) == sizeof(*header)) &&
+                  header->magic == expected.magic && header->version == expected.version &&
+                  header->source_size == expected.source_size &&
+                  header->source_timestamp == expected.source_timestamp;
+    }
+
+    if(!success) {
+        buffered_file_stream_close(index);
+        FURI_LOG_I(TAG, "Building index %s", furi_string_get_cstr(index_path));
+        if(buffered_file_stream_open(
+               index, furi_string_get_cstr(index_path), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+            success = infrared_brute_force_index_build(
+                storage, brute_force->db_filename, index, &expected);
+        }
+        if(success) {
+            *header = expected;
+            success = stream_seek(index, sizeof(expected), StreamOffsetFromStart);
+        } else {
+            FURI_LOG_W(TAG, "Index build failed");
+            buffered_file_stream_close(index);
+            storage_simply_remove(storage, furi_string_get_cstr(index_path));
+        }
+    }
+
+    furi_string_free(index_path);
+
+    if(!success) {
+        stream_free(index);
+        index = NULL;
+    }
+
+    return index;
+}
+
+// Read the signal header and name, position is left at the signal body
+static bool infrared_brute_force_index_read_signal(
+    Stream* index,
+    InfraredBruteForceIndexSignal* signal,
+    FuriString* name) {
+    char name_buffer[UINT8_MAX + 1];
+    if(stream_read(index, (uint8_t*)signal, sizeof(*signal)) != sizeof(*signal)) return false;
+    if(stream_read(index, (uint8_t*)name_buffer, signal->name_size) != signal->name_size) {
+        return false;
+    }
+    furi_string_set_strn(name, name_buffer, signal->name_size);
+    return true;
+}
+
+// Signals are stored in database order, inside of the database they were built from
+static bool infrared_brute_force_index_check_signal(
+    const InfraredBruteForceIndexHeader* header,
+    const InfraredBruteForceIndexSignal* signal,
+    uint32_t* last_offset) {
+    if(signal->source_offset <= *last_offset) return false;
+    if(signal->source_offset > header->source_size) return false;
+    *last_offset = signal->source_offset;
+    return true;
+}
+
+static bool infrared_brute_force_index_read_body(
+    Stream* index,
+    const InfraredBruteForceIndexSignal* header,
+    InfraredSignal* signal) {
+    bool success = false;
+
+    if(header->type == InfraredBruteForceIndexSignalTypeParsed) {
+        InfraredBruteForceIndexParsed parsed;
+        if(stream_read(index, (uint8_t*)&parsed, sizeof(parsed)) == sizeof(parsed)) {
+            const InfraredMessage message = {
+                .protocol = parsed.protocol,
+                .address = parsed.address,
+                .command = parsed.command,
+            };
+            infrared_signal_set_message(signal, &message);
+            success = true;
+        }
+    } else if(header->type == InfraredBruteForceIndexSignalTypeRaw) {
+        InfraredBruteForceIndexRaw raw;
+        if(stream_read(index, (uint8_t*)&raw, sizeof(raw)) == sizeof(raw) &&
+           raw.timings_size <= MAX_TIMINGS_AMOUNT) {
+            const size_t timings_size = raw.timings_size * sizeof(uint32_t);
+            uint32_t* timings = malloc(timings_size);
+            if(stream_read(index, (uint8_t*)timings, timings_size) == timings_size) {
+                infrared_signal_set_raw_signal(
+                    signal, timings, raw.timings_size, raw.frequency, raw.duty_cycle);
+                success = true;
+            }
+            free(timings);
+        }
+    }
+
+    return success;
+}
+
 InfraredBruteForce* infrared_brute_force_alloc() {
     InfraredBruteForce* brute_force = malloc(sizeof(InfraredBruteForce));
     brute_force->ff = NULL;
+    brute_force->index = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
+    brute_force->signal_offsets = NULL;
+    brute_force->signal_count = 0;
+    brute_force->signal_next = 0;
     brute_force->is_started = false;
     brute_force->current_record_name = furi_string_alloc();
     InfraredBruteForceRecordDict_init(brute_force->records);
@@ -50,29 +346,74 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
     brute_force->db_filename = db_filename;
 }
 
+static void infrared_brute_force_count_signal(InfraredBruteForce* brute_force, FuriString* name) {
+    InfraredBruteForceRecord* record =
+        InfraredBruteForceRecordDict_get(brute_force->records, name);
+    if(record) { //-V547
+        ++(record->count);
+    }
+}
+
 bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
     furi_assert(brute_force->db_filename);
     bool success = false;
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    FuriString* signal_name;
+    signal_name = furi_string_alloc();
 
-    success = flipper_format_buffered_file_open_existing(ff, brute_force->db_filename);
-    if(success) {
-        FuriString* signal_name;
-        signal_name = furi_string_alloc();
-        while(flipper_format_read_string(ff, "name", signal_name)) {
-            InfraredBruteForceRecord* record =
-                InfraredBruteForceRecordDict_get(brute_force->records, signal_name);
-            if(record) { //-V547
-                ++(record->count);
+    InfraredBruteForceIndexHeader index_header;
+    Stream* index = infrared_brute_force_index_open(brute_force, storage, &index_header);
+    if(index) {
+        InfraredBruteForceIndexSignal header;
+        uint32_t signals_read = 0;
+        uint32_t last_offset = 0;
+        success = true;
+        while(!stream_eof(index)) {
+            if(!infrared_brute_force_index_read_signal(index, &header, signal_name) ||
+               !infrared_brute_force_index_check_signal(&index_header, &header, &last_offset) ||
+               !stream_seek(index, header.body_size, StreamOffsetFromCurrent)) {
+                success = false;
+                break;
+            }
+            infrared_brute_force_count_signal(brute_force, signal_name);
+            signals_read++;
+        }
+        success = success && (signals_read == index_header.record_count);
+        stream_free(index);
+
+        if(!success) {
+            // Damaged index, remove it so that it gets rebuilt next time
+            FuriString* index_path = infrared_brute_force_get_index_path(brute_force);
+            FURI_LOG_W(TAG, "Index %s is damaged", furi_string_get_cstr(index_path));
+            storage_simply_remove(storage, furi_string_get_cstr(index_path));
+            furi_string_free(index_path);
+
+            // Start over with the database
+            InfraredBruteForceRecordDict_it_t it;
+            for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+                !InfraredBruteForceRecordDict_end_p(it);
+                InfraredBruteForceRecordDict_next(it)) {
+                InfraredBruteForceRecordDict_ref(it)->value.count = 0;
             }
         }
-        furi_string_free(signal_name);
     }
 
-    flipper_format_free(ff);
+    if(!success) {
+        FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+
+        success = flipper_format_buffered_file_open_existing(ff, brute_force->db_filename);
+        if(success) {
+            while(flipper_format_read_string(ff, "name", signal_name)) {
+                infrared_brute_force_count_signal(brute_force, signal_name);
+            }
+        }
+
+        flipper_format_free(ff);
+    }
+
+    furi_string_free(signal_name);
     furi_record_close(RECORD_STORAGE);
     return success;
 }
@@ -101,11 +442,37 @@ bool infrared_brute_force_start(
 
     if(*record_count) {
         Storage* storage = furi_record_open(RECORD_STORAGE);
-        brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
         brute_force->is_started = true;
-        success =
-            flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
+        InfraredBruteForceIndexHeader index_header;
+        brute_force->index = infrared_brute_force_index_open(brute_force, storage, &index_header);
+
+        if(brute_force->index) {
+            // Collect offsets of the record signals, so that sending seeks straight to them
+            brute_force->signal_offsets = malloc(sizeof(uint32_t) * (*record_count));
+            InfraredBruteForceIndexSignal header;
+            FuriString* signal_name = furi_string_alloc();
+
+            while(brute_force->signal_count < *record_count && !stream_eof(brute_force->index)) {
+                const size_t offset = stream_tell(brute_force->index);
+                if(!infrared_brute_force_index_read_signal(
+                       brute_force->index, &header, signal_name))
+                    break;
+                if(furi_string_equal(signal_name, brute_force->current_record_name)) {
+                    brute_force->signal_offsets[brute_force->signal_count++] = offset;
+                }
+                if(!stream_seek(brute_force->index, header.body_size, StreamOffsetFromCurrent))
+                    break;
+            }
+
+            furi_string_free(signal_name);
+            success = (brute_force->signal_count > 0);
+        } else {
+            brute_force->ff = flipper_format_buffered_file_alloc(storage);
+            success = flipper_format_buffered_file_open_existing(
+                brute_force->ff, brute_force->db_filename);
+        }
+
         if(!success) infrared_brute_force_stop(brute_force);
     }
     return success;
@@ -119,19 +486,47 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
-    flipper_format_free(brute_force->ff);
+    if(brute_force->ff) flipper_format_free(brute_force->ff);
+    if(brute_force->index) stream_free(brute_force->index);
+    free(brute_force->signal_offsets);
     brute_force->current_signal = NULL;
     brute_force->ff = NULL;
+    brute_force->index = NULL;
+    brute_force->signal_offsets = NULL;
+    brute_force->signal_count = 0;
+    brute_force->signal_next = 0;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
 }
 
+static bool infrared_brute_force_index_read_next(InfraredBruteForce* brute_force) {
+    if(brute_force->signal_next >= brute_force->signal_count) return false;
+
+    const uint32_t offset = brute_force->signal_offsets[brute_force->signal_next++];
+    InfraredBruteForceIndexSignal header;
+    FuriString* signal_name = furi_string_alloc();
+
+    const bool success =
+        stream_seek(brute_force->index, offset, StreamOffsetFromStart) &&
+        infrared_brute_force_index_read_signal(brute_force->index, &header, signal_name) &&
+        infrared_brute_force_index_read_body(
+            brute_force->index, &header, brute_force->current_signal);
+
+    furi_string_free(signal_name);
+    return success;
+}
+
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
-    const bool success = infrared_signal_search_by_name_and_read(
-        brute_force->current_signal,
-        brute_force->ff,
-        furi_string_get_cstr(brute_force->current_record_name));
+    bool success;
+    if(brute_force->index) {
+        success = infrared_brute_force_index_read_next(brute_force);
+    } else {
+        success = infrared_signal_search_by_name_and_read(
+            brute_force->current_signal,
+            brute_force->ff,
+            furi_string_get_cstr(brute_force->current_record_name));
+    }
     if(success) {
         infrared_signal_transmit(brute_force->current_signal);
     }
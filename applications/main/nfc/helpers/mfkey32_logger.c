@@ -3,6 +3,7 @@
 #include <m-array.h>
 
 #include <nfc/helpers/nfc_util.h>
+#include <nfc/protocols/mf_classic/crypto1.h>
 #include <stream/stream.h>
 #include <stream/buffered_file_stream.h>
 
@@ -19,6 +20,8 @@ typedef struct {
     uint32_t nt1;
     uint32_t nr1;
     uint32_t ar1;
+    bool key_found;
+    uint64_t key;
 } Mfkey32LoggerParams;
 
 ARRAY_DEF(Mfkey32LoggerParams, Mfkey32LoggerParams, M_POD_OPLIST);
@@ -155,6 +158,45 @@ bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
     return params_saved;
 }
 
+size_t mfkey32_logger_check_dict(Mfkey32Logger* instance, KeysDict* dict) {
+    furi_assert(instance);
+    furi_assert(dict);
+
+    size_t keys_found = 0;
+    Crypto1Batch* batch = crypto1_batch_alloc();
+    uint64_t keys[CRYPTO1_BATCH_SIZE];
+    size_t keys_num = 0;
+
+    keys_dict_rewind(dict);
+    while((keys_num = keys_dict_get_next_keys(dict, keys, CRYPTO1_BATCH_SIZE)) > 0) {
+        Mfkey32LoggerParams_it_t it;
+        for(Mfkey32LoggerParams_it(it, instance->params_arr); !Mfkey32LoggerParams_end_p(it);
+            Mfkey32LoggerParams_next(it)) {
+            Mfkey32LoggerParams* params = Mfkey32LoggerParams_ref(it);
+            if(!params->is_filled || params->key_found) continue;
+
+            uint32_t candidates = crypto1_batch_check_reader_auth(
+                batch, keys, keys_num, params->cuid, params->nt0, params->nr0, params->ar0);
+            while(candidates) {
+                size_t i = __builtin_ctz(candidates);
+                candidates &= candidates - 1;
+                // Reader answer is only 32 bits, confirm candidate with second nonce pair
+                if(crypto1_batch_check_reader_auth(
+                       batch, &keys[i], 1, params->cuid, params->nt1, params->nr1, params->ar1)) {
+                    params->key_found = true;
+                    params->key = keys[i];
+                    keys_found++;
+                    break;
+                }
+            }
+        }
+    }
+
+    crypto1_batch_free(batch);
+
+    return keys_found;
+}
+
 void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str) {
     furi_assert(instance);
     furi_assert(str);
@@ -168,6 +210,11 @@ void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str) {
         if(!params->is_filled) continue;
 
         char key_char = params->key_type == MfClassicKeyTypeA ? 'A' : 'B';
-        furi_string_cat_printf(str, "Sector %d, key %c\n", params->sector_num, key_char);
+        if(params->key_found) {
+            furi_string_cat_printf(
+                str, "Sector %d, key %c: %012llX\n", params->sector_num, key_char, params->key);
+        } else {
+            furi_string_cat_printf(str, "Sector %d, key %c\n", params->sector_num, key_char);
+        }
     }
 }
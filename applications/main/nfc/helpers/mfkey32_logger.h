@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nfc/protocols/mf_classic/mf_classic.h>
+#include <toolbox/keys_dict.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,6 +19,15 @@ size_t mfkey32_logger_get_params_num(Mfkey32Logger* instance);
 
 bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path);
 
+/** Recover keys of collected nonce pairs that are present in dictionary
+ *
+ * @param instance  Mfkey32Logger instance
+ * @param dict      dictionary of MfClassicKey sized keys
+ *
+ * @return number of keys found
+ */
+size_t mfkey32_logger_check_dict(Mfkey32Logger* instance, KeysDict* dict);
+
 void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str);
 
 #ifdef __cplusplus
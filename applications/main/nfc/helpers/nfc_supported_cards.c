@@ -109,6 +109,8 @@ static const NfcSupportedCardsPlugin*
     do {
         if(instance->app) flipper_application_free(instance->app);
         instance->app = flipper_application_alloc(instance->storage, firmware_api_interface);
+        flipper_application_set_cache_enabled(
+            instance->app, flipper_application_is_cache_allowed(instance->storage));
         if(flipper_application_preload(instance->app, furi_string_get_cstr(path)) !=
            FlipperApplicationPreloadStatusSuccess)
             break;
@@ -82,6 +82,7 @@ typedef enum {
 
 typedef struct {
     KeysDict* dict;
+    KeysDict* user_dict; // Indexed user dictionary, its keys are skipped in system dict phase
     uint8_t sectors_total;
     uint8_t sectors_read;
     uint8_t current_sector;
@@ -132,6 +133,8 @@ struct NfcApp {
     MfUltralightAuth* mf_ul_auth;
     NfcMfClassicDictAttackContext nfc_dict_context;
     Mfkey32Logger* mfkey32_logger;
+    FuriThread* mfkey32_dict_thread;
+    bool mfkey32_dict_checked;
     MfUserDict* mf_user_dict;
     MfClassicKeyCache* mfc_key_cache;
     NfcSupportedCards* nfc_supported_cards;
@@ -69,6 +69,7 @@ void nfc_scene_mf_classic_detect_reader_on_enter(void* context) {
     uint32_t cuid = iso14443_3a_get_cuid(iso3_data);
 
     instance->mfkey32_logger = mfkey32_logger_alloc(cuid);
+    instance->mfkey32_dict_checked = false;
     instance->timer =
         furi_timer_alloc(nfc_scene_mf_classic_timer_callback, FuriTimerTypeOnce, instance);
 
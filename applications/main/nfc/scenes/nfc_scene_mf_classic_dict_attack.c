@@ -10,6 +10,24 @@ typedef enum {
     DictAttackStateSystemDictInProgress,
 } DictAttackState;
 
+static bool
+    nfc_dict_attack_get_next_key(NfcMfClassicDictAttackContext* context, MfClassicKey* key) {
+    bool key_found = false;
+
+    while(keys_dict_get_next_key(context->dict, key->data, sizeof(MfClassicKey))) {
+        context->dict_keys_current++;
+        // User dictionary keys were already tried on every sector
+        if(context->user_dict &&
+           keys_dict_is_key_present(context->user_dict, key->data, sizeof(MfClassicKey))) {
+            continue;
+        }
+        key_found = true;
+        break;
+    }
+
+    return key_found;
+}
+
 NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context) {
     furi_assert(context);
     furi_assert(event.event_data);
@@ -41,11 +59,9 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
         MfClassicKey key = {};
-        if(keys_dict_get_next_key(
-               instance->nfc_dict_context.dict, key.data, sizeof(MfClassicKey))) {
+        if(nfc_dict_attack_get_next_key(&instance->nfc_dict_context, &key)) {
             mfc_event->data->key_request_data.key = key;
             mfc_event->data->key_request_data.key_provided = true;
-            instance->nfc_dict_context.dict_keys_current++;
             if(instance->nfc_dict_context.dict_keys_current % 10 == 0) {
                 view_dispatcher_send_custom_event(
                     instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
@@ -196,7 +212,12 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
             if(state == DictAttackStateUserDictInProgress) {
                 nfc_poller_stop(instance->poller);
                 nfc_poller_free(instance->poller);
-                keys_dict_free(instance->nfc_dict_context.dict);
+                // Keep user dictionary to skip its keys in system dictionary
+                if(keys_dict_build_index(instance->nfc_dict_context.dict)) {
+                    instance->nfc_dict_context.user_dict = instance->nfc_dict_context.dict;
+                } else {
+                    keys_dict_free(instance->nfc_dict_context.dict);
+                }
                 scene_manager_set_scene_state(
                     instance->scene_manager,
                     NfcSceneMfClassicDictAttack,
@@ -265,6 +286,10 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
         instance->scene_manager, NfcSceneMfClassicDictAttack, DictAttackStateUserDictInProgress);
 
     keys_dict_free(instance->nfc_dict_context.dict);
+    if(instance->nfc_dict_context.user_dict) {
+        keys_dict_free(instance->nfc_dict_context.user_dict);
+        instance->nfc_dict_context.user_dict = NULL;
+    }
 
     instance->nfc_dict_context.current_sector = 0;
     instance->nfc_dict_context.sectors_total = 0;
@@ -11,9 +11,35 @@ void nfc_scene_mf_classic_mfkey_nonces_info_callback(
     }
 }
 
-void nfc_scene_mf_classic_mfkey_nonces_info_on_enter(void* context) {
+static void nfc_scene_mf_classic_mfkey_nonces_info_check_dict(NfcApp* instance, const char* path) {
+    if(!keys_dict_check_presence(path)) return;
+
+    KeysDict* dict = keys_dict_alloc(path, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mfkey32_logger_check_dict(instance->mfkey32_logger, dict);
+    keys_dict_free(dict);
+}
+
+static int32_t nfc_scene_mf_classic_mfkey_nonces_info_dict_worker(void* context) {
     NfcApp* instance = context;
 
+    nfc_scene_mf_classic_mfkey_nonces_info_check_dict(instance, NFC_APP_MF_CLASSIC_DICT_USER_PATH);
+    nfc_scene_mf_classic_mfkey_nonces_info_check_dict(
+        instance, NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH);
+    view_dispatcher_send_custom_event(instance->view_dispatcher, NfcCustomEventWorkerExit);
+
+    return 0;
+}
+
+static void nfc_scene_mf_classic_mfkey_nonces_info_stop_dict_worker(NfcApp* instance) {
+    if(instance->mfkey32_dict_thread) {
+        furi_thread_join(instance->mfkey32_dict_thread);
+        furi_thread_free(instance->mfkey32_dict_thread);
+        instance->mfkey32_dict_thread = NULL;
+        nfc_show_loading_popup(instance, false);
+    }
+}
+
+static void nfc_scene_mf_classic_mfkey_nonces_info_show(NfcApp* instance) {
     FuriString* temp_str = furi_string_alloc();
 
     size_t mfkey_params_saved = mfkey32_logger_get_params_num(instance->mfkey32_logger);
@@ -38,12 +64,34 @@ void nfc_scene_mf_classic_mfkey_nonces_info_on_enter(void* context) {
     view_dispatcher_switch_to_view(instance->view_dispatcher, NfcViewWidget);
 }
 
+void nfc_scene_mf_classic_mfkey_nonces_info_on_enter(void* context) {
+    NfcApp* instance = context;
+
+    if(instance->mfkey32_dict_checked) {
+        nfc_scene_mf_classic_mfkey_nonces_info_show(instance);
+    } else {
+        // Dictionary scan takes a while, keep GUI responsive and do it only once
+        nfc_show_loading_popup(instance, true);
+        instance->mfkey32_dict_thread = furi_thread_alloc_ex(
+            "NfcMfkeyDictWorker",
+            2048,
+            nfc_scene_mf_classic_mfkey_nonces_info_dict_worker,
+            instance);
+        furi_thread_start(instance->mfkey32_dict_thread);
+    }
+}
+
 bool nfc_scene_mf_classic_mfkey_nonces_info_on_event(void* context, SceneManagerEvent event) {
     NfcApp* instance = context;
     bool consumed = false;
 
     if(event.type == SceneManagerEventTypeCustom) {
-        if(event.event == GuiButtonTypeCenter) {
+        if(event.event == NfcCustomEventWorkerExit) {
+            nfc_scene_mf_classic_mfkey_nonces_info_stop_dict_worker(instance);
+            instance->mfkey32_dict_checked = true;
+            nfc_scene_mf_classic_mfkey_nonces_info_show(instance);
+            consumed = true;
+        } else if(event.event == GuiButtonTypeCenter) {
             if(mfkey32_logger_save_params(
                    instance->mfkey32_logger, NFC_APP_MFKEY32_LOGS_FILE_PATH)) {
                 scene_manager_next_scene(instance->scene_manager, NfcSceneMfClassicMfkeyComplete);
@@ -65,6 +113,7 @@ bool nfc_scene_mf_classic_mfkey_nonces_info_on_event(void* context, SceneManager
 void nfc_scene_mf_classic_mfkey_nonces_info_on_exit(void* context) {
     NfcApp* instance = context;
 
+    nfc_scene_mf_classic_mfkey_nonces_info_stop_dict_worker(instance);
     mfkey32_logger_free(instance->mfkey32_logger);
 
     // Clear view
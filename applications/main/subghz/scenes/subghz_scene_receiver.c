@@ -219,11 +219,12 @@ static void subghz_scene_add_to_history_callback(
                     furi_string_printf(path, "%s/%s%s", dir, file, ext);
                     furi_record_close(RECORD_STORAGE);
                     free(dir);
-                    // Save
-                    subghz_save_protocol_to_file(
-                        subghz,
-                        subghz_history_get_raw_data(history, idx),
-                        furi_string_get_cstr(path));
+                    // Save, this runs on worker thread so shared raw data can't be used
+                    FlipperFormat* raw_data = flipper_format_string_alloc();
+                    if(subghz_history_load_raw_data(history, idx, raw_data)) {
+                        subghz_save_protocol_to_file(subghz, raw_data, furi_string_get_cstr(path));
+                    }
+                    flipper_format_free(raw_data);
                     furi_string_free(path);
                 }
 
@@ -416,17 +417,18 @@ bool subghz_scene_receiver_on_event(void* context, SceneManagerEvent event) {
             subghz_txrx_stop(subghz->txrx);
             subghz_txrx_hopper_pause(subghz->txrx);
 
-            FlipperFormat* key_repeat_data = subghz_history_get_raw_data(
-                subghz->history, subghz_history_get_last_index(subghz->history) - 1);
+            const uint16_t last_index = subghz_history_get_last_index(subghz->history) - 1;
+            FlipperFormat* key_repeat_data =
+                subghz_history_get_raw_data(subghz->history, last_index);
 
-            uint32_t tmpTe = 300;
-            if(!flipper_format_rewind(key_repeat_data)) {
-                FURI_LOG_E(TAG, "Rewind error");
-            } else if(!flipper_format_read_uint32(key_repeat_data, "TE", (uint32_t*)&tmpTe, 1)) {
+            uint32_t tmpTe = subghz_history_get_te(subghz->history, last_index);
+            if(!tmpTe) {
                 FURI_LOG_E(TAG, "Missing TE");
+                tmpTe = 300;
             }
 
-            if(subghz_txrx_tx_start(subghz->txrx, key_repeat_data) != SubGhzTxRxStartTxStateOk) {
+            if(!key_repeat_data ||
+               subghz_txrx_tx_start(subghz->txrx, key_repeat_data) != SubGhzTxRxStartTxStateOk) {
                 view_dispatcher_send_custom_event(
                     subghz->view_dispatcher, SubGhzCustomEventViewRepeaterStop);
             } else {
@@ -455,12 +457,10 @@ bool subghz_scene_receiver_on_event(void* context, SceneManagerEvent event) {
         case SubGhzCustomEventViewReceiverOKLong:
             subghz_txrx_stop(subghz->txrx);
             subghz_txrx_hopper_pause(subghz->txrx);
-            if(subghz_txrx_tx_start(
-                   subghz->txrx,
-                   subghz_history_get_raw_data(
-                       subghz->history,
-                       subghz_view_receiver_get_idx_menu(subghz->subghz_receiver))) !=
-               SubGhzTxRxStartTxStateOk) {
+            FlipperFormat* key_data = subghz_history_get_raw_data(
+                subghz->history, subghz_view_receiver_get_idx_menu(subghz->subghz_receiver));
+            if(!key_data ||
+               subghz_txrx_tx_start(subghz->txrx, key_data) != SubGhzTxRxStartTxStateOk) {
                 view_dispatcher_send_custom_event(
                     subghz->view_dispatcher, SubGhzCustomEventViewReceiverOKRelease);
             } else {
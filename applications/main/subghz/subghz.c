@@ -25,6 +25,7 @@ bool subghz_back_event_callback(void* context) {
 void subghz_tick_event_callback(void* context) {
     furi_assert(context);
     SubGhz* subghz = context;
+    if(subghz->history) subghz_history_spill(subghz->history);
     scene_manager_handle_tick_event(subghz->scene_manager);
 }
 
@@ -349,6 +349,7 @@ void subghz_cli_command_rx(Cli* cli, FuriString* args, void* context) {
 
     SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment);
     subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_prefilter(receiver, true);
     subghz_receiver_set_rx_callback(receiver, subghz_cli_command_rx_callback, instance);
 
     // Configure radio
@@ -394,6 +395,13 @@ void subghz_cli_command_rx(Cli* cli, FuriString* args, void* context) {
 
     printf("\r\nPackets received %zu\r\n", instance->packet_count);
 
+    SubGhzReceiverStats stats;
+    subghz_receiver_get_stats(receiver, &stats);
+    printf(
+        "Decoder feeds performed %llu, skipped %llu\r\n",
+        stats.feeds_performed,
+        stats.feeds_skipped);
+
     // Cleanup
     subghz_receiver_free(receiver);
     subghz_environment_free(environment);
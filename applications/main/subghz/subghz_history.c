@@ -1,146 +1,513 @@
 #include "subghz_history.h"
 #include <lib/subghz/receiver.h>
+#include <flipper_format/flipper_format_i.h>
+#include <storage/storage.h>
 #include <rpc/rpc.h>
 
 #include <furi.h>
 
 #define SUBGHZ_HISTORY_MAX 65535 // uint16_t index max, ram limit below
 #define SUBGHZ_HISTORY_FREE_HEAP (10240 * (3 - MIN(rpc_get_sessions_count(instance->rpc), 2U)))
+#define SUBGHZ_HISTORY_SPILL_HEAP (SUBGHZ_HISTORY_FREE_HEAP + 4 * SUBGHZ_HISTORY_BLOCK_SIZE)
+#define SUBGHZ_HISTORY_PAGE_RECORDS 32
+#define SUBGHZ_HISTORY_BLOCK_SIZE 2048
+#define SUBGHZ_HISTORY_INTERN_MAX UINT8_MAX
+#define SUBGHZ_HISTORY_SPILL_FOLDER EXT_PATH("subghz")
+#define SUBGHZ_HISTORY_SPILL_PATH SUBGHZ_HISTORY_SPILL_FOLDER "/.history.tmp"
 #define TAG "SubGhzHistory"
 
+/** Location of variable size data in an arena, or in the spill file */
+typedef struct {
+    uint32_t offset;
+    uint16_t size;
+} SubGhzHistoryRef;
+
+/** Fixed size record, variable size data is kept in arenas */
 typedef struct {
-    FuriString* item_str;
-    FlipperFormat* flipper_string;
-    uint8_t type;
-    SubGhzRadioPreset* preset;
-    FuriHalRtcDateTime datetime;
     uint32_t hash_data;
-    const SubGhzProtocol* protocol;
-    uint16_t repeats;
+    uint32_t frequency;
+    uint32_t te;
+    uint32_t timestamp;
     float latitude;
     float longitude;
-} SubGhzHistoryItem;
+    SubGhzHistoryRef label;
+    SubGhzHistoryRef data;
+    uint16_t repeats;
+    uint8_t protocol; /**< index of interned protocol */
+    uint8_t preset; /**< index of interned preset */
+    bool spilled; /**< data is in the spill file */
+} SubGhzHistoryRecord;
 
-ARRAY_DEF(SubGhzHistoryItemArray, SubGhzHistoryItem, M_POD_OPLIST)
+typedef struct {
+    SubGhzHistoryRecord records[SUBGHZ_HISTORY_PAGE_RECORDS];
+} SubGhzHistoryPage;
 
-#define M_OPL_SubGhzHistoryItemArray_t() ARRAY_OPLIST(SubGhzHistoryItemArray, M_POD_OPLIST)
+typedef struct {
+    uint16_t live; /**< number of references to this block */
+    uint8_t data[SUBGHZ_HISTORY_BLOCK_SIZE];
+} SubGhzHistoryBlock;
 
 typedef struct {
-    SubGhzHistoryItemArray_t data;
-} SubGhzHistoryStruct;
+    FuriString* name;
+    uint8_t* data;
+    size_t data_size;
+} SubGhzHistoryPreset;
+
+ARRAY_DEF(SubGhzHistoryPageArray, SubGhzHistoryPage*, M_PTR_OPLIST)
+ARRAY_DEF(SubGhzHistoryBlockArray, SubGhzHistoryBlock*, M_PTR_OPLIST)
+ARRAY_DEF(SubGhzHistoryProtocolArray, const SubGhzProtocol*, M_PTR_OPLIST)
+ARRAY_DEF(SubGhzHistoryPresetArray, SubGhzHistoryPreset, M_POD_OPLIST)
+
+/** Append only storage, a block is freed once nothing references it */
+typedef struct {
+    SubGhzHistoryBlockArray_t blocks; /**< blocks[i] holds offset (base + i) * BLOCK_SIZE */
+    uint32_t base;
+    uint32_t head; /**< next write offset */
+} SubGhzHistoryArena;
 
 struct SubGhzHistory {
     uint32_t last_update_timestamp;
     uint16_t last_index_write;
+    uint16_t first_in_ram; /**< records before this index are spilled */
     uint32_t code_last_hash_data;
     FuriString* tmp_string;
-    SubGhzHistoryStruct* history;
+    SubGhzHistoryPageArray_t pages;
+    SubGhzHistoryArena labels;
+    SubGhzHistoryArena data;
+    SubGhzHistoryProtocolArray_t protocols;
+    SubGhzHistoryPresetArray_t presets;
+    FlipperFormat* scratch; /**< serialization buffer of add_to_history */
+    FlipperFormat* raw_data; /**< data of the last requested record */
+    SubGhzRadioPreset radio_preset; /**< preset of the last requested record */
+    Storage* storage;
+    File* spill_file;
+    uint32_t spill_size;
     Rpc* rpc;
+    FuriMutex* mutex; /**< records are added from the worker thread */
 };
 
+/******************* Arena *******************/
+
+static void subghz_history_arena_init(SubGhzHistoryArena* arena) {
+    SubGhzHistoryBlockArray_init(arena->blocks);
+    arena->base = 0;
+    arena->head = 0;
+}
+
+static void subghz_history_arena_reset(SubGhzHistoryArena* arena) {
+    for
+        M_EACH(block, arena->blocks, SubGhzHistoryBlockArray_t) {
+            free(*block);
+        }
+    SubGhzHistoryBlockArray_reset(arena->blocks);
+    arena->base = 0;
+    arena->head = 0;
+}
+
+static void subghz_history_arena_clear(SubGhzHistoryArena* arena) {
+    subghz_history_arena_reset(arena);
+    SubGhzHistoryBlockArray_clear(arena->blocks);
+}
+
+/** Get block holding offset and length of contiguous data in it, up to size */
+static SubGhzHistoryBlock* subghz_history_arena_segment(
+    SubGhzHistoryArena* arena,
+    uint32_t offset,
+    size_t size,
+    uint8_t** ptr,
+    size_t* length) {
+    const size_t index = offset / SUBGHZ_HISTORY_BLOCK_SIZE - arena->base;
+    const size_t in_block = offset % SUBGHZ_HISTORY_BLOCK_SIZE;
+
+    if(index == SubGhzHistoryBlockArray_size(arena->blocks)) {
+        SubGhzHistoryBlock* block = malloc(sizeof(SubGhzHistoryBlock));
+        block->live = 0;
+        SubGhzHistoryBlockArray_push_back(arena->blocks, block);
+    }
+
+    SubGhzHistoryBlock* block = *SubGhzHistoryBlockArray_get(arena->blocks, index);
+    furi_check(block);
+    *ptr = block->data + in_block;
+    *length = MIN(size, SUBGHZ_HISTORY_BLOCK_SIZE - in_block);
+    return block;
+}
+
+/** Free unreferenced blocks, except for the one being written */
+static void subghz_history_arena_collect(SubGhzHistoryArena* arena) {
+    const size_t head_index = arena->head / SUBGHZ_HISTORY_BLOCK_SIZE - arena->base;
+    const size_t count = MIN(head_index, SubGhzHistoryBlockArray_size(arena->blocks));
+    for(size_t i = 0; i < count; i++) {
+        SubGhzHistoryBlock** block = SubGhzHistoryBlockArray_get(arena->blocks, i);
+        if(*block && !(*block)->live) {
+            free(*block);
+            *block = NULL;
+        }
+    }
+
+    size_t unused = 0;
+    while(unused < SubGhzHistoryBlockArray_size(arena->blocks) &&
+          !*SubGhzHistoryBlockArray_get(arena->blocks, unused)) {
+        unused++;
+    }
+    SubGhzHistoryBlockArray_remove_v(arena->blocks, 0, unused);
+    arena->base += unused;
+}
+
+/** Append data to ref, which must be the last one written to the arena */
+static void subghz_history_arena_append(
+    SubGhzHistoryArena* arena,
+    SubGhzHistoryRef* ref,
+    const uint8_t* data,
+    size_t size) {
+    furi_check(ref->offset + ref->size == arena->head);
+    while(size) {
+        uint8_t* ptr;
+        size_t length;
+        SubGhzHistoryBlock* block =
+            subghz_history_arena_segment(arena, arena->head, size, &ptr, &length);
+        // Each block referenced by ref is counted once
+        if(!ref->size || arena->head % SUBGHZ_HISTORY_BLOCK_SIZE == 0) {
+            block->live++;
+        }
+        memcpy(ptr, data, length);
+        arena->head += length;
+        ref->size += length;
+        data += length;
+        size -= length;
+    }
+}
+
+static void
+    subghz_history_arena_get(SubGhzHistoryArena* arena, SubGhzHistoryRef ref, Stream* stream) {
+    while(ref.size) {
+        uint8_t* ptr;
+        size_t length;
+        subghz_history_arena_segment(arena, ref.offset, ref.size, &ptr, &length);
+        stream_write(stream, ptr, length);
+        ref.offset += length;
+        ref.size -= length;
+    }
+}
+
+static void subghz_history_arena_release(SubGhzHistoryArena* arena, SubGhzHistoryRef ref) {
+    while(ref.size) {
+        uint8_t* ptr;
+        size_t length;
+        SubGhzHistoryBlock* block =
+            subghz_history_arena_segment(arena, ref.offset, ref.size, &ptr, &length);
+        block->live--;
+        ref.offset += length;
+        ref.size -= length;
+    }
+    subghz_history_arena_collect(arena);
+}
+
+/******************* Records *******************/
+
+static void subghz_history_lock(SubGhzHistory* instance) {
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+}
+
+static void subghz_history_unlock(SubGhzHistory* instance) {
+    furi_check(furi_mutex_release(instance->mutex) == FuriStatusOk);
+}
+
+/** Must be called with lock held, record is valid until it's released */
+static SubGhzHistoryRecord* subghz_history_get_record(SubGhzHistory* instance, uint16_t idx) {
+    furi_check(idx < instance->last_index_write);
+    SubGhzHistoryPage* page =
+        *SubGhzHistoryPageArray_get(instance->pages, idx / SUBGHZ_HISTORY_PAGE_RECORDS);
+    return &page->records[idx % SUBGHZ_HISTORY_PAGE_RECORDS];
+}
+
+static SubGhzHistoryRecord* subghz_history_push_record(SubGhzHistory* instance) {
+    if(instance->last_index_write % SUBGHZ_HISTORY_PAGE_RECORDS == 0) {
+        SubGhzHistoryPageArray_push_back(instance->pages, malloc(sizeof(SubGhzHistoryPage)));
+    }
+    instance->last_index_write++;
+    return subghz_history_get_record(instance, instance->last_index_write - 1);
+}
+
+static void subghz_history_release_record(SubGhzHistory* instance, SubGhzHistoryRecord* record) {
+    subghz_history_arena_release(&instance->labels, record->label);
+    if(!record->spilled) {
+        subghz_history_arena_release(&instance->data, record->data);
+    }
+}
+
+static uint8_t
+    subghz_history_intern_protocol(SubGhzHistory* instance, const SubGhzProtocol* protocol) {
+    size_t index = 0;
+    for
+        M_EACH(item, instance->protocols, SubGhzHistoryProtocolArray_t) {
+            if(*item == protocol) return index;
+            index++;
+        }
+    if(index == SUBGHZ_HISTORY_INTERN_MAX) return index;
+    SubGhzHistoryProtocolArray_push_back(instance->protocols, protocol);
+    return index;
+}
+
+static uint8_t subghz_history_intern_preset(SubGhzHistory* instance, SubGhzRadioPreset* preset) {
+    size_t index = 0;
+    for
+        M_EACH(item, instance->presets, SubGhzHistoryPresetArray_t) {
+            if(item->data == preset->data && item->data_size == preset->data_size &&
+               furi_string_equal(item->name, preset->name)) {
+                return index;
+            }
+            index++;
+        }
+    if(index == SUBGHZ_HISTORY_INTERN_MAX) return index;
+    SubGhzHistoryPreset* item = SubGhzHistoryPresetArray_push_raw(instance->presets);
+    item->name = furi_string_alloc_set(preset->name);
+    item->data = preset->data;
+    item->data_size = preset->data_size;
+    return index;
+}
+
+static void subghz_history_clear_presets(SubGhzHistory* instance) {
+    for
+        M_EACH(item, instance->presets, SubGhzHistoryPresetArray_t) {
+            furi_string_free(item->name);
+        }
+    SubGhzHistoryPresetArray_reset(instance->presets);
+}
+
+/******************* Spill *******************/
+
+/** Move data of the oldest record kept in RAM to the SD card */
+static bool subghz_history_spill_oldest(SubGhzHistory* instance) {
+    if(instance->first_in_ram >= instance->last_index_write) return false;
+
+    if(!instance->spill_file) {
+        if(storage_sd_status(instance->storage) != FSE_OK) return false;
+        storage_simply_mkdir(instance->storage, SUBGHZ_HISTORY_SPILL_FOLDER);
+        instance->spill_file = storage_file_alloc(instance->storage);
+        if(!storage_file_open(
+               instance->spill_file,
+               SUBGHZ_HISTORY_SPILL_PATH,
+               FSAM_READ_WRITE,
+               FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Failed to open spill file");
+            storage_file_free(instance->spill_file);
+            instance->spill_file = NULL;
+            return false;
+        }
+        instance->spill_size = 0;
+    }
+
+    SubGhzHistoryRecord* record = subghz_history_get_record(instance, instance->first_in_ram);
+    if(!storage_file_seek(instance->spill_file, instance->spill_size, true)) return false;
+
+    SubGhzHistoryRef ref = record->data;
+    while(ref.size) {
+        uint8_t* ptr;
+        size_t length;
+        subghz_history_arena_segment(&instance->data, ref.offset, ref.size, &ptr, &length);
+        if(storage_file_write(instance->spill_file, ptr, length) != length) {
+            FURI_LOG_E(TAG, "Failed to write spill file");
+            return false;
+        }
+        ref.offset += length;
+        ref.size -= length;
+    }
+
+    subghz_history_arena_release(&instance->data, record->data);
+    record->data.offset = instance->spill_size;
+    record->spilled = true;
+    instance->spill_size += record->data.size;
+    instance->first_in_ram++;
+    return true;
+}
+
+static bool subghz_history_load_spilled(
+    SubGhzHistory* instance,
+    SubGhzHistoryRecord* record,
+    Stream* stream) {
+    uint8_t buffer[64];
+    size_t left = record->data.size;
+
+    if(!storage_file_seek(instance->spill_file, record->data.offset, true)) return false;
+    while(left) {
+        const size_t length = MIN(left, sizeof(buffer));
+        if(storage_file_read(instance->spill_file, buffer, length) != length) return false;
+        stream_write(stream, buffer, length);
+        left -= length;
+    }
+    return true;
+}
+
+static void subghz_history_close_spill(SubGhzHistory* instance) {
+    if(instance->spill_file) {
+        storage_file_close(instance->spill_file);
+        storage_file_free(instance->spill_file);
+        instance->spill_file = NULL;
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_SPILL_PATH);
+    }
+    instance->spill_size = 0;
+    instance->first_in_ram = 0;
+}
+
+/******************* API *******************/
+
 SubGhzHistory* subghz_history_alloc(void) {
     SubGhzHistory* instance = malloc(sizeof(SubGhzHistory));
     instance->tmp_string = furi_string_alloc();
-    instance->history = malloc(sizeof(SubGhzHistoryStruct));
-    SubGhzHistoryItemArray_init(instance->history->data);
+    SubGhzHistoryPageArray_init(instance->pages);
+    subghz_history_arena_init(&instance->labels);
+    subghz_history_arena_init(&instance->data);
+    SubGhzHistoryProtocolArray_init(instance->protocols);
+    SubGhzHistoryPresetArray_init(instance->presets);
+    instance->scratch = flipper_format_string_alloc();
+    instance->raw_data = flipper_format_string_alloc();
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeRecursive);
+    instance->storage = furi_record_open(RECORD_STORAGE);
     instance->rpc = furi_record_open(RECORD_RPC);
     return instance;
 }
 
 void subghz_history_free(SubGhzHistory* instance) {
     furi_assert(instance);
+    subghz_history_reset(instance);
     furi_string_free(instance->tmp_string);
-    for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
-        }
-    SubGhzHistoryItemArray_clear(instance->history->data);
-    free(instance->history);
+    SubGhzHistoryPageArray_clear(instance->pages);
+    subghz_history_arena_clear(&instance->labels);
+    subghz_history_arena_clear(&instance->data);
+    SubGhzHistoryProtocolArray_clear(instance->protocols);
+    SubGhzHistoryPresetArray_clear(instance->presets);
+    flipper_format_free(instance->scratch);
+    flipper_format_free(instance->raw_data);
+    furi_mutex_free(instance->mutex);
+    furi_record_close(RECORD_STORAGE);
     furi_record_close(RECORD_RPC);
     free(instance);
 }
 
 uint32_t subghz_history_get_hash_data(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->hash_data;
+    subghz_history_lock(instance);
+    uint32_t hash_data = subghz_history_get_record(instance, idx)->hash_data;
+    subghz_history_unlock(instance);
+    return hash_data;
 }
 
 const SubGhzProtocol* subghz_history_get_protocol(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->protocol;
+    subghz_history_lock(instance);
+    SubGhzHistoryRecord* record = subghz_history_get_record(instance, idx);
+    const SubGhzProtocol* protocol =
+        *SubGhzHistoryProtocolArray_get(instance->protocols, record->protocol);
+    subghz_history_unlock(instance);
+    return protocol;
 }
 
 uint16_t subghz_history_get_repeats(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->repeats;
+    subghz_history_lock(instance);
+    uint16_t repeats = subghz_history_get_record(instance, idx)->repeats;
+    subghz_history_unlock(instance);
+    return repeats;
 }
 
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset->frequency;
+    subghz_history_lock(instance);
+    uint32_t frequency = subghz_history_get_record(instance, idx)->frequency;
+    subghz_history_unlock(instance);
+    return frequency;
+}
+
+uint32_t subghz_history_get_te(SubGhzHistory* instance, uint16_t idx) {
+    furi_assert(instance);
+    subghz_history_lock(instance);
+    uint32_t te = subghz_history_get_record(instance, idx)->te;
+    subghz_history_unlock(instance);
+    return te;
 }
 
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset;
+    subghz_history_lock(instance);
+    SubGhzHistoryRecord* record = subghz_history_get_record(instance, idx);
+    SubGhzHistoryPreset* preset = SubGhzHistoryPresetArray_get(instance->presets, record->preset);
+    instance->radio_preset.name = preset->name;
+    instance->radio_preset.frequency = record->frequency;
+    instance->radio_preset.data = preset->data;
+    instance->radio_preset.data_size = preset->data_size;
+    instance->radio_preset.latitude = record->latitude;
+    instance->radio_preset.longitude = record->longitude;
+    subghz_history_unlock(instance);
+    return &instance->radio_preset;
 }
 
 const char* subghz_history_get_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return furi_string_get_cstr(item->preset->name);
+    subghz_history_lock(instance);
+    SubGhzHistoryRecord* record = subghz_history_get_record(instance, idx);
+    // Name string is allocated separately, so it outlives reallocation of presets
+    const char* name = furi_string_get_cstr(
+        SubGhzHistoryPresetArray_get(instance->presets, record->preset)->name);
+    subghz_history_unlock(instance);
+    return name;
 }
 
 float subghz_history_get_latitude(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->latitude;
+    subghz_history_lock(instance);
+    float latitude = subghz_history_get_record(instance, idx)->latitude;
+    subghz_history_unlock(instance);
+    return latitude;
 }
 
 float subghz_history_get_longitude(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->longitude;
+    subghz_history_lock(instance);
+    float longitude = subghz_history_get_record(instance, idx)->longitude;
+    subghz_history_unlock(instance);
+    return longitude;
 }
 
 void subghz_history_reset(SubGhzHistory* instance) {
     furi_assert(instance);
+    subghz_history_lock(instance);
     furi_string_reset(instance->tmp_string);
     for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
+        M_EACH(page, instance->pages, SubGhzHistoryPageArray_t) {
+            free(*page);
         }
-    SubGhzHistoryItemArray_reset(instance->history->data);
+    SubGhzHistoryPageArray_reset(instance->pages);
+    subghz_history_arena_reset(&instance->labels);
+    subghz_history_arena_reset(&instance->data);
+    SubGhzHistoryProtocolArray_reset(instance->protocols);
+    subghz_history_clear_presets(instance);
+    subghz_history_close_spill(instance);
     instance->last_index_write = 0;
     instance->code_last_hash_data = 0;
+    subghz_history_unlock(instance);
 }
 
 void subghz_history_delete_item(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
+    subghz_history_lock(instance);
+
+    if(idx < instance->last_index_write) {
+        subghz_history_release_record(instance, subghz_history_get_record(instance, idx));
+        for(uint16_t i = idx; i + 1 < instance->last_index_write; i++) {
+            *subghz_history_get_record(instance, i) = *subghz_history_get_record(instance, i + 1);
+        }
+        if(idx < instance->first_in_ram) {
+            instance->first_in_ram--;
+        }
 
-    if(idx < SubGhzHistoryItemArray_size(instance->history->data)) {
-        SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-        furi_string_free(item->item_str);
-        furi_string_free(item->preset->name);
-        free(item->preset);
-        flipper_format_free(item->flipper_string);
-        item->type = 0;
-        SubGhzHistoryItemArray_remove_v(instance->history->data, idx, idx + 1);
         instance->last_index_write--;
+        if(instance->last_index_write % SUBGHZ_HISTORY_PAGE_RECORDS == 0) {
+            SubGhzHistoryPage* page;
+            SubGhzHistoryPageArray_pop_back(&page, instance->pages);
+            free(page);
+        }
     }
+    subghz_history_unlock(instance);
 }
 
 uint16_t subghz_history_get_item(SubGhzHistory* instance) {
@@ -150,45 +517,56 @@ uint16_t subghz_history_get_item(SubGhzHistory* instance) {
 
 uint8_t subghz_history_get_type_protocol(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->type;
+    return subghz_history_get_protocol(instance, idx)->type;
 }
 
 const char* subghz_history_get_protocol_name(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(!item || !item->flipper_string) {
-        FURI_LOG_E(TAG, "Missing Item");
-        furi_string_reset(instance->tmp_string);
-        return furi_string_get_cstr(instance->tmp_string);
-    }
-    flipper_format_rewind(item->flipper_string);
-    if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-        FURI_LOG_E(TAG, "Missing Protocol");
-        furi_string_reset(instance->tmp_string);
-    }
-    return furi_string_get_cstr(instance->tmp_string);
+    return subghz_history_get_protocol(instance, idx)->name;
 }
 
 FuriHalRtcDateTime subghz_history_get_datetime(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(item) {
-        return item->datetime;
+    subghz_history_lock(instance);
+    const uint32_t timestamp = subghz_history_get_record(instance, idx)->timestamp;
+    subghz_history_unlock(instance);
+    FuriHalRtcDateTime datetime;
+    furi_hal_rtc_timestamp_to_datetime(timestamp, &datetime);
+    return datetime;
+}
+
+bool subghz_history_load_raw_data(
+    SubGhzHistory* instance,
+    uint16_t idx,
+    FlipperFormat* flipper_format) {
+    furi_assert(instance);
+    furi_assert(flipper_format);
+    bool result = true;
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    stream_clean(stream);
+
+    subghz_history_lock(instance);
+    SubGhzHistoryRecord* record = subghz_history_get_record(instance, idx);
+    if(record->spilled) {
+        if(!subghz_history_load_spilled(instance, record, stream)) {
+            FURI_LOG_E(TAG, "Failed to read spill file");
+            result = false;
+        }
     } else {
-        return (FuriHalRtcDateTime){};
+        subghz_history_arena_get(&instance->data, record->data, stream);
     }
+    subghz_history_unlock(instance);
+
+    flipper_format_rewind(flipper_format);
+    return result;
 }
 
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(item->flipper_string) {
-        return item->flipper_string;
-    } else {
-        return NULL;
-    }
+    if(!subghz_history_load_raw_data(instance, idx, instance->raw_data)) return NULL;
+    return instance->raw_data;
 }
+
 bool subghz_history_get_text_space_left(
     SubGhzHistory* instance,
     FuriString* output,
@@ -196,14 +574,14 @@ bool subghz_history_get_text_space_left(
     bool ignore_full) {
     furi_assert(instance);
     if(!ignore_full) {
-        if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) {
-            if(output != NULL) furi_string_printf(output, "    Memory is FULL");
-            return true;
-        }
         if(instance->last_index_write == SUBGHZ_HISTORY_MAX) {
             if(output != NULL) furi_string_printf(output, "     History is FULL");
             return true;
         }
+        if(subghz_history_full(instance)) {
+            if(output != NULL) furi_string_printf(output, "    Memory is FULL");
+            return true;
+        }
     }
     if(output != NULL) {
         if(sats == 0) {
@@ -227,98 +605,70 @@ uint16_t subghz_history_get_last_index(SubGhzHistory* instance) {
     return instance->last_index_write;
 }
 void subghz_history_get_text_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    furi_string_set(output, item->item_str);
+    subghz_history_lock(instance);
+    SubGhzHistoryRef ref = subghz_history_get_record(instance, idx)->label;
+    furi_string_reset(output);
+    while(ref.size) {
+        uint8_t* ptr;
+        size_t length;
+        subghz_history_arena_segment(&instance->labels, ref.offset, ref.size, &ptr, &length);
+        furi_string_cat_printf(output, "%.*s", (int)length, (const char*)ptr);
+        ref.offset += length;
+        ref.size -= length;
+    }
+    subghz_history_unlock(instance);
 }
 
 void subghz_history_get_time_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    FuriHalRtcDateTime* t = &item->datetime;
-    furi_string_printf(output, "%.2d:%.2d:%.2d ", t->hour, t->minute, t->second);
+    FuriHalRtcDateTime t = subghz_history_get_datetime(instance, idx);
+    furi_string_printf(output, "%.2d:%.2d:%.2d ", t.hour, t.minute, t.second);
 }
 
-bool subghz_history_add_to_history(
-    SubGhzHistory* instance,
-    void* context,
-    SubGhzRadioPreset* preset) {
-    furi_assert(instance);
-    furi_assert(context);
-
-    if(subghz_history_full(instance)) return false;
-
-    SubGhzProtocolDecoderBase* decoder_base = context;
-    uint32_t hash_data = subghz_protocol_decoder_base_get_hash_data_long(decoder_base);
-    if((instance->code_last_hash_data == hash_data) &&
-       ((furi_get_tick() - instance->last_update_timestamp) < 500)) {
-        instance->last_update_timestamp = furi_get_tick();
-        return false;
+static uint32_t subghz_history_read_uint32(FlipperFormat* flipper_format, const char* key) {
+    uint32_t value = 0;
+    if(!flipper_format_rewind(flipper_format) ||
+       !flipper_format_read_uint32(flipper_format, key, &value, 1)) {
+        value = 0;
     }
+    return value;
+}
 
-    uint16_t repeats = 0;
-    SubGhzHistoryItemArray_it_t it;
-    SubGhzHistoryItemArray_it_last(it, instance->history->data);
-    while(!SubGhzHistoryItemArray_end_p(it)) {
-        SubGhzHistoryItem* search = SubGhzHistoryItemArray_ref(it);
-        if(search->hash_data == hash_data && search->protocol == decoder_base->protocol) {
-            repeats = search->repeats + 1;
-            break;
-        }
-        SubGhzHistoryItemArray_previous(it);
-    }
-
-    instance->code_last_hash_data = hash_data;
-    instance->last_update_timestamp = furi_get_tick();
-
+static void subghz_history_format_label(
+    SubGhzHistory* instance,
+    FlipperFormat* flipper_format,
+    FuriString* label) {
     FuriString* text = furi_string_alloc();
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_push_raw(instance->history->data);
-    item->preset = malloc(sizeof(SubGhzRadioPreset));
-    item->type = decoder_base->protocol->type;
-    item->preset->frequency = preset->frequency;
-    item->preset->name = furi_string_alloc();
-    furi_string_set(item->preset->name, preset->name);
-    item->preset->data = preset->data;
-    item->preset->data_size = preset->data_size;
-    furi_hal_rtc_get_datetime(&item->datetime);
-    item->hash_data = hash_data;
-    item->protocol = decoder_base->protocol;
-    item->repeats = repeats;
-    item->latitude = preset->latitude;
-    item->longitude = preset->longitude;
-
-    item->item_str = furi_string_alloc();
-    item->flipper_string = flipper_format_string_alloc();
-    subghz_protocol_decoder_base_serialize(decoder_base, item->flipper_string, preset);
 
     do {
-        if(!flipper_format_rewind(item->flipper_string)) {
+        if(!flipper_format_rewind(flipper_format)) {
             FURI_LOG_E(TAG, "Rewind error");
             break;
         }
-        if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
+        if(!flipper_format_read_string(flipper_format, "Protocol", instance->tmp_string)) {
             FURI_LOG_E(TAG, "Missing Protocol");
             break;
         }
         if(!strcmp(furi_string_get_cstr(instance->tmp_string), "KeeLoq")) {
             furi_string_set(instance->tmp_string, "KL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
+            if(!flipper_format_read_string(flipper_format, "Manufacture", text)) {
                 FURI_LOG_E(TAG, "Missing Protocol");
                 break;
             }
             furi_string_cat(instance->tmp_string, text);
         } else if(!strcmp(furi_string_get_cstr(instance->tmp_string), "Star Line")) {
             furi_string_set(instance->tmp_string, "SL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
+            if(!flipper_format_read_string(flipper_format, "Manufacture", text)) {
                 FURI_LOG_E(TAG, "Missing Protocol");
                 break;
             }
             furi_string_cat(instance->tmp_string, text);
         }
-        if(!flipper_format_rewind(item->flipper_string)) {
+        if(!flipper_format_rewind(flipper_format)) {
             FURI_LOG_E(TAG, "Rewind error");
             break;
         }
         uint8_t key_data[sizeof(uint64_t)] = {0};
-        if(!flipper_format_read_hex(item->flipper_string, "Key", key_data, sizeof(uint64_t))) {
+        if(!flipper_format_read_hex(flipper_format, "Key", key_data, sizeof(uint64_t))) {
             FURI_LOG_D(TAG, "No Key");
         }
         uint64_t data = 0;
@@ -328,54 +678,148 @@ bool subghz_history_add_to_history(
         if(data != 0) {
             if(!(uint32_t)(data >> 32)) {
                 furi_string_printf(
-                    item->item_str,
+                    label,
                     "%s %lX",
                     furi_string_get_cstr(instance->tmp_string),
                     (uint32_t)(data & 0xFFFFFFFF));
             } else {
                 furi_string_printf(
-                    item->item_str,
+                    label,
                     "%s %lX%08lX",
                     furi_string_get_cstr(instance->tmp_string),
                     (uint32_t)(data >> 32),
                     (uint32_t)(data & 0xFFFFFFFF));
             }
         } else {
-            furi_string_printf(item->item_str, "%s", furi_string_get_cstr(instance->tmp_string));
+            furi_string_printf(label, "%s", furi_string_get_cstr(instance->tmp_string));
         }
-
     } while(false);
 
     furi_string_free(text);
-    instance->last_index_write++;
-    return true;
 }
 
-void subghz_history_remove_duplicates(SubGhzHistory* instance) {
+bool subghz_history_add_to_history(
+    SubGhzHistory* instance,
+    void* context,
+    SubGhzRadioPreset* preset) {
     furi_assert(instance);
+    furi_assert(context);
+
+    if(subghz_history_full(instance)) return false;
+
+    SubGhzProtocolDecoderBase* decoder_base = context;
+    uint32_t hash_data = subghz_protocol_decoder_base_get_hash_data_long(decoder_base);
+    bool result = false;
+    subghz_history_lock(instance);
+
+    do {
+        if((instance->code_last_hash_data == hash_data) &&
+           ((furi_get_tick() - instance->last_update_timestamp) < 500)) {
+            instance->last_update_timestamp = furi_get_tick();
+            break;
+        }
+
+        uint8_t protocol = subghz_history_intern_protocol(instance, decoder_base->protocol);
+        uint8_t preset_index = subghz_history_intern_preset(instance, preset);
+        if(protocol == SUBGHZ_HISTORY_INTERN_MAX || preset_index == SUBGHZ_HISTORY_INTERN_MAX) {
+            FURI_LOG_E(TAG, "Too many protocols or presets");
+            break;
+        }
+
+        uint16_t repeats = 0;
+        for(uint16_t i = instance->last_index_write; i-- > 0;) {
+            SubGhzHistoryRecord* search = subghz_history_get_record(instance, i);
+            if(search->hash_data == hash_data && search->protocol == protocol) {
+                repeats = search->repeats + 1;
+                break;
+            }
+        }
 
-    SubGhzHistoryItemArray_it_t it;
-    SubGhzHistoryItemArray_it_last(it, instance->history->data);
-    while(!SubGhzHistoryItemArray_end_p(it)) {
-        SubGhzHistoryItem* i = SubGhzHistoryItemArray_ref(it);
+        instance->code_last_hash_data = hash_data;
+        instance->last_update_timestamp = furi_get_tick();
+
+        FlipperFormat* flipper_format = instance->scratch;
+        Stream* stream = flipper_format_get_raw_stream(flipper_format);
+        stream_clean(stream);
+        subghz_protocol_decoder_base_serialize(decoder_base, flipper_format, preset);
+        if(stream_size(stream) > UINT16_MAX) {
+            FURI_LOG_E(TAG, "Signal data is too big");
+            break;
+        }
+
+        FuriString* label = furi_string_alloc();
+        subghz_history_format_label(instance, flipper_format, label);
+
+        SubGhzHistoryRecord* record = subghz_history_push_record(instance);
+        FuriHalRtcDateTime datetime;
+        furi_hal_rtc_get_datetime(&datetime);
+        record->hash_data = hash_data;
+        record->frequency = preset->frequency;
+        record->te = subghz_history_read_uint32(flipper_format, "TE");
+        record->timestamp = furi_hal_rtc_datetime_to_timestamp(&datetime);
+        record->latitude = preset->latitude;
+        record->longitude = preset->longitude;
+        record->repeats = repeats;
+        record->protocol = protocol;
+        record->preset = preset_index;
+        record->spilled = false;
+
+        record->label = (SubGhzHistoryRef){.offset = instance->labels.head};
+        subghz_history_arena_append(
+            &instance->labels,
+            &record->label,
+            (const uint8_t*)furi_string_get_cstr(label),
+            furi_string_size(label));
+        furi_string_free(label);
+
+        uint8_t buffer[64];
+        size_t length;
+        record->data = (SubGhzHistoryRef){.offset = instance->data.head};
+        stream_rewind(stream);
+        while((length = stream_read(stream, buffer, sizeof(buffer))) > 0) {
+            subghz_history_arena_append(&instance->data, &record->data, buffer, length);
+        }
+        result = true;
+    } while(false);
 
-        SubGhzHistoryItemArray_it_t jt;
-        SubGhzHistoryItemArray_it_set(jt, it);
-        SubGhzHistoryItemArray_previous(jt);
-        while(!SubGhzHistoryItemArray_end_p(jt)) {
-            SubGhzHistoryItem* j = SubGhzHistoryItemArray_ref(jt);
+    subghz_history_unlock(instance);
+    return result;
+}
 
-            if(j->hash_data == i->hash_data && j->protocol == i->protocol) {
-                subghz_history_delete_item(instance, jt->index);
+void subghz_history_remove_duplicates(SubGhzHistory* instance) {
+    furi_assert(instance);
+    subghz_history_lock(instance);
+
+    for(int32_t i = instance->last_index_write - 1; i > 0; i--) {
+        SubGhzHistoryRecord* record = subghz_history_get_record(instance, i);
+        const uint32_t hash_data = record->hash_data;
+        const uint8_t protocol = record->protocol;
+
+        for(int32_t j = i - 1; j >= 0; j--) {
+            SubGhzHistoryRecord* search = subghz_history_get_record(instance, j);
+            if(search->hash_data == hash_data && search->protocol == protocol) {
+                subghz_history_delete_item(instance, j);
+                i--; // Record i is shifted down
             }
-            SubGhzHistoryItemArray_previous(jt);
         }
-        SubGhzHistoryItemArray_previous(it);
     }
+
+    subghz_history_unlock(instance);
 }
 
 bool subghz_history_full(SubGhzHistory* instance) {
-    if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return true;
     if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return true;
-    return false;
+    return memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP;
+}
+
+void subghz_history_spill(SubGhzHistory* instance) {
+    furi_assert(instance);
+    if(memmgr_get_free_heap() >= SUBGHZ_HISTORY_SPILL_HEAP) return;
+
+    subghz_history_lock(instance);
+    // Keep some headroom above the limit, so signals received until next call still fit
+    while(memmgr_get_free_heap() < SUBGHZ_HISTORY_SPILL_HEAP) {
+        if(!subghz_history_spill_oldest(instance)) break;
+    }
+    subghz_history_unlock(instance);
 }
@@ -61,6 +61,20 @@ uint16_t subghz_history_get_repeats(SubGhzHistory* instance, uint16_t idx);
  */
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx);
 
+/** Get TE to history[idx]
+ * 
+ * @param instance  - SubGhzHistory instance
+ * @param idx       - record index  
+ * @return te       - TE us, 0 if protocol has no TE
+ */
+uint32_t subghz_history_get_te(SubGhzHistory* instance, uint16_t idx);
+
+/** Get radio preset to history[idx], valid until next call
+ * 
+ * @param instance  - SubGhzHistory instance
+ * @param idx       - record index  
+ * @return SubGhzRadioPreset*
+ */
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx);
 
 /** Get preset to history[idx]
@@ -152,13 +166,27 @@ bool subghz_history_add_to_history(
     SubGhzRadioPreset* preset);
 
 /** Get SubGhzProtocolCommonLoad to load into the protocol decoder bin data
+ * Data is loaded into a shared FlipperFormat, valid until next call.
+ * GUI thread only, use subghz_history_load_raw_data from other threads
  * 
  * @param instance  - SubGhzHistory instance
  * @param idx       - record index
- * @return SubGhzProtocolCommonLoad*
+ * @return SubGhzProtocolCommonLoad*, NULL if spilled data can't be read
  */
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx);
 
+/** Load bin data of history[idx] into a caller owned FlipperFormat
+ * 
+ * @param instance       - SubGhzHistory instance
+ * @param idx            - record index
+ * @param flipper_format - string backed FlipperFormat, rewound on return
+ * @return bool - false if spilled data can't be read
+ */
+bool subghz_history_load_raw_data(
+    SubGhzHistory* instance,
+    uint16_t idx,
+    FlipperFormat* flipper_format);
+
 /** Get latitude to history[idx]
  * 
  * @param instance  - SubGhzHistory instance
@@ -180,3 +208,6 @@ void subghz_history_remove_duplicates(SubGhzHistory* instance);
 
 // Check if memory/history is full
 bool subghz_history_full(SubGhzHistory* instance);
+
+// Move data of old signals to SD card while memory is low, call from GUI thread as it does SD I/O
+void subghz_history_spill(SubGhzHistory* instance);
@@ -7,7 +7,9 @@
 #include <time.h>
 #include <notification/notification_messages.h>
 #include <loader/loader.h>
+#include <gui/gui.h>
 #include <lib/toolbox/args.h>
+#include <lib/toolbox/profiler.h>
 
 // Close to ISO, `date +'%Y-%m-%d %H:%M:%S %u'`
 #define CLI_DATE_FORMAT "%.4d-%.2d-%.2d %.2d:%.2d:%.2d %d"
@@ -198,6 +200,8 @@ bool cli_command_log_level_set_from_string(FuriString* level) {
             "<log debug> — debug information including <log info> (may impact system performance)\r\n");
         printf(
             "<log trace> — system traces including <log debug> (may impact system performance)\r\n");
+        printf(
+            "<log deferred [level]> — format messages in background, lowers logging overhead\r\n");
     }
     return false;
 }
@@ -208,6 +212,14 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
     uint8_t buffer[CLI_COMMAND_LOG_BUFFER_SIZE];
     FuriLogLevel previous_level = furi_log_get_level();
     bool restore_log_level = false;
+    bool previous_deferred = furi_log_is_deferred();
+    bool deferred = false;
+
+    if(furi_string_start_with_str(args, "deferred")) {
+        furi_string_right(args, strlen("deferred"));
+        furi_string_trim(args);
+        deferred = true;
+    }
 
     if(furi_string_size(args) > 0) {
         if(!cli_command_log_level_set_from_string(args)) {
@@ -227,6 +239,7 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
     };
 
     furi_log_add_handler(log_handler);
+    if(deferred) furi_log_set_deferred(true);
 
     printf("Use <log ?> to list available log levels\r\n");
     printf("Press CTRL+C to stop...\r\n");
@@ -235,6 +248,10 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
         cli_write(cli, buffer, ret);
     }
 
+    if(deferred) {
+        furi_log_set_deferred(previous_deferred);
+        printf("Dropped messages since boot: %lu\r\n", furi_log_get_dropped_count());
+    }
     furi_log_remove_handler(log_handler);
 
     if(restore_log_level) {
@@ -281,6 +298,20 @@ void cli_command_sysctl_heap_track(Cli* cli, FuriString* args, void* context) {
     }
 }
 
+void cli_command_sysctl_heap_slab(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+    if(!furi_string_cmp(args, "0")) {
+        memmgr_heap_set_slab_enabled(false);
+        printf("Heap slabs disabled");
+    } else if(!furi_string_cmp(args, "1")) {
+        memmgr_heap_set_slab_enabled(true);
+        printf("Heap slabs enabled");
+    } else {
+        cli_print_usage("sysctl heap_slab", "<1|0>", furi_string_get_cstr(args));
+    }
+}
+
 void cli_command_sysctl_print_usage() {
     printf("Usage:\r\n");
     printf("sysctl <cmd> <args>\r\n");
@@ -292,6 +323,7 @@ void cli_command_sysctl_print_usage() {
 #else
     printf("\theap_track <none|main>\t - Set heap allocation tracking mode\r\n");
 #endif
+    printf("\theap_slab <1|0>\t - Serve small allocations from slabs until reboot\r\n");
 }
 
 void cli_command_sysctl(Cli* cli, FuriString* args, void* context) {
@@ -314,6 +346,11 @@ void cli_command_sysctl(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "heap_slab") == 0) {
+            cli_command_sysctl_heap_slab(cli, args, context);
+            break;
+        }
+
         cli_command_sysctl_print_usage();
     } while(false);
 
@@ -430,6 +467,7 @@ void cli_command_free(Cli* cli, FuriString* args, void* context) {
     printf("Total heap size: %zu\r\n", memmgr_get_total_heap());
     printf("Minimum heap size: %zu\r\n", memmgr_get_minimum_free_heap());
     printf("Maximum heap block: %zu\r\n", memmgr_heap_get_max_free_block());
+    printf("Slab free: %zu\r\n", memmgr_heap_get_slab_free());
 
     printf("Pool free: %zu\r\n", memmgr_pool_get_free());
     printf("Maximum pool block: %zu\r\n", memmgr_pool_get_max_block());
@@ -443,6 +481,315 @@ void cli_command_free_blocks(Cli* cli, FuriString* args, void* context) {
     memmgr_heap_printf_free_blocks();
 }
 
+static void cli_command_profiler_output(const char* data, void* context) {
+    UNUSED(context);
+    printf("%s", data);
+}
+
+void cli_command_profiler_print_usage() {
+    printf("Usage:\r\n");
+    printf("profiler <cmd> <args>\r\n");
+    printf("Cmd list:\r\n");
+
+    printf("\tdump <text|csv|json>\t - Print statistics of all probes\r\n");
+    printf("\treset\t - Clear statistics\r\n");
+}
+
+void cli_command_profiler(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    FuriString* cmd;
+    cmd = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, cmd)) {
+            cli_command_profiler_print_usage();
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "dump") == 0) {
+            ProfilerFormat format = ProfilerFormatText;
+            if(args_read_string_and_trim(args, cmd)) {
+                if(furi_string_cmp_str(cmd, "csv") == 0) {
+                    format = ProfilerFormatCsv;
+                } else if(furi_string_cmp_str(cmd, "json") == 0) {
+                    format = ProfilerFormatJson;
+                } else if(furi_string_cmp_str(cmd, "text") != 0) {
+                    cli_command_profiler_print_usage();
+                    break;
+                }
+            }
+            profiler_dump(format, cli_command_profiler_output, NULL);
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "reset") == 0) {
+            profiler_reset();
+            break;
+        }
+
+        cli_command_profiler_print_usage();
+    } while(false);
+
+    furi_string_free(cmd);
+}
+
+#define CLI_COMMAND_HEAP_TRACE_EVENTS_DEFAULT (512U)
+#define CLI_COMMAND_HEAP_TRACE_CHUNK (16U)
+#define CLI_COMMAND_HEAP_TRACE_THREADS_MAX (32U)
+#define CLI_COMMAND_HEAP_TRACE_STREAM_PERIOD_MS (50U)
+
+typedef struct {
+    FuriThreadId threads[CLI_COMMAND_HEAP_TRACE_THREADS_MAX];
+    size_t thread_count;
+    uint32_t dropped;
+} CliCommandHeapTrace;
+
+void cli_command_heap_trace_print_usage() {
+    printf("Usage:\r\n");
+    printf("heap_trace <cmd> <args>\r\n");
+    printf("Cmd list:\r\n");
+
+    printf(
+        "\tstart [events]\t - Start tracing, ring buffer holds %u events by default\r\n",
+        CLI_COMMAND_HEAP_TRACE_EVENTS_DEFAULT);
+    printf("\tstop\t - Stop tracing and free the buffer\r\n");
+    printf("\tdump\t - Print and remove recorded events\r\n");
+    printf("\tstream\t - Print events as they are recorded until CTRL+C\r\n");
+}
+
+// Threads are announced while running, names of exited threads can't be resolved later
+static void cli_command_heap_trace_threads(CliCommandHeapTrace* trace) {
+    FuriThreadId thread_ids[CLI_COMMAND_HEAP_TRACE_THREADS_MAX];
+    const size_t thread_count =
+        furi_thread_enumerate(thread_ids, CLI_COMMAND_HEAP_TRACE_THREADS_MAX);
+
+    for(size_t i = 0; i < thread_count; i++) {
+        bool known = false;
+        for(size_t j = 0; j < trace->thread_count; j++) {
+            if(trace->threads[j] == thread_ids[i]) {
+                known = true;
+                break;
+            }
+        }
+        if(known || trace->thread_count == CLI_COMMAND_HEAP_TRACE_THREADS_MAX) continue;
+
+        trace->threads[trace->thread_count++] = thread_ids[i];
+        printf(
+            "T %08lx %s %s\r\n",
+            (uint32_t)thread_ids[i],
+            furi_thread_get_appid(thread_ids[i]),
+            furi_thread_get_name(thread_ids[i]));
+    }
+}
+
+/** Print recorded events
+ *
+ * Line formats:
+ * - `T <thread> <appid> <name>` - thread description
+ * - `A <tick> <pointer> <size> <caller> <thread>` - allocation
+ * - `F <tick> <pointer> <caller> <thread>` - free
+ * - `D <count>` - total count of events dropped on full buffer
+ */
+static void cli_command_heap_trace_drain(Cli* cli, CliCommandHeapTrace* trace) {
+    MemmgrHeapTraceEvent events[CLI_COMMAND_HEAP_TRACE_CHUNK];
+    size_t count;
+
+    cli_command_heap_trace_threads(trace);
+
+    do {
+        count = memmgr_heap_trace_read(events, CLI_COMMAND_HEAP_TRACE_CHUNK);
+        for(size_t i = 0; i < count; i++) {
+            const MemmgrHeapTraceEvent* event = &events[i];
+            if(event->type == MemmgrHeapTraceEventAlloc) {
+                printf(
+                    "A %lu %08lx %lu %08lx %08lx\r\n",
+                    event->tick,
+                    event->pointer,
+                    (uint32_t)event->size,
+                    event->caller,
+                    event->thread);
+            } else {
+                printf(
+                    "F %lu %08lx %08lx %08lx\r\n",
+                    event->tick,
+                    event->pointer,
+                    event->caller,
+                    event->thread);
+            }
+        }
+    } while(count == CLI_COMMAND_HEAP_TRACE_CHUNK && !cli_cmd_interrupt_received(cli));
+
+    const uint32_t dropped = memmgr_heap_trace_get_dropped_count();
+    if(dropped != trace->dropped) {
+        trace->dropped = dropped;
+        printf("D %lu\r\n", dropped);
+    }
+}
+
+void cli_command_heap_trace(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+
+    FuriString* cmd;
+    cmd = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, cmd)) {
+            cli_command_heap_trace_print_usage();
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "start") == 0) {
+            int event_count = CLI_COMMAND_HEAP_TRACE_EVENTS_DEFAULT;
+            if(furi_string_size(args) > 0 &&
+               (!args_read_int_and_trim(args, &event_count) || event_count <= 0)) {
+                cli_command_heap_trace_print_usage();
+                break;
+            }
+            if(event_count * sizeof(MemmgrHeapTraceEvent) > memmgr_heap_get_max_free_block() / 2) {
+                printf("Not enough memory for %d events\r\n", event_count);
+                break;
+            }
+            if(!memmgr_heap_trace_start(event_count)) {
+                printf("Heap trace is already running\r\n");
+            }
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "stop") == 0) {
+            memmgr_heap_trace_stop();
+            break;
+        }
+
+        if(!memmgr_heap_trace_is_running()) {
+            printf("Heap trace is not running, use <heap_trace start>\r\n");
+            break;
+        }
+
+        CliCommandHeapTrace trace = {0};
+
+        if(furi_string_cmp_str(cmd, "dump") == 0) {
+            cli_command_heap_trace_drain(cli, &trace);
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "stream") == 0) {
+            printf("Press CTRL+C to stop...\r\n");
+            while(!cli_cmd_interrupt_received(cli) && memmgr_heap_trace_is_running()) {
+                cli_command_heap_trace_drain(cli, &trace);
+                furi_delay_ms(CLI_COMMAND_HEAP_TRACE_STREAM_PERIOD_MS);
+            }
+            break;
+        }
+
+        cli_command_heap_trace_print_usage();
+    } while(false);
+
+    furi_string_free(cmd);
+}
+
+void cli_command_icon_cache_print_usage() {
+    printf("Usage:\r\n");
+    printf("icon_cache <cmd> <args>\r\n");
+    printf("Cmd list:\r\n");
+
+    printf("\tstats\t - Print decoded icons cache statistics\r\n");
+    printf("\tsize <bytes>\t - Set cache RAM budget, 0 disables the cache\r\n");
+}
+
+void cli_command_icon_cache(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    FuriString* cmd;
+    cmd = furi_string_alloc();
+    Gui* gui = furi_record_open(RECORD_GUI);
+
+    do {
+        if(!args_read_string_and_trim(args, cmd)) {
+            cli_command_icon_cache_print_usage();
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "stats") == 0) {
+            CompressIconCacheStats stats;
+            gui_get_icon_cache_stats(gui, &stats);
+            printf("Size: %zu\r\n", stats.size);
+            printf("Used: %zu\r\n", stats.used);
+            printf("Entries: %lu\r\n", stats.entries);
+            printf("Hits: %lu\r\n", stats.hits);
+            printf("Misses: %lu\r\n", stats.misses);
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "size") == 0) {
+            int cache_size = 0;
+            if(!args_read_int_and_trim(args, &cache_size) || cache_size < 0) {
+                cli_command_icon_cache_print_usage();
+                break;
+            }
+            gui_set_icon_cache_size(gui, cache_size);
+            break;
+        }
+
+        cli_command_icon_cache_print_usage();
+    } while(false);
+
+    furi_record_close(RECORD_GUI);
+    furi_string_free(cmd);
+}
+
+void cli_command_gui_redraw_print_usage() {
+    printf("Usage:\r\n");
+    printf("gui_redraw <cmd>\r\n");
+    printf("Cmd list:\r\n");
+
+    printf("\tstats\t - Print screen redraw statistics\r\n");
+    printf("\treset\t - Reset screen redraw statistics\r\n");
+}
+
+void cli_command_gui_redraw(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    FuriString* cmd;
+    cmd = furi_string_alloc();
+    Gui* gui = furi_record_open(RECORD_GUI);
+
+    do {
+        if(!args_read_string_and_trim(args, cmd)) {
+            cli_command_gui_redraw_print_usage();
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "stats") == 0) {
+            GuiRedrawStats stats;
+            gui_get_redraw_stats(gui, &stats);
+            printf("Redraws: %lu\r\n", stats.redraws);
+            printf("Skipped: %lu\r\n", stats.skipped);
+            printf("Pages sent: %lu\r\n", stats.pages_sent);
+            printf("Pages skipped: %lu\r\n", stats.pages_skipped);
+            printf("Time total: %lu us\r\n", stats.time_total);
+            printf(
+                "Time average: %lu us\r\n",
+                stats.redraws ? stats.time_total / stats.redraws : 0);
+            printf("Time max: %lu us\r\n", stats.time_max);
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "reset") == 0) {
+            gui_reset_redraw_stats(gui);
+            break;
+        }
+
+        cli_command_gui_redraw_print_usage();
+    } while(false);
+
+    furi_record_close(RECORD_GUI);
+    furi_string_free(cmd);
+}
+
 void cli_command_i2c(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
@@ -484,6 +831,10 @@ void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "ps", CliCommandFlagParallelSafe, cli_command_ps, NULL);
     cli_add_command(cli, "free", CliCommandFlagParallelSafe, cli_command_free, NULL);
     cli_add_command(cli, "free_blocks", CliCommandFlagParallelSafe, cli_command_free_blocks, NULL);
+    cli_add_command(cli, "profiler", CliCommandFlagParallelSafe, cli_command_profiler, NULL);
+    cli_add_command(cli, "heap_trace", CliCommandFlagParallelSafe, cli_command_heap_trace, NULL);
+    cli_add_command(cli, "icon_cache", CliCommandFlagParallelSafe, cli_command_icon_cache, NULL);
+    cli_add_command(cli, "gui_redraw", CliCommandFlagParallelSafe, cli_command_gui_redraw, NULL);
 
     cli_add_command(cli, "vibro", CliCommandFlagDefault, cli_command_vibro, NULL);
     cli_add_command(cli, "led", CliCommandFlagDefault, cli_command_led, NULL);
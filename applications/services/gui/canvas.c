@@ -23,9 +23,11 @@ const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
 Canvas* canvas_init() {
     Canvas* canvas = malloc(sizeof(Canvas));
     canvas->compress_icon = compress_icon_alloc();
+    compress_icon_set_cache_size(canvas->compress_icon, CANVAS_ICON_CACHE_SIZE);
 
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
+    canvas->display_buffer = malloc(canvas_get_buffer_size(canvas));
     canvas->orientation = CanvasOrientationHorizontal;
     // Initialize display
     u8g2_InitDisplay(&canvas->fb);
@@ -42,9 +44,21 @@ Canvas* canvas_init() {
 void canvas_free(Canvas* canvas) {
     furi_assert(canvas);
     compress_icon_free(canvas->compress_icon);
+    free(canvas->display_buffer);
     free(canvas);
 }
 
+static uint8_t* canvas_decode_icon(Canvas* canvas, const uint8_t* icon_data) {
+    uint8_t* decoded = NULL;
+    // Firmware icons live in flash, icons of applications and asset packs may go away
+    if(((uintptr_t)icon_data >= FLASH_BASE) && ((uintptr_t)icon_data < SRAM1_BASE)) {
+        compress_icon_decode_cached(canvas->compress_icon, icon_data, &decoded);
+    } else {
+        compress_icon_decode(canvas->compress_icon, icon_data, &decoded);
+    }
+    return decoded;
+}
+
 void canvas_reset(Canvas* canvas) {
     furi_assert(canvas);
 
@@ -57,7 +71,33 @@ void canvas_reset(Canvas* canvas) {
 
 void canvas_commit(Canvas* canvas) {
     furi_assert(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+    uint8_t* buffer = u8g2_GetBufferPtr(&canvas->fb);
+    const uint8_t tile_width = u8g2_GetBufferTileWidth(&canvas->fb);
+    const uint8_t tile_height = u8g2_GetBufferTileHeight(&canvas->fb);
+    const size_t page_size = tile_width * 8;
+
+    // Send only runs of pages (8 pixel rows) that differ from the display memory
+    uint8_t page = 0;
+    while(page < tile_height) {
+        uint8_t first = page;
+        while(page < tile_height) {
+            uint8_t* data = &buffer[page * page_size];
+            uint8_t* sent = &canvas->display_buffer[page * page_size];
+            if(canvas->display_valid && memcmp(data, sent, page_size) == 0) break;
+            memcpy(sent, data, page_size);
+            page++;
+        }
+        if(page > first) {
+            u8g2_UpdateDisplayArea(&canvas->fb, 0, first, tile_width, page - first);
+            canvas->pages_sent += page - first;
+        } else {
+            canvas->pages_skipped++;
+            page++;
+        }
+    }
+    canvas->display_valid = true;
+
+    u8x8_RefreshDisplay(u8g2_GetU8x8(&canvas->fb));
 }
 
 uint8_t* canvas_get_buffer(Canvas* canvas) {
@@ -265,8 +305,7 @@ void canvas_draw_bitmap(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* bitmap_data = NULL;
-    compress_icon_decode(canvas->compress_icon, compressed_bitmap_data, &bitmap_data);
+    uint8_t* bitmap_data = canvas_decode_icon(canvas, compressed_bitmap_data);
     canvas_draw_u8g2_bitmap(&canvas->fb, x, y, width, height, bitmap_data, IconRotation0);
 }
 
@@ -280,9 +319,7 @@ void canvas_draw_icon_animation(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(
-        canvas->compress_icon, icon_animation_get_data(icon_animation), &icon_data);
+    uint8_t* icon_data = canvas_decode_icon(canvas, icon_animation_get_data(icon_animation));
     canvas_draw_u8g2_bitmap(
         &canvas->fb,
         x,
@@ -411,8 +448,7 @@ void canvas_draw_icon_ex(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_data(icon), &icon_data);
+    uint8_t* icon_data = canvas_decode_icon(canvas, icon_get_data(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, rotation);
 }
@@ -423,8 +459,7 @@ void canvas_draw_icon(Canvas* canvas, uint8_t x, uint8_t y, const Icon* icon) {
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_data(icon), &icon_data);
+    uint8_t* icon_data = canvas_decode_icon(canvas, icon_get_data(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, IconRotation0);
 }
@@ -558,8 +593,7 @@ void canvas_draw_icon_bitmap(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_data(icon), &icon_data);
+    uint8_t* icon_data = canvas_decode_icon(canvas, icon_get_data(icon));
     u8g2_DrawXBM(&canvas->fb, x, y, w, h, icon_data);
 }
 
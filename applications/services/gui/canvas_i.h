@@ -13,6 +13,9 @@
 extern "C" {
 #endif
 
+/** Default RAM budget of decoded icons cache, bytes */
+#define CANVAS_ICON_CACHE_SIZE (4 * 1024)
+
 /** Canvas structure
  */
 struct Canvas {
@@ -23,6 +26,11 @@ struct Canvas {
     uint8_t width;
     uint8_t height;
     CompressIcon* compress_icon;
+    // Framebuffer copy as it is in the display memory, valid after first commit
+    uint8_t* display_buffer;
+    bool display_valid;
+    uint32_t pages_sent;
+    uint32_t pages_skipped;
 };
 
 /** Allocate memory and initialize canvas
@@ -1,5 +1,6 @@
 #include <xtreme/xtreme.h>
 #include "gui_i.h"
+#include <furi_hal.h>
 #include <assets_icons.h>
 #include <storage/storage.h>
 #include <storage/storage_i.h>
@@ -41,6 +42,12 @@ size_t gui_active_view_port_count(Gui* gui, GuiLayer layer) {
 }
 
 void gui_update(Gui* gui) {
+    furi_assert(gui);
+    gui->redraw_all = true;
+    if(!gui->direct_draw) furi_thread_flags_set(gui->thread_id, GUI_THREAD_FLAG_DRAW);
+}
+
+void gui_update_dirty(Gui* gui) {
     furi_assert(gui);
     if(!gui->direct_draw) furi_thread_flags_set(gui->thread_id, GUI_THREAD_FLAG_DRAW);
 }
@@ -277,6 +284,54 @@ static bool gui_redraw_desktop(Gui* gui) {
     return false;
 }
 
+static bool gui_take_dirty_status_bar(Gui* gui) {
+    bool dirty = false;
+    ViewPortArray_it_t it;
+    for(size_t i = GuiLayerStatusBarLeft; i <= GuiLayerStatusBarRight; i++) {
+        ViewPortArray_it(it, gui->layers[i]);
+        while(!ViewPortArray_end_p(it)) {
+            ViewPort* view_port = *ViewPortArray_ref(it);
+            if(view_port_is_enabled(view_port)) {
+                dirty |= view_port_take_dirty(view_port);
+            }
+            ViewPortArray_next(it);
+        }
+    }
+    return dirty;
+}
+
+/** Collect damage of visible view ports, the same ones that gui_redraw draws
+ *
+ * Updates of covered view ports, like desktop under an application window,
+ * don't cause redraw.
+ *
+ * @return     true if screen must be redrawn
+ */
+static bool gui_take_damage(Gui* gui) {
+    bool dirty = gui->redraw_all;
+    gui->redraw_all = false;
+
+    bool status_bar = gui->hide_statusbar_count == 0;
+    ViewPort* view_port = NULL;
+    if(gui->lockdown) {
+        view_port = gui_view_port_find_enabled(gui->layers[GuiLayerDesktop]);
+        status_bar &= xtreme_settings.lockscreen_statusbar;
+    } else {
+        view_port = gui_view_port_find_enabled(gui->layers[GuiLayerFullscreen]);
+        if(view_port) {
+            status_bar = false;
+        } else {
+            view_port = gui_view_port_find_enabled(gui->layers[GuiLayerWindow]);
+            if(!view_port) view_port = gui_view_port_find_enabled(gui->layers[GuiLayerDesktop]);
+        }
+    }
+
+    if(view_port) dirty |= view_port_take_dirty(view_port);
+    if(status_bar) dirty |= gui_take_dirty_status_bar(gui);
+
+    return dirty;
+}
+
 static void gui_redraw(Gui* gui) {
     furi_assert(gui);
     gui_lock(gui);
@@ -284,6 +339,12 @@ static void gui_redraw(Gui* gui) {
     do {
         if(gui->direct_draw) break;
 
+        if(!gui_take_damage(gui)) {
+            gui->redraw_stats.skipped++;
+            break;
+        }
+
+        const uint32_t start = DWT->CYCCNT;
         canvas_reset(gui->canvas);
 
         if(gui->lockdown) {
@@ -304,6 +365,13 @@ static void gui_redraw(Gui* gui) {
         }
 
         canvas_commit(gui->canvas);
+
+        const uint32_t time =
+            (DWT->CYCCNT - start) / furi_hal_cortex_instructions_per_microsecond();
+        gui->redraw_stats.redraws++;
+        gui->redraw_stats.time_total += time;
+        gui->redraw_stats.time_max = MAX(gui->redraw_stats.time_max, time);
+
         for
             M_EACH(p, gui->canvas_callback_pair, CanvasCallbackPairArray_t) {
                 p->callback(
@@ -568,6 +636,35 @@ size_t gui_get_framebuffer_size(const Gui* gui) {
     return canvas_get_buffer_size(gui->canvas);
 }
 
+void gui_set_icon_cache_size(Gui* gui, size_t cache_size) {
+    furi_assert(gui);
+    compress_icon_set_cache_size(gui->canvas->compress_icon, cache_size);
+}
+
+void gui_get_icon_cache_stats(Gui* gui, CompressIconCacheStats* stats) {
+    furi_assert(gui);
+    compress_icon_get_cache_stats(gui->canvas->compress_icon, stats);
+}
+
+void gui_get_redraw_stats(Gui* gui, GuiRedrawStats* stats) {
+    furi_assert(gui);
+    furi_assert(stats);
+    gui_lock(gui);
+    *stats = gui->redraw_stats;
+    stats->pages_sent = gui->canvas->pages_sent;
+    stats->pages_skipped = gui->canvas->pages_skipped;
+    gui_unlock(gui);
+}
+
+void gui_reset_redraw_stats(Gui* gui) {
+    furi_assert(gui);
+    gui_lock(gui);
+    memset(&gui->redraw_stats, 0, sizeof(GuiRedrawStats));
+    gui->canvas->pages_sent = 0;
+    gui->canvas->pages_skipped = 0;
+    gui_unlock(gui);
+}
+
 void gui_set_hide_statusbar(Gui* gui, bool hidden) {
     furi_assert(gui);
 
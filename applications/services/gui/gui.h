@@ -7,6 +7,7 @@
 
 #include "view_port.h"
 #include "canvas.h"
+#include <toolbox/compress.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,6 +38,16 @@ typedef void (*GuiCanvasCommitCallback)(
 
 typedef struct Gui Gui;
 
+/** Screen redraw statistics */
+typedef struct {
+    uint32_t redraws; /**< Screen compositions */
+    uint32_t skipped; /**< Redraw requests without changes of visible view ports */
+    uint32_t pages_sent; /**< 8 pixel rows transferred to the display */
+    uint32_t pages_skipped; /**< Unchanged 8 pixel rows kept in the display memory */
+    uint32_t time_total; /**< Composition and transfer time, us */
+    uint32_t time_max; /**< Longest redraw, us */
+} GuiRedrawStats;
+
 /** Add view_port to view_port tree
  *
  * @remark     thread safe
@@ -100,6 +111,33 @@ void gui_remove_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback,
  */
 size_t gui_get_framebuffer_size(const Gui* gui);
 
+/** Set RAM budget of canvas decoded icons cache
+ *
+ * @param      gui         Gui instance
+ * @param      cache_size  cache size in bytes, 0 to disable the cache
+ */
+void gui_set_icon_cache_size(Gui* gui, size_t cache_size);
+
+/** Get canvas decoded icons cache statistics
+ *
+ * @param      gui    Gui instance
+ * @param      stats  pointer to statistics to fill
+ */
+void gui_get_icon_cache_stats(Gui* gui, CompressIconCacheStats* stats);
+
+/** Get screen redraw statistics
+ *
+ * @param      gui    Gui instance
+ * @param      stats  pointer to statistics to fill
+ */
+void gui_get_redraw_stats(Gui* gui, GuiRedrawStats* stats);
+
+/** Reset screen redraw statistics
+ *
+ * @param      gui    Gui instance
+ */
+void gui_reset_redraw_stats(Gui* gui);
+
 /** Set hidden statusbar
  *
  * Hide the statusbar (stacks if called multiple times).
@@ -69,6 +69,10 @@ struct Gui {
     Canvas* canvas;
     CanvasCallbackPairArray_t canvas_callback_pair;
 
+    // Redraw everything on next draw call, not only dirty view ports
+    bool redraw_all;
+    GuiRedrawStats redraw_stats;
+
     // Input
     FuriMessageQueue* input_queue;
     FuriPubSub* input_events;
@@ -90,11 +94,21 @@ struct Gui {
 ViewPort* gui_view_port_find_enabled(ViewPortArray_t array);
 
 /** Update GUI, request redraw
+ *
+ * Layout changed, screen is redrawn regardless of view port updates.
  *
  * @param      gui   Gui instance
  */
 void gui_update(Gui* gui);
 
+/** Request redraw after view port update
+ *
+ * Screen is redrawn only if one of visible view ports is dirty.
+ *
+ * @param      gui   Gui instance
+ */
+void gui_update_dirty(Gui* gui);
+
 /** Input event callback
  * 
  * Used to receive input from input service or to inject new input events
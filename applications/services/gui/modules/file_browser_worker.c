@@ -18,6 +18,7 @@
 #define BROWSER_ROOT STORAGE_ANY_PATH_PREFIX
 #define FILE_NAME_LEN_MAX 254
 #define LONG_LOAD_THRESHOLD 100
+#define DIR_READ_BATCH 8
 
 typedef enum {
     WorkerEvtStop = (1 << 0),
@@ -57,6 +58,57 @@ struct BrowserWorker {
     bool keep_selection;
 };
 
+// Reads directory items in batches, one storage request per DIR_READ_BATCH items
+typedef struct {
+    Storage* storage;
+    StorageOp ops[DIR_READ_BATCH];
+    FileInfo file_info[DIR_READ_BATCH];
+    char name[DIR_READ_BATCH][FILE_NAME_LEN_MAX];
+    size_t count;
+    size_t index;
+} BrowserDirReader;
+
+static BrowserDirReader* browser_dir_reader_alloc(Storage* storage, File* directory) {
+    BrowserDirReader* reader = malloc(sizeof(BrowserDirReader));
+    reader->storage = storage;
+    for(size_t i = 0; i < DIR_READ_BATCH; i++) {
+        reader->ops[i] = (StorageOp){
+            .type = StorageOpTypeDirRead,
+            .dir_read =
+                {
+                    .file = directory,
+                    .fileinfo = &reader->file_info[i],
+                    .name = reader->name[i],
+                    .name_length = FILE_NAME_LEN_MAX,
+                },
+        };
+    }
+    return reader;
+}
+
+static void browser_dir_reader_free(BrowserDirReader* reader) {
+    free(reader);
+}
+
+// Same as storage_dir_read, but returns true only if there were no errors
+static bool browser_dir_reader_next(BrowserDirReader* reader, FileInfo* file_info, char* name) {
+    if(reader->index == reader->count) {
+        reader->count = storage_batch(reader->storage, reader->ops, DIR_READ_BATCH, true);
+        reader->index = 0;
+    }
+
+    const StorageOp* op = &reader->ops[reader->index];
+    if(!op->result || op->error != FSE_OK) {
+        // Keep failed item, next calls fail the same way without new requests
+        return false;
+    }
+
+    *file_info = reader->file_info[reader->index];
+    memcpy(name, reader->name[reader->index], strlen(reader->name[reader->index]) + 1);
+    reader->index++;
+    return true;
+}
+
 static bool browser_path_is_file(FuriString* path) {
     bool state = false;
     FileInfo file_info;
@@ -146,6 +198,7 @@ static bool browser_folder_init(
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* directory = storage_file_alloc(storage);
+    BrowserDirReader* reader = browser_dir_reader_alloc(storage, directory);
 
     char name_temp[FILE_NAME_LEN_MAX];
     FuriString* name_str;
@@ -157,10 +210,10 @@ static bool browser_folder_init(
     if(storage_dir_open(directory, furi_string_get_cstr(path))) {
         state = true;
         while(1) {
-            if(!storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX)) {
+            if(!browser_dir_reader_next(reader, &file_info, name_temp)) {
                 break;
             }
-            if((storage_file_get_error(directory) == FSE_OK) && (name_temp[0] != '\0')) {
+            if(name_temp[0] != '\0') {
                 total_files_cnt++;
                 furi_string_set(name_str, name_temp);
                 if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
@@ -183,6 +236,7 @@ static bool browser_folder_init(
 
     furi_string_free(name_str);
 
+    browser_dir_reader_free(reader);
     storage_dir_close(directory);
     storage_file_free(directory);
 
@@ -201,6 +255,7 @@ static bool browser_folder_load_chunked(
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* directory = storage_file_alloc(storage);
+    BrowserDirReader* reader = browser_dir_reader_alloc(storage, directory);
 
     char name_temp[FILE_NAME_LEN_MAX];
     FuriString* name_str;
@@ -215,16 +270,12 @@ static bool browser_folder_load_chunked(
 
         items_cnt = 0;
         while(items_cnt < offset) {
-            if(!storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX)) {
+            if(!browser_dir_reader_next(reader, &file_info, name_temp)) {
                 break;
             }
-            if(storage_file_get_error(directory) == FSE_OK) {
-                furi_string_set(name_str, name_temp);
-                if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    items_cnt++;
-                }
-            } else {
-                break;
+            furi_string_set(name_str, name_temp);
+            if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
+                items_cnt++;
             }
         }
         if(items_cnt != offset) {
@@ -237,21 +288,17 @@ static bool browser_folder_load_chunked(
 
         items_cnt = 0;
         while(items_cnt < count) {
-            if(!storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX)) {
+            if(!browser_dir_reader_next(reader, &file_info, name_temp)) {
                 break;
             }
-            if(storage_file_get_error(directory) == FSE_OK) {
-                furi_string_set(name_str, name_temp);
-                if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    furi_string_printf(name_str, "%s/%s", furi_string_get_cstr(path), name_temp);
-                    if(browser->list_item_cb) {
-                        browser->list_item_cb(
-                            browser->cb_ctx, name_str, file_info_is_dir(&file_info), false);
-                    }
-                    items_cnt++;
+            furi_string_set(name_str, name_temp);
+            if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
+                furi_string_printf(name_str, "%s/%s", furi_string_get_cstr(path), name_temp);
+                if(browser->list_item_cb) {
+                    browser->list_item_cb(
+                        browser->cb_ctx, name_str, file_info_is_dir(&file_info), false);
                 }
-            } else {
-                break;
+                items_cnt++;
             }
         }
         if(browser->list_item_cb) {
@@ -261,6 +308,7 @@ static bool browser_folder_load_chunked(
 
     furi_string_free(name_str);
 
+    browser_dir_reader_free(reader);
     storage_dir_close(directory);
     storage_file_free(directory);
 
@@ -275,6 +323,7 @@ static bool browser_folder_load_full(BrowserWorker* browser, FuriString* path) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* directory = storage_file_alloc(storage);
+    BrowserDirReader* reader = browser_dir_reader_alloc(storage, directory);
 
     char name_temp[FILE_NAME_LEN_MAX];
     FuriString* name_str;
@@ -290,8 +339,7 @@ static bool browser_folder_load_full(BrowserWorker* browser, FuriString* path) {
         if(browser->list_load_cb) {
             browser->list_load_cb(browser->cb_ctx, 0);
         }
-        while(storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX) &&
-              storage_file_get_error(directory) == FSE_OK) {
+        while(browser_dir_reader_next(reader, &file_info, name_temp)) {
             furi_string_set(name_str, name_temp);
             if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
                 furi_string_printf(name_str, "%s/%s", furi_string_get_cstr(path), name_temp);
@@ -310,6 +358,7 @@ static bool browser_folder_load_full(BrowserWorker* browser, FuriString* path) {
 
     furi_string_free(name_str);
 
+    browser_dir_reader_free(reader);
     storage_dir_close(directory);
     storage_file_free(directory);
 
@@ -194,10 +194,20 @@ void view_port_update(ViewPort* view_port) {
         FURI_LOG_W(TAG, "ViewPort lockup: see %s:%d", __FILE__, __LINE__ - 3);
     }
 
-    if(view_port->gui && view_port->is_enabled) gui_update(view_port->gui);
+    view_port->is_dirty = true;
+    if(view_port->gui && view_port->is_enabled) gui_update_dirty(view_port->gui);
     furi_mutex_release(view_port->mutex);
 }
 
+bool view_port_take_dirty(ViewPort* view_port) {
+    furi_assert(view_port);
+    furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
+    bool is_dirty = view_port->is_dirty;
+    view_port->is_dirty = false;
+    furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
+    return is_dirty;
+}
+
 void view_port_gui_set(ViewPort* view_port, Gui* gui) {
     furi_assert(view_port);
     furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
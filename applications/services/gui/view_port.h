@@ -102,6 +102,7 @@ void view_port_ascii_callback_set(
 /** Emit update signal to GUI system.
  *
  * Rendering will happen later after GUI system process signal.
+ * View port is marked dirty, screen is redrawn only if it is visible.
  *
  * @param      view_port  ViewPort instance
  */
@@ -12,6 +12,7 @@ struct ViewPort {
     Gui* gui;
     FuriMutex* mutex;
     bool is_enabled;
+    bool is_dirty;
     ViewPortOrientation orientation;
 
     uint8_t width;
@@ -36,6 +37,16 @@ struct ViewPort {
  */
 void view_port_gui_set(ViewPort* view_port, Gui* gui);
 
+/** Get and clear dirty flag, set by view_port_update.
+ *
+ * To be used by GUI, called on tree redraw to find visible changes.
+ *
+ * @param      view_port  ViewPort instance
+ *
+ * @return     true if view port was updated since previous call
+ */
+bool view_port_take_dirty(ViewPort* view_port);
+
 /** Process draw call. Calls draw callback.
  *
  * To be used by GUI, called on tree redraw.
@@ -8,7 +8,9 @@
 
 #include <furi_hal_info.h>
 
-static_assert(!has_hash_collisions(elf_api_table), "Detected API method hash collision!");
+static_assert(
+    is_perfect_hash_valid(elf_api_table, elf_api_phf_displacements),
+    "API table does not match perfect hash!");
 
 #ifdef APP_UNIT_TESTS
 constexpr HashtableApiInterface mock_elf_api_interface{
@@ -23,14 +25,16 @@ constexpr HashtableApiInterface mock_elf_api_interface{
 
 const ElfApiInterface* const firmware_api_interface = &mock_elf_api_interface;
 #else
-constexpr HashtableApiInterface elf_api_interface{
+constexpr PerfectHashApiInterface elf_api_interface{
     {
         .api_version_major = (elf_api_version >> 16),
         .api_version_minor = (elf_api_version & 0xFFFF),
-        .resolver_callback = &elf_resolve_from_hashtable,
+        .resolver_callback = &elf_resolve_from_perfect_hash,
     },
-    .table_cbegin = elf_api_table.cbegin(),
-    .table_cend = elf_api_table.cend(),
+    .table = elf_api_table.data(),
+    .table_size = elf_api_table.size(),
+    .displacements = elf_api_phf_displacements.data(),
+    .bucket_count = elf_api_phf_displacements.size(),
 };
 const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
 #endif
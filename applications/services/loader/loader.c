@@ -424,6 +424,8 @@ static LoaderStatus loader_start_external_app(
 
     do {
         loader->app.fap = flipper_application_alloc(storage, firmware_api_interface);
+        flipper_application_set_cache_enabled(
+            loader->app.fap, flipper_application_is_cache_allowed(storage));
         size_t start = furi_get_tick();
 
         FURI_LOG_I(TAG, "Loading %s", path);
@@ -3,6 +3,7 @@
 #include <applications.h>
 #include <lib/toolbox/args.h>
 #include <notification/notification_messages.h>
+#include <flipper_application/flipper_application.h>
 #include "loader.h"
 
 static void loader_cli_print_usage() {
@@ -12,6 +13,7 @@ static void loader_cli_print_usage() {
     printf("\tlist\t - List available applications\r\n");
     printf("\topen <Application Name:string>\t - Open application by name\r\n");
     printf("\tinfo\t - Show loader state\r\n");
+    printf("\tfap_cache <on|off>\t - Allow image cache of external applications\r\n");
 }
 
 static void loader_cli_list() {
@@ -37,6 +39,28 @@ static void loader_cli_info(Loader* loader) {
     }
 }
 
+static void loader_cli_fap_cache(FuriString* args) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    if(!furi_string_cmp(args, "on")) {
+        if(flipper_application_set_cache_allowed(storage, true)) {
+            printf("Image cache allowed\r\n");
+        } else {
+            printf("Failed to create %s\r\n", FLIPPER_APPLICATION_CACHE_PATH);
+        }
+    } else if(!furi_string_cmp(args, "off")) {
+        if(flipper_application_set_cache_allowed(storage, false)) {
+            printf("Image cache forbidden and cleared\r\n");
+        } else {
+            printf("Failed to remove %s\r\n", FLIPPER_APPLICATION_CACHE_PATH);
+        }
+    } else {
+        cli_print_usage("loader fap_cache", "<on|off>", furi_string_get_cstr(args));
+    }
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 static void loader_cli_open(FuriString* args, Loader* loader) {
     FuriString* app_name = furi_string_alloc();
 
@@ -97,6 +121,11 @@ static void loader_cli(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "fap_cache") == 0) {
+            loader_cli_fap_cache(args);
+            break;
+        }
+
         loader_cli_print_usage();
     } while(false);
 
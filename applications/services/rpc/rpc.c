@@ -1,4 +1,5 @@
 #include "rpc_i.h"
+#include "rpc_encoder.h"
 
 #include <pb.h>
 #include <pb_decode.h>
@@ -27,6 +28,11 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+/* Fits screen frames and storage read responses, bigger messages are streamed in chunks */
+#define RPC_TX_BUFFER_SIZE (1280)
+/* USB sessions get bigger storage read responses, message fields take less than 256 bytes */
+#define RPC_TX_BUFFER_SIZE_LARGE (RPC_STORAGE_DATA_SIZE_LARGE + 256)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -79,11 +85,13 @@ struct RpcSession {
     bool decode_error;
 
     FuriMutex* callbacks_mutex;
+    RpcEncoder encoder; /**< Guarded by callbacks_mutex */
     RpcSendBytesCallback send_bytes_callback;
     RpcBufferIsEmptyCallback buffer_is_empty_callback;
     RpcSessionClosedCallback closed_callback;
     RpcSessionTerminatedCallback terminated_callback;
     RpcOwner owner;
+    RpcScreenStreamMode screen_stream_mode;
     void* context;
 };
 
@@ -97,6 +105,16 @@ RpcOwner rpc_session_get_owner(RpcSession* session) {
     return session->owner;
 }
 
+void rpc_session_set_screen_stream_mode(RpcSession* session, RpcScreenStreamMode mode) {
+    furi_assert(session);
+    session->screen_stream_mode = mode;
+}
+
+RpcScreenStreamMode rpc_session_get_screen_stream_mode(RpcSession* session) {
+    furi_assert(session);
+    return session->screen_stream_mode;
+}
+
 static void rpc_close_session_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -367,6 +385,7 @@ static void rpc_session_thread_pending_callback(void* context, uint32_t arg) {
     furi_mutex_release(session->callbacks_mutex);
 
     furi_mutex_free(session->callbacks_mutex);
+    free(session->encoder.buffer);
     furi_thread_join(session->thread);
     furi_thread_free(session->thread);
     free(session);
@@ -378,6 +397,15 @@ static void rpc_session_thread_state_callback(FuriThreadState thread_state, void
     }
 }
 
+static void rpc_send_bytes(void* context, uint8_t* bytes, size_t size) {
+    RpcSession* session = context;
+#if SRV_RPC_DEBUG
+    rpc_debug_print_data("OUTPUT", bytes, size);
+#endif
+    // Transport blocks until the data is taken, which throttles the sender
+    session->send_bytes_callback(session->context, bytes, size);
+}
+
 RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagLock) && !xtreme_settings.allow_locked_rpc_commands)
         return NULL;
@@ -386,11 +414,17 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
 
     RpcSession* session = malloc(sizeof(RpcSession));
     session->callbacks_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    session->encoder.buffer_size = owner == RpcOwnerUsb ? RPC_TX_BUFFER_SIZE_LARGE :
+                                                          RPC_TX_BUFFER_SIZE;
+    session->encoder.buffer = malloc(session->encoder.buffer_size);
+    session->encoder.send_bytes_callback = rpc_send_bytes;
+    session->encoder.context = session;
     session->stream = furi_stream_buffer_alloc(RPC_BUFFER_SIZE, 1);
     session->rpc = rpc;
     session->terminate = false;
     session->decode_error = false;
     session->owner = owner;
+    session->screen_stream_mode = RpcScreenStreamModeRaw;
     RpcHandlerDict_init(session->handlers);
 
     session->decoded_message = malloc(sizeof(PB_Main));
@@ -456,32 +490,16 @@ void rpc_send(RpcSession* session, PB_Main* message) {
     furi_assert(session);
     furi_assert(message);
 
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
 #if SRV_RPC_DEBUG
     FURI_LOG_I(TAG, "OUTPUT:");
     rpc_debug_print_message(message);
 #endif
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-    furi_check(result && ostream.bytes_written);
-
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
-
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-
-#if SRV_RPC_DEBUG
-    rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
-#endif
-
     furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
     if(session->send_bytes_callback) {
-        session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
+        furi_check(rpc_encoder_send(&session->encoder, message));
     }
     furi_mutex_release(session->callbacks_mutex);
-
-    free(buffer);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
@@ -46,6 +46,29 @@ typedef enum {
  */
 RpcOwner rpc_session_get_owner(RpcSession* session);
 
+/** Screen stream frame encoding */
+typedef enum {
+    RpcScreenStreamModeRaw = 0, /**< Whole framebuffer in every frame */
+    RpcScreenStreamModeDelta, /**< Compressed key frames and changed tiles, see rpc_gui.c */
+} RpcScreenStreamMode;
+
+/** Set screen stream frame encoding, applied on next screen stream start
+ *
+ * Default mode is RpcScreenStreamModeRaw, client must be able to decode
+ * frames of the mode selected by transport layer.
+ *
+ * @param   session     pointer to RpcSession descriptor
+ * @param   mode        screen stream mode
+ */
+void rpc_session_set_screen_stream_mode(RpcSession* session, RpcScreenStreamMode mode);
+
+/** Get screen stream frame encoding
+ *
+ * @param   session     pointer to RpcSession descriptor
+ * @return              screen stream mode
+ */
+RpcScreenStreamMode rpc_session_get_screen_stream_mode(RpcSession* session);
+
 /** Open RPC session
  *
  * USAGE:
@@ -37,7 +37,6 @@ static void rpc_cli_session_terminated_callback(void* context) {
 }
 
 void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
-    UNUSED(args);
     furi_assert(cli);
     furi_assert(context);
     Rpc* rpc = context;
@@ -59,6 +58,10 @@ void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
     rpc_session_set_send_bytes_callback(rpc_session, rpc_cli_send_bytes_callback);
     rpc_session_set_close_callback(rpc_session, rpc_cli_session_close_callback);
     rpc_session_set_terminated_callback(rpc_session, rpc_cli_session_terminated_callback);
+    // Host tools that decode delta frames request them when starting the session
+    if(furi_string_cmp_str(args, "screen_delta") == 0) {
+        rpc_session_set_screen_stream_mode(rpc_session, RpcScreenStreamModeDelta);
+    }
 
     uint8_t* buffer = malloc(CLI_READ_BUFFER_SIZE);
     size_t size_received = 0;
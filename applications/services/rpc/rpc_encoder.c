@@ -0,0 +1,56 @@
+#include "rpc_encoder.h"
+
+#include <pb_encode.h>
+
+static bool rpc_encoder_stream_callback(pb_ostream_t* stream, const pb_byte_t* buf, size_t count) {
+    RpcEncoder* encoder = stream->state;
+
+    while(count) {
+        if(encoder->buffer_used == encoder->buffer_size) {
+            encoder->send_bytes_callback(encoder->context, encoder->buffer, encoder->buffer_used);
+            encoder->buffer_used = 0;
+        }
+        size_t chunk = MIN(count, encoder->buffer_size - encoder->buffer_used);
+        memcpy(&encoder->buffer[encoder->buffer_used], buf, chunk);
+        encoder->buffer_used += chunk;
+        buf += chunk;
+        count -= chunk;
+    }
+
+    return true;
+}
+
+bool rpc_encoder_send(RpcEncoder* encoder, const PB_Main* message) {
+    furi_assert(encoder);
+    furi_assert(encoder->buffer_size > RPC_ENCODER_PREFIX_SIZE);
+    furi_assert(message);
+
+    uint8_t* body = &encoder->buffer[RPC_ENCODER_PREFIX_SIZE];
+    pb_ostream_t ostream =
+        pb_ostream_from_buffer(body, encoder->buffer_size - RPC_ENCODER_PREFIX_SIZE);
+
+    if(pb_encode(&ostream, &PB_Main_msg, message)) {
+        const size_t body_size = ostream.bytes_written;
+        uint8_t prefix[RPC_ENCODER_PREFIX_SIZE];
+        ostream = pb_ostream_from_buffer(prefix, sizeof(prefix));
+        if(!pb_encode_varint(&ostream, body_size)) return false;
+
+        uint8_t* start = body - ostream.bytes_written;
+        memcpy(start, prefix, ostream.bytes_written);
+        encoder->send_bytes_callback(encoder->context, start, ostream.bytes_written + body_size);
+    } else {
+        encoder->buffer_used = 0;
+        ostream = (pb_ostream_t){
+            .callback = rpc_encoder_stream_callback,
+            .state = encoder,
+            .max_size = SIZE_MAX,
+        };
+        if(!pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED) ||
+           !ostream.bytes_written) {
+            return false;
+        }
+        encoder->send_bytes_callback(encoder->context, encoder->buffer, encoder->buffer_used);
+    }
+
+    return true;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file rpc_encoder.h
+ * Delimited PB_Main encoding into a transmit buffer
+ *
+ * Kept free of firmware services, so host tools can build it as is,
+ * see scripts/rpc_encode_bench.py.
+ */
+#pragma once
+
+#include "rpc.h"
+
+#include <flipper.pb.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max varint32 size, for the delimited message length */
+#define RPC_ENCODER_PREFIX_SIZE (5)
+
+typedef struct {
+    uint8_t* buffer; /**< Transmit buffer, set by owner */
+    size_t buffer_size; /**< Transmit buffer size, set by owner */
+    size_t buffer_used;
+    RpcSendBytesCallback send_bytes_callback; /**< Set by owner */
+    void* context; /**< Passed to send_bytes_callback */
+} RpcEncoder;
+
+/** Encode message as delimited PB_Main and pass it to send_bytes_callback
+ *
+ * Message is encoded once after the space reserved for its length, which is filled in
+ * afterwards. Messages that don't fit into the buffer take a sizing pass and are passed
+ * in buffer sized chunks.
+ *
+ * @param      encoder  RpcEncoder instance
+ * @param      message  message to encode
+ *
+ * @return     true on success, false if message can't be encoded
+ */
+bool rpc_encoder_send(RpcEncoder* encoder, const PB_Main* message);
+
+#ifdef __cplusplus
+}
+#endif
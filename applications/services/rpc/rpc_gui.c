@@ -1,6 +1,8 @@
 #include "rpc_i.h"
+#include "rpc_gui_frame.h"
 #include <gui/gui_i.h>
 #include <assets_icons.h>
+#include <toolbox/compress.h>
 
 #include <flipper.pb.h>
 #include <gui.pb.h>
@@ -51,6 +53,15 @@ typedef enum {
 
 #define RPC_GUI_INPUT_RESET (0u)
 
+/*
+ * Screen frames in RpcScreenStreamModeDelta are encoded as described in rpc_gui_frame.h.
+ * Unchanged frames are not sent. Key frames are sent at least every
+ * RPC_GUI_KEYFRAME_INTERVAL_MS while the screen changes.
+ */
+#define RPC_GUI_KEYFRAME_INTERVAL_MS (2000u)
+// Only encoder part of Compress is used
+#define RPC_GUI_COMPRESS_DECODER_BUFFER_SIZE (16u)
+
 typedef struct {
     RpcSession* session;
     Gui* gui;
@@ -62,6 +73,19 @@ typedef struct {
     // Transmit
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
+    RpcScreenStreamMode stream_mode;
+    size_t frame_size;
+    FuriMutex* frame_mutex;
+    uint8_t* frame_pending; /**< Latest GUI frame, guarded by frame_mutex */
+    CanvasOrientation frame_pending_orientation;
+    uint8_t* frame_current;
+    uint8_t* frame_previous; /**< Last transmitted frame */
+    CanvasOrientation frame_previous_orientation;
+    bool frame_previous_valid;
+    // Delta mode only
+    Compress* compress;
+    uint8_t* delta_buffer;
+    uint32_t keyframe_tick;
 
     bool virtual_display_not_empty;
     bool is_streaming;
@@ -88,17 +112,72 @@ static void rpc_system_gui_screen_stream_frame_callback(
     furi_assert(context);
 
     RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
-    uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
 
-    furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
+    furi_assert(size == rpc_gui->frame_size);
 
-    memcpy(buffer, data, size);
-    rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
-        rpc_system_gui_screen_orientation_map[orientation];
+    // Frames coming while previous one is transmitted are coalesced, the latest one is sent
+    furi_check(furi_mutex_acquire(rpc_gui->frame_mutex, FuriWaitForever) == FuriStatusOk);
+    memcpy(rpc_gui->frame_pending, data, size);
+    rpc_gui->frame_pending_orientation = orientation;
+    furi_mutex_release(rpc_gui->frame_mutex);
 
     furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
 }
 
+/** Fill transmit frame from frame_current
+ * @return false if frame is unchanged and must not be sent
+ */
+static bool rpc_system_gui_screen_stream_encode(
+    RpcGuiSystem* rpc_gui,
+    CanvasOrientation orientation) {
+    const size_t size = rpc_gui->frame_size;
+    const bool orientation_changed = orientation != rpc_gui->frame_previous_orientation;
+
+    if(rpc_gui->frame_previous_valid && !orientation_changed &&
+       memcmp(rpc_gui->frame_current, rpc_gui->frame_previous, size) == 0) {
+        return false;
+    }
+
+    PB_Gui_ScreenFrame* frame = &rpc_gui->transmit_frame->content.gui_screen_frame;
+    frame->orientation = rpc_system_gui_screen_orientation_map[orientation];
+
+    const uint32_t tick = furi_get_tick();
+    bool encoded = false;
+    if(rpc_gui->stream_mode == RpcScreenStreamModeDelta) {
+        const bool keyframe =
+            !rpc_gui->frame_previous_valid || orientation_changed ||
+            (tick - rpc_gui->keyframe_tick) >= furi_ms_to_ticks(RPC_GUI_KEYFRAME_INTERVAL_MS);
+
+        const size_t encoded_size = rpc_gui_frame_encode(
+            rpc_gui->compress,
+            rpc_gui->frame_current,
+            keyframe ? NULL : rpc_gui->frame_previous,
+            size,
+            rpc_gui->delta_buffer,
+            frame->data->bytes);
+
+        if(encoded_size) {
+            frame->data->size = encoded_size;
+            encoded = true;
+            if(keyframe) rpc_gui->keyframe_tick = tick;
+        }
+    }
+
+    if(!encoded) {
+        memcpy(frame->data->bytes, rpc_gui->frame_current, size);
+        frame->data->size = size;
+        rpc_gui->keyframe_tick = tick;
+    }
+
+    uint8_t* previous = rpc_gui->frame_previous;
+    rpc_gui->frame_previous = rpc_gui->frame_current;
+    rpc_gui->frame_current = previous;
+    rpc_gui->frame_previous_orientation = orientation;
+    rpc_gui->frame_previous_valid = true;
+
+    return true;
+}
+
 static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context) {
     furi_assert(context);
 
@@ -110,14 +189,21 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
             furi_thread_flags_wait(RpcGuiWorkerFlagAny, FuriFlagWaitAny, FuriWaitForever);
 
         if(flags & RpcGuiWorkerFlagTransmit) {
-            transmit_time = furi_get_tick();
-            rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
-            transmit_time = furi_get_tick() - transmit_time;
-
-            // Guaranteed bandwidth reserve
-            uint32_t extra_delay = transmit_time / 20;
-            if(extra_delay > 500) extra_delay = 500;
-            if(extra_delay) furi_delay_tick(extra_delay);
+            furi_check(furi_mutex_acquire(rpc_gui->frame_mutex, FuriWaitForever) == FuriStatusOk);
+            memcpy(rpc_gui->frame_current, rpc_gui->frame_pending, rpc_gui->frame_size);
+            CanvasOrientation orientation = rpc_gui->frame_pending_orientation;
+            furi_mutex_release(rpc_gui->frame_mutex);
+
+            if(rpc_system_gui_screen_stream_encode(rpc_gui, orientation)) {
+                transmit_time = furi_get_tick();
+                rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
+                transmit_time = furi_get_tick() - transmit_time;
+
+                // Guaranteed bandwidth reserve, frames coming meanwhile are coalesced
+                uint32_t extra_delay = transmit_time / 20;
+                if(extra_delay > 500) extra_delay = 500;
+                if(extra_delay) furi_delay_tick(extra_delay);
+            }
         }
 
         if(flags & RpcGuiWorkerFlagExit) {
@@ -128,6 +214,67 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
     return 0;
 }
 
+static void rpc_system_gui_screen_stream_start(RpcGuiSystem* rpc_gui) {
+    rpc_gui->is_streaming = true;
+    rpc_gui->stream_mode = rpc_session_get_screen_stream_mode(rpc_gui->session);
+    size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
+    size_t data_size = framebuffer_size;
+    rpc_gui->frame_size = framebuffer_size;
+    // Delta mode buffers
+    if(rpc_gui->stream_mode == RpcScreenStreamModeDelta) {
+        furi_assert(framebuffer_size % RPC_GUI_FRAME_TILE_SIZE == 0);
+        data_size = RPC_GUI_FRAME_CAPACITY(framebuffer_size);
+        rpc_gui->compress = compress_alloc(RPC_GUI_COMPRESS_DECODER_BUFFER_SIZE);
+        rpc_gui->delta_buffer = malloc(RPC_GUI_FRAME_DELTA_BUFFER_SIZE(framebuffer_size));
+    }
+    // Reusable Frame
+    rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
+    rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
+    rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
+    rpc_gui->transmit_frame->content.gui_screen_frame.data =
+        malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(data_size));
+    rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
+    // Frame exchange between GUI callback and transmission thread
+    rpc_gui->frame_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    rpc_gui->frame_pending = malloc(framebuffer_size);
+    rpc_gui->frame_current = malloc(framebuffer_size);
+    rpc_gui->frame_previous = malloc(framebuffer_size);
+    rpc_gui->frame_previous_valid = false;
+    // Transmission thread for async TX
+    rpc_gui->transmit_thread = furi_thread_alloc_ex(
+        "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
+    furi_thread_start(rpc_gui->transmit_thread);
+    // GUI framebuffer callback
+    gui_add_framebuffer_callback(
+        rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, rpc_gui);
+}
+
+static void rpc_system_gui_screen_stream_stop(RpcGuiSystem* rpc_gui) {
+    rpc_gui->is_streaming = false;
+    // Remove GUI framebuffer callback
+    gui_remove_framebuffer_callback(
+        rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, rpc_gui);
+    // Stop and release worker thread
+    furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
+    furi_thread_join(rpc_gui->transmit_thread);
+    furi_thread_free(rpc_gui->transmit_thread);
+    // Release frame
+    pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
+    free(rpc_gui->transmit_frame);
+    rpc_gui->transmit_frame = NULL;
+    furi_mutex_free(rpc_gui->frame_mutex);
+    free(rpc_gui->frame_pending);
+    free(rpc_gui->frame_current);
+    free(rpc_gui->frame_previous);
+    // Release delta mode buffers
+    if(rpc_gui->compress) {
+        compress_free(rpc_gui->compress);
+        rpc_gui->compress = NULL;
+        free(rpc_gui->delta_buffer);
+        rpc_gui->delta_buffer = NULL;
+    }
+}
+
 static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -143,23 +290,7 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
             session, request->command_id, PB_CommandStatus_ERROR_VIRTUAL_DISPLAY_ALREADY_STARTED);
     } else {
         rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
-
-        rpc_gui->is_streaming = true;
-        size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
-        // Reusable Frame
-        rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
-        rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
-        rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
-        rpc_gui->transmit_frame->content.gui_screen_frame.data =
-            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
-        rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
-        // Transmission thread for async TX
-        rpc_gui->transmit_thread = furi_thread_alloc_ex(
-            "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
-        furi_thread_start(rpc_gui->transmit_thread);
-        // GUI framebuffer callback
-        gui_add_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
+        rpc_system_gui_screen_stream_start(rpc_gui);
     }
 }
 
@@ -174,18 +305,7 @@ static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, vo
     furi_assert(session);
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
 
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
@@ -449,18 +569,7 @@ void rpc_system_gui_free(void* context) {
     view_port_free(rpc_gui->rpc_session_active_viewport);
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
     furi_record_close(RECORD_GUI);
     free(rpc_gui);
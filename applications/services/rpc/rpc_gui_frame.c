@@ -0,0 +1,63 @@
+#include "rpc_gui_frame.h"
+
+#include <furi.h>
+
+static size_t rpc_gui_frame_encode_delta(
+    const uint8_t* current,
+    const uint8_t* previous,
+    size_t size,
+    uint8_t* delta_buffer) {
+    const size_t tiles = size / RPC_GUI_FRAME_TILE_SIZE;
+    uint8_t* mask = delta_buffer;
+    uint8_t* payload = &mask[(tiles + 7) / 8];
+
+    memset(mask, 0, (tiles + 7) / 8);
+    for(size_t tile = 0; tile < tiles; tile++) {
+        const uint8_t* current_tile = &current[tile * RPC_GUI_FRAME_TILE_SIZE];
+        const uint8_t* previous_tile = &previous[tile * RPC_GUI_FRAME_TILE_SIZE];
+        if(memcmp(current_tile, previous_tile, RPC_GUI_FRAME_TILE_SIZE) == 0) continue;
+
+        mask[tile / 8] |= 1 << (tile % 8);
+        for(size_t i = 0; i < RPC_GUI_FRAME_TILE_SIZE; i++) {
+            *payload++ = current_tile[i] ^ previous_tile[i];
+        }
+    }
+
+    return payload - delta_buffer;
+}
+
+size_t rpc_gui_frame_encode(
+    Compress* compress,
+    uint8_t* current,
+    const uint8_t* previous,
+    size_t size,
+    uint8_t* delta_buffer,
+    uint8_t* frame) {
+    furi_assert(compress);
+    furi_assert(current);
+    furi_assert(size % RPC_GUI_FRAME_TILE_SIZE == 0);
+    furi_assert(delta_buffer);
+    furi_assert(frame);
+
+    uint8_t* payload = current;
+    size_t payload_size = size;
+    if(previous) {
+        payload = delta_buffer;
+        payload_size = rpc_gui_frame_encode_delta(current, previous, size, delta_buffer);
+    }
+
+    size_t encoded_size = 0;
+    frame[0] = previous ? RpcGuiFrameTypeDelta : RpcGuiFrameTypeKey;
+    if(!compress_encode(
+           compress,
+           payload,
+           payload_size,
+           &frame[1],
+           RPC_GUI_FRAME_CAPACITY(size) - 1,
+           &encoded_size) ||
+       encoded_size + 1 >= size) {
+        return 0;
+    }
+
+    return encoded_size + 1;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file rpc_gui_frame.h
+ * Screen frame encoding for RpcScreenStreamModeDelta
+ *
+ * Kept free of firmware services, so host tools can build it as is,
+ * see scripts/screen_stream_test.py.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <toolbox/compress.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Screen frame data in RpcScreenStreamModeDelta:
+ * - framebuffer size: raw framebuffer, same as in RpcScreenStreamModeRaw
+ * - less than framebuffer size: RpcGuiFrameType byte, then compress_encode output of payload
+ *   - RpcGuiFrameTypeKey payload: framebuffer
+ *   - RpcGuiFrameTypeDelta payload: bitmask of changed tiles, LSB first, then
+ *     framebuffer XOR previous frame for every changed tile
+ * Reference decoder: scripts/flipper/utils/screen_stream.py, round trip with this
+ * encoder is checked by scripts/screen_stream_test.py.
+ */
+typedef enum {
+    RpcGuiFrameTypeKey = 0x01,
+    RpcGuiFrameTypeDelta = 0x02,
+} RpcGuiFrameType;
+
+#define RPC_GUI_FRAME_TILE_SIZE (16u)
+// compress_encode needs headroom over incompressible input
+#define RPC_GUI_FRAME_CAPACITY(framebuffer_size) ((framebuffer_size) * 2)
+#define RPC_GUI_FRAME_DELTA_BUFFER_SIZE(framebuffer_size) \
+    (((framebuffer_size) / RPC_GUI_FRAME_TILE_SIZE + 7) / 8 + (framebuffer_size))
+
+/** Encode framebuffer as key or delta frame
+ *
+ * @param      compress      Compress instance
+ * @param      current       framebuffer to encode
+ * @param      previous      previously sent framebuffer, NULL for key frame
+ * @param      size          framebuffer size, multiple of RPC_GUI_FRAME_TILE_SIZE
+ * @param      delta_buffer  RPC_GUI_FRAME_DELTA_BUFFER_SIZE(size) bytes of scratch space
+ * @param      frame         RPC_GUI_FRAME_CAPACITY(size) bytes for encoded frame
+ *
+ * @return     encoded frame size, 0 if it is not smaller than framebuffer,
+ *             raw framebuffer must be sent then
+ */
+size_t rpc_gui_frame_encode(
+    Compress* compress,
+    uint8_t* current,
+    const uint8_t* previous,
+    size_t size,
+    uint8_t* delta_buffer,
+    uint8_t* frame);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,9 @@
 #include <flipper.pb.h>
 #include <cli/cli.h>
 
+/* Storage read chunk size for USB sessions, host libraries there don't limit message size */
+#define RPC_STORAGE_DATA_SIZE_LARGE (4096)
+
 typedef void* (*RpcSystemAlloc)(RpcSession* session);
 typedef void (*RpcSystemFree)(void* context);
 typedef void (*PBMessageHandler)(const PB_Main* msg_request, void* context);
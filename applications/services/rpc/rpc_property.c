@@ -3,6 +3,8 @@
 #include <furi_hal_info.h>
 #include <furi_hal_power.h>
 #include <core/core_defines.h>
+#include <toolbox/profiler.h>
+#include <toolbox/property.h>
 
 #include "rpc_i.h"
 
@@ -11,6 +13,11 @@
 #define PROPERTY_CATEGORY_DEVICE_INFO "devinfo"
 #define PROPERTY_CATEGORY_POWER_INFO "pwrinfo"
 #define PROPERTY_CATEGORY_POWER_DEBUG "pwrdebug"
+#define PROPERTY_CATEGORY_PROFILER "profiler"
+#define PROPERTY_CATEGORY_HEAP_TRACE "heaptrace"
+
+#define PROPERTY_HEAP_TRACE_EVENTS_MAX (64U)
+#define PROPERTY_HEAP_TRACE_THREADS_MAX (32U)
 
 typedef struct {
     RpcSession* session;
@@ -41,6 +48,147 @@ static void
     }
 }
 
+static void rpc_system_property_get_profiler(PropertyValueCallback out, void* context) {
+    FuriString* value = furi_string_alloc();
+    FuriString* key = furi_string_alloc();
+    FuriString* histogram = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = '.', .last = false, .context = context};
+
+    property_value_out(&property_context, NULL, 2, "format", "major", "1");
+    property_value_out(&property_context, NULL, 2, "format", "minor", "0");
+
+    // New probes are added in front, so the list starting from here doesn't change
+    const ProfilerProbe* probes = profiler_get_probes();
+    size_t probe_count = 0;
+    for(const ProfilerProbe* probe = probes; probe; probe = probe->next) {
+        probe_count++;
+    }
+    property_context.last = (probe_count == 0);
+    property_value_out(&property_context, "%zu", 1, "probes", probe_count);
+
+    for(const ProfilerProbe* probe = probes; probe; probe = probe->next) {
+        const char* parent = probe->parent ? probe->parent->name : "";
+        property_value_out(&property_context, NULL, 2, probe->name, "parent", parent);
+        property_value_out(&property_context, "%lu", 2, probe->name, "count", probe->count);
+        property_value_out(
+            &property_context,
+            "%llu",
+            2,
+            probe->name,
+            "total_us",
+            profiler_ticks_to_us(probe->total));
+        property_value_out(
+            &property_context,
+            "%llu",
+            2,
+            probe->name,
+            "self_us",
+            profiler_ticks_to_us(profiler_probe_get_self(probe)));
+        property_value_out(
+            &property_context,
+            "%llu",
+            2,
+            probe->name,
+            "min_us",
+            profiler_ticks_to_us(probe->count ? probe->min : 0));
+        property_value_out(
+            &property_context,
+            "%llu",
+            2,
+            probe->name,
+            "max_us",
+            profiler_ticks_to_us(probe->max));
+
+        furi_string_reset(histogram);
+        for(size_t i = 0; i < PROFILER_HISTOGRAM_SIZE; i++) {
+            furi_string_cat_printf(histogram, i ? ",%lu" : "%lu", probe->histogram[i]);
+        }
+        property_context.last = (probe->next == NULL);
+        property_value_out(
+            &property_context, NULL, 2, probe->name, "histogram", furi_string_get_cstr(histogram));
+    }
+
+    furi_string_free(histogram);
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
+// Every request removes up to PROPERTY_HEAP_TRACE_EVENTS_MAX events, poll until none is left
+static void rpc_system_property_get_heap_trace(PropertyValueCallback out, void* context) {
+    FuriString* value = furi_string_alloc();
+    FuriString* key = furi_string_alloc();
+    FuriString* key_part = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = '.', .last = false, .context = context};
+
+    property_value_out(&property_context, NULL, 2, "format", "major", "1");
+    property_value_out(&property_context, NULL, 2, "format", "minor", "0");
+
+    // Read out before sending, so the events recorded while sending stay for the next request
+    MemmgrHeapTraceEvent* events =
+        malloc(sizeof(MemmgrHeapTraceEvent) * PROPERTY_HEAP_TRACE_EVENTS_MAX);
+    const size_t event_count = memmgr_heap_trace_read(events, PROPERTY_HEAP_TRACE_EVENTS_MAX);
+
+    FuriThreadId thread_ids[PROPERTY_HEAP_TRACE_THREADS_MAX];
+    const size_t thread_count = furi_thread_enumerate(thread_ids, PROPERTY_HEAP_TRACE_THREADS_MAX);
+    for(size_t i = 0; i < thread_count; i++) {
+        furi_string_printf(key_part, "%08lx", (uint32_t)thread_ids[i]);
+        property_value_out(
+            &property_context,
+            "%s %s",
+            2,
+            "thread",
+            furi_string_get_cstr(key_part),
+            furi_thread_get_appid(thread_ids[i]),
+            furi_thread_get_name(thread_ids[i]));
+    }
+
+    property_value_out(
+        &property_context, NULL, 1, "running", memmgr_heap_trace_is_running() ? "1" : "0");
+    property_context.last = (event_count == 0);
+    property_value_out(
+        &property_context, "%lu", 1, "dropped", memmgr_heap_trace_get_dropped_count());
+
+    // Values use the line format of the heap_trace CLI command
+    for(size_t i = 0; i < event_count; i++) {
+        const MemmgrHeapTraceEvent* event = &events[i];
+        furi_string_printf(key_part, "%zu", i);
+        property_context.last = (i + 1 == event_count);
+        if(event->type == MemmgrHeapTraceEventAlloc) {
+            property_value_out(
+                &property_context,
+                "A %lu %08lx %lu %08lx %08lx",
+                2,
+                "event",
+                furi_string_get_cstr(key_part),
+                event->tick,
+                event->pointer,
+                (uint32_t)event->size,
+                event->caller,
+                event->thread);
+        } else {
+            property_value_out(
+                &property_context,
+                "F %lu %08lx %08lx %08lx",
+                2,
+                "event",
+                furi_string_get_cstr(key_part),
+                event->tick,
+                event->pointer,
+                event->caller,
+                event->thread);
+        }
+    }
+
+    free(events);
+    furi_string_free(key_part);
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
 static void rpc_system_property_get_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(request->which_content == PB_Main_property_get_request_tag);
@@ -81,6 +229,10 @@ static void rpc_system_property_get_process(const PB_Main* request, void* contex
         furi_hal_power_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_POWER_DEBUG)) {
         furi_hal_power_debug_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_PROFILER)) {
+        rpc_system_property_get_profiler(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_HEAP_TRACE)) {
+        rpc_system_property_get_heap_trace(rpc_system_property_get_callback, &property_context);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
@@ -1,6 +1,7 @@
 #include <core/common_defines.h>
 #include <core/memmgr.h>
 #include <core/record.h>
+#include <core/semaphore.h>
 #include <rpc/rpc.h>
 #include <rpc/rpc_i.h>
 #include <storage/filesystem_api_defines.h>
@@ -18,6 +19,7 @@
 #define MAX_NAME_LENGTH 254
 
 static const size_t MAX_DATA_SIZE = 512;
+static const size_t MAX_DATA_SIZE_LARGE = RPC_STORAGE_DATA_SIZE_LARGE;
 
 typedef enum {
     RpcStorageStateIdle = 0,
@@ -354,6 +356,13 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     furi_record_close(RECORD_STORAGE);
 }
 
+static void rpc_system_storage_read_callback(StorageOp* ops, size_t executed, void* context) {
+    UNUSED(ops);
+    UNUSED(executed);
+    FuriSemaphore* read_done = context;
+    furi_semaphore_release(read_done);
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -367,7 +376,7 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     rpc_system_storage_reset_state(rpc_storage, session, true);
 
-    /* use same message memory to send response */
+    /* use same message memory and data buffer to send all response chunks */
     PB_Main* response = malloc(sizeof(PB_Main));
     const char* path = request->content.storage_read_request.path;
     Storage* fs_api = furi_record_open(RECORD_STORAGE);
@@ -376,37 +385,53 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
+        const size_t chunk_size = rpc_session_get_owner(session) == RpcOwnerUsb ?
+                                      MAX_DATA_SIZE_LARGE :
+                                      MAX_DATA_SIZE;
+        const size_t data_alloc_size = PB_BYTES_ARRAY_T_ALLOCSIZE(MIN(size_left, chunk_size));
+        // Storage reads next chunk into one buffer while the other one is being sent
+        pb_bytes_array_t* data[2] = {malloc(data_alloc_size), malloc(data_alloc_size)};
+        size_t data_idx = 0;
+        FuriSemaphore* read_done = furi_semaphore_alloc(1, 0);
+        StorageOp read_op = {
+            .type = StorageOpTypeRead,
+            .read = {file, data[data_idx]->bytes, MIN(size_left, chunk_size)},
+        };
+
+        response->command_id = request->command_id;
+        response->which_content = PB_Main_storage_read_response_tag;
+        response->command_status = PB_CommandStatus_OK;
+        response->content.storage_read_response.has_file = true;
+
+        storage_batch_submit(
+            fs_api, &read_op, 1, true, rpc_system_storage_read_callback, read_done);
+
         do {
-            response->command_id = request->command_id;
-            response->which_content = PB_Main_storage_read_response_tag;
-            response->command_status = PB_CommandStatus_OK;
-
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
+            furi_check(furi_semaphore_acquire(read_done, FuriWaitForever) == FuriStatusOk);
+
+            pb_bytes_array_t* data_read = data[data_idx];
+            data_read->size = read_op.result;
+            size_left -= read_op.result;
+            fs_operation_success = (read_op.result == read_op.read.size);
+            response->has_next = fs_operation_success && (size_left > 0);
+
+            if(response->has_next) {
+                data_idx ^= 1;
+                read_op.read.buffer = data[data_idx]->bytes;
+                read_op.read.size = MIN(size_left, chunk_size);
+                storage_batch_submit(
+                    fs_api, &read_op, 1, true, rpc_system_storage_read_callback, read_done);
             }
 
             if(fs_operation_success) {
-                rpc_send_and_release(session, response);
+                response->content.storage_read_response.file.data = data_read;
+                rpc_send(session, response);
             }
-        } while((size_left != 0) && fs_operation_success);
+        } while(response->has_next);
+
+        furi_semaphore_free(read_done);
+        free(data[0]);
+        free(data[1]);
     }
 
     if(!fs_operation_success) {
@@ -36,6 +36,7 @@ Storage* storage_app_alloc() {
     Storage* app = malloc(sizeof(Storage));
     app->message_queue = furi_message_queue_alloc(8, sizeof(StorageMessage));
     app->pubsub = furi_pubsub_alloc();
+    app->dir_cache = storage_dir_cache_alloc();
 
     for(uint8_t i = 0; i < STORAGE_COUNT; i++) {
         storage_data_init(&app->storage[i]);
@@ -71,6 +72,7 @@ void storage_tick(Storage* app) {
         view_port_enabled_set(app->sd_gui.view_port, false);
 
         FURI_LOG_I(TAG, "SD card unmount");
+        storage_dir_cache_reset(app->dir_cache);
         StorageEvent event = {.type = StorageEventTypeCardUnmount};
         furi_pubsub_publish(app->pubsub, &event);
     }
@@ -84,6 +86,7 @@ void storage_tick(Storage* app) {
        app->sd_gui.enabled == false) {
         app->sd_gui.enabled = true;
         view_port_enabled_set(app->sd_gui.view_port, true);
+        storage_dir_cache_reset(app->dir_cache);
 
         if(app->storage[ST_EXT].status == StorageStatusOK) {
             FURI_LOG_I(TAG, "SD card mount");
@@ -445,6 +445,122 @@ bool storage_common_equivalent_path(
     const char* path2,
     bool truncate);
 
+/******************* Batch Functions *******************/
+
+/**
+ * @brief Enumeration of operations that can be executed in a batch.
+ */
+typedef enum {
+    StorageOpTypeRead, /**< Read data from an open file. */
+    StorageOpTypeWrite, /**< Write data to an open file. */
+    StorageOpTypeSeek, /**< Change access position of an open file. */
+    StorageOpTypeStat, /**< Get information about a file or a directory by path. */
+    StorageOpTypeDirRead, /**< Get the next item of an open directory. */
+} StorageOpType;
+
+/**
+ * @brief Single operation of a batch, with its arguments and results.
+ */
+typedef struct {
+    StorageOpType type; /**< Operation type, selects the argument structure. */
+    union {
+        struct {
+            File* file;
+            void* buffer;
+            size_t size;
+        } read;
+        struct {
+            File* file;
+            const void* buffer;
+            size_t size;
+        } write;
+        struct {
+            File* file;
+            uint32_t offset;
+            bool from_start;
+        } seek;
+        struct {
+            const char* path;
+            FileInfo* fileinfo;
+        } stat;
+        struct {
+            File* file;
+            FileInfo* fileinfo; /**< may be NULL */
+            char* name; /**< may be NULL */
+            uint16_t name_length;
+        } dir_read;
+    };
+    size_t result; /**< Filled by storage: bytes transferred, or 1 on success. */
+    FS_Error error; /**< Filled by storage: operation error. */
+} StorageOp;
+
+/**
+ * @brief Batch completion callback, called from the storage service thread.
+ *
+ * @param ops pointer to the submitted operations, with results filled in.
+ * @param executed number of executed operations.
+ * @param context pointer to a user-specified context object.
+ */
+typedef void (*StorageBatchCallback)(StorageOp* ops, size_t executed, void* context);
+
+/**
+ * @brief Execute several operations in one storage service request.
+ *
+ * Operations are executed in order. Reads and writes that transfer fewer bytes
+ * than requested are not considered errors, check the result of each operation.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param ops pointer to an array of operations.
+ * @param count number of operations in the array.
+ * @param stop_on_error whether to skip the remaining operations after the first failed one.
+ * @return number of executed operations.
+ */
+size_t storage_batch(Storage* storage, StorageOp* ops, size_t count, bool stop_on_error);
+
+/**
+ * @brief Submit several operations for asynchronous execution.
+ *
+ * The function returns as soon as the request is queued. Operations, their
+ * buffers, paths and files must stay valid until the callback is called.
+ * Requests of one thread are executed in submission order.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param ops pointer to an array of operations.
+ * @param count number of operations in the array.
+ * @param stop_on_error whether to skip the remaining operations after the first failed one.
+ * @param callback pointer to a completion callback function (may be NULL).
+ * @param context pointer to a user-specified context object, passed to the callback.
+ */
+void storage_batch_submit(
+    Storage* storage,
+    StorageOp* ops,
+    size_t count,
+    bool stop_on_error,
+    StorageBatchCallback callback,
+    void* context);
+
+/******************* Directory Cache Functions *******************/
+
+/**
+ * @brief Directory listing cache counters.
+ */
+typedef struct {
+    uint32_t hits; /**< Directory opens served from the cache. */
+    uint32_t misses; /**< Directory opens served by the filesystem. */
+    uint32_t invalidations; /**< Listings dropped because of changes. */
+    uint32_t evictions; /**< Listings dropped to fit into the memory cap. */
+    uint32_t directories; /**< Currently cached directories. */
+    uint32_t size; /**< Currently used memory, in bytes. */
+} StorageDirCacheStats;
+
+/**
+ * @brief Get directory listing cache counters.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param stats pointer to the structure to be filled.
+ */
+void storage_get_dir_cache_stats(Storage* storage, StorageDirCacheStats* stats);
+
 /******************* Error Functions *******************/
 
 /**
@@ -10,6 +10,7 @@
 #include <power/power_service/power.h>
 
 #define MAX_NAME_LENGTH 254
+#define WRITE_CHUNKS_BUFFER_SIZE 4096U
 
 static void storage_cli_print_usage() {
     printf("Usage:\r\n");
@@ -23,10 +24,12 @@ static void storage_cli_print_usage() {
     printf("\tremove\t - delete the file or directory\r\n");
     printf("\tread\t - read text from file and print file size and content to cli\r\n");
     printf(
-        "\tread_chunks\t - read data from file and print file size and content to cli, <args> should contain how many bytes you want to read in block\r\n");
+        "\tread_chunks\t - read data from file and print file size and content to cli, <args> should contain how many bytes you want to read in block and, optionally, how many blocks can be in flight\r\n");
     printf("\twrite\t - read text from cli and append it to file, stops by ctrl+c\r\n");
     printf(
         "\twrite_chunk\t - read data from cli and append it to file, <args> should contain how many bytes you want to write\r\n");
+    printf(
+        "\twrite_chunks\t - read data from cli and write it to new file, <args> should contain file size\r\n");
     printf("\tcopy\t - copy file to new file, <args> must contain new path\r\n");
     printf("\trename\t - move file to new file, <args> must contain new path\r\n");
     printf(
@@ -85,8 +88,22 @@ static void storage_cli_info(Cli* cli, FuriString* path) {
         }
     } else {
         storage_cli_print_usage();
+        furi_record_close(RECORD_STORAGE);
+        return;
     }
 
+    StorageDirCacheStats cache_stats;
+    storage_get_dir_cache_stats(api, &cache_stats);
+    printf(
+        "Dir cache: %lu hits, %lu misses, %lu invalidations, %lu evictions\r\n"
+        "%lu dirs cached, %lu bytes\r\n",
+        cache_stats.hits,
+        cache_stats.misses,
+        cache_stats.invalidations,
+        cache_stats.evictions,
+        cache_stats.directories,
+        cache_stats.size);
+
     furi_record_close(RECORD_STORAGE);
 }
 
@@ -284,30 +301,62 @@ static void storage_cli_read_chunks(Cli* cli, FuriString* path, FuriString* args
     File* file = storage_file_alloc(api);
 
     uint32_t buffer_size;
-    int parsed_count = sscanf(furi_string_get_cstr(args), "%lu", &buffer_size);
+    uint32_t window = 0;
+    int parsed_count = sscanf(furi_string_get_cstr(args), "%lu %lu", &buffer_size, &window);
 
-    if(parsed_count != 1) {
+    if(parsed_count < 1) {
         storage_cli_print_usage();
     } else if(storage_file_open(file, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
         uint64_t file_size = storage_file_size(file);
 
         printf("Size: %llu\r\n", file_size);
+        if(window) {
+            printf("Window: %lu\r\n", window);
+        }
 
+        FS_Error error = FSE_OK;
         if(buffer_size) {
             uint8_t* data = malloc(buffer_size);
+            // In windowed mode host acknowledges every chunk, wait only when window is full
+            uint32_t credits = window;
             while(file_size > 0) {
-                printf("\r\nReady?\r\n");
-                cli_getc(cli);
+                if(window) {
+                    if(!credits) {
+                        if(!cli_getc(cli)) break;
+                        credits++;
+                    }
+                    credits--;
+                } else {
+                    printf("\r\nReady?\r\n");
+                    cli_getc(cli);
+                }
 
-                size_t read_size = storage_file_read(file, data, buffer_size);
-                for(size_t i = 0; i < read_size; i++) {
-                    putchar(data[i]);
+                // Host waits for the announced size, so a failed read is padded and
+                // reported after the data
+                const size_t chunk_size = MIN(file_size, buffer_size);
+                size_t read_size = 0;
+                if(error == FSE_OK) {
+                    read_size = storage_file_read(file, data, chunk_size);
+                    if(read_size != chunk_size) {
+                        error = storage_file_get_error(file);
+                        if(error == FSE_OK) error = FSE_INTERNAL;
+                    }
                 }
-                file_size -= read_size;
+                memset(&data[read_size], 0, chunk_size - read_size);
+                fflush(stdout);
+                cli_write(cli, data, chunk_size);
+                file_size -= chunk_size;
+            }
+            // Collect acknowledges of chunks still in flight
+            while(credits < window && cli_getc(cli)) {
+                credits++;
             }
             free(data);
         }
         printf("\r\n");
+        if(error != FSE_OK) {
+            storage_cli_print_error(error);
+        }
 
     } else {
         storage_cli_print_error(storage_file_get_error(file));
@@ -355,6 +404,48 @@ static void storage_cli_write_chunk(Cli* cli, FuriString* path, FuriString* args
     furi_record_close(RECORD_STORAGE);
 }
 
+static void storage_cli_write_chunks(Cli* cli, FuriString* path, FuriString* args) {
+    Storage* api = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(api);
+
+    uint32_t file_size;
+    int parsed_count = sscanf(furi_string_get_cstr(args), "%lu", &file_size);
+
+    if(parsed_count != 1) {
+        storage_cli_print_usage();
+    } else {
+        if(storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            printf("Ready\r\n");
+
+            // Data is streamed by host without pauses, write errors still consume all of it
+            uint8_t* buffer = malloc(WRITE_CHUNKS_BUFFER_SIZE);
+            bool success = true;
+
+            while(file_size > 0) {
+                size_t read_bytes =
+                    cli_read(cli, buffer, MIN(file_size, WRITE_CHUNKS_BUFFER_SIZE));
+                if(!read_bytes) break;
+                if(success) {
+                    success = (storage_file_write(file, buffer, read_bytes) == read_bytes);
+                }
+                file_size -= read_bytes;
+            }
+
+            if(!success) {
+                storage_cli_print_error(storage_file_get_error(file));
+            }
+
+            free(buffer);
+        } else {
+            storage_cli_print_error(storage_file_get_error(file));
+        }
+        storage_file_close(file);
+    }
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 static void storage_cli_stat(Cli* cli, FuriString* path) {
     UNUSED(cli);
     Storage* api = furi_record_open(RECORD_STORAGE);
@@ -577,6 +668,11 @@ void storage_cli(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "write_chunks") == 0) {
+            storage_cli_write_chunks(cli, path, args);
+            break;
+        }
+
         if(furi_string_cmp_str(cmd, "copy") == 0) {
             storage_cli_copy(cli, path, args);
             break;
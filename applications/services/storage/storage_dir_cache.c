@@ -0,0 +1,447 @@
+#include "storage_dir_cache.h"
+#include <m-array.h>
+
+#define TAG "StorageDirCache"
+
+/* Listing item: flags (1 byte), size (8 bytes), zero-terminated name */
+#define ITEM_HEADER_SIZE (1 + sizeof(uint64_t))
+
+typedef struct {
+    FuriString* path;
+    uint8_t* data;
+    size_t size;
+    uint32_t last_used;
+    uint32_t readers;
+    bool detached; /**< removed from the cache, freed by the last reader */
+} StorageDirListing;
+
+typedef enum {
+    StorageDirCursorTypeCached, /**< listing served from the cache */
+    StorageDirCursorTypeRecord, /**< listing recorded from filesystem reads */
+    StorageDirCursorTypeBypass, /**< recording aborted or not possible */
+    StorageDirCursorTypeWriter, /**< file open for writing */
+} StorageDirCursorType;
+
+typedef struct {
+    File* file;
+    StorageDirCursorType type;
+    FuriString* path;
+    StorageDirListing* listing;
+    size_t offset;
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+} StorageDirCursor;
+
+ARRAY_DEF(StorageDirCursorArray, StorageDirCursor, M_POD_OPLIST)
+
+struct StorageDirCache {
+    StorageDirListing* listings[STORAGE_DIR_CACHE_DIRS];
+    StorageDirCursorArray_t cursors;
+    char record_name[STORAGE_DIR_CACHE_NAME_MAX]; /**< off the storage thread stack */
+    uint32_t use_counter;
+    StorageDirCacheStats stats;
+};
+
+/******************* Paths *******************/
+
+static void storage_dir_cache_trim_path(FuriString* path) {
+    while(furi_string_size(path) > 1 && furi_string_end_with(path, "/")) {
+        furi_string_left(path, furi_string_size(path) - 1);
+    }
+}
+
+// Paths with relative or empty components can't be matched on invalidation
+static bool storage_dir_cache_path_is_cacheable(FuriString* path) {
+    const char* cstr = furi_string_get_cstr(path);
+    return strstr(cstr, "//") == NULL && strstr(cstr, "/./") == NULL &&
+           strstr(cstr, "/../") == NULL && !furi_string_end_with(path, "/.") &&
+           !furi_string_end_with(path, "/..");
+}
+
+/* FAT names are case insensitive, so invalidation matches paths ignoring case.
+ * That is only more conservative for case sensitive filesystems. */
+static bool storage_dir_cache_path_is_affected(FuriString* listing_path, FuriString* path) {
+    const char* listing_cstr = furi_string_get_cstr(listing_path);
+    const char* path_cstr = furi_string_get_cstr(path);
+    const size_t listing_len = furi_string_size(listing_path);
+    const size_t path_len = furi_string_size(path);
+
+    // Listing of the path itself or of its subdirectory
+    if(listing_len >= path_len && strncasecmp(listing_cstr, path_cstr, path_len) == 0 &&
+       (listing_len == path_len || listing_cstr[path_len] == '/')) {
+        return true;
+    }
+
+    // Listing of the parent directory
+    const char* name = strrchr(path_cstr, '/');
+    if(name) {
+        const size_t parent_len = name - path_cstr;
+        return listing_len == parent_len && strncasecmp(listing_cstr, path_cstr, parent_len) == 0;
+    }
+
+    return false;
+}
+
+/******************* Listings *******************/
+
+static void storage_dir_cache_listing_free(StorageDirListing* listing) {
+    furi_string_free(listing->path);
+    free(listing->data);
+    free(listing);
+}
+
+static void storage_dir_cache_detach(StorageDirCache* cache, size_t index) {
+    StorageDirListing* listing = cache->listings[index];
+    cache->listings[index] = NULL;
+    cache->stats.directories--;
+    cache->stats.size -= listing->size;
+
+    if(listing->readers) {
+        listing->detached = true;
+    } else {
+        storage_dir_cache_listing_free(listing);
+    }
+}
+
+static StorageDirListing* storage_dir_cache_find(StorageDirCache* cache, FuriString* path) {
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+        if(cache->listings[i] && furi_string_equal(cache->listings[i]->path, path)) {
+            return cache->listings[i];
+        }
+    }
+    return NULL;
+}
+
+static bool storage_dir_cache_has_writer(StorageDirCache* cache, FuriString* path) {
+    StorageDirCursorArray_it_t it;
+    for(StorageDirCursorArray_it(it, cache->cursors); !StorageDirCursorArray_end_p(it);
+        StorageDirCursorArray_next(it)) {
+        const StorageDirCursor* cursor = StorageDirCursorArray_cref(it);
+        if(cursor->type == StorageDirCursorTypeWriter &&
+           storage_dir_cache_path_is_affected(path, cursor->path)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void storage_dir_cache_insert(StorageDirCache* cache, StorageDirCursor* cursor) {
+    if(storage_dir_cache_has_writer(cache, cursor->path)) {
+        return;
+    }
+
+    // Evict least recently used listings until the new one fits
+    while(true) {
+        size_t free_slot = STORAGE_DIR_CACHE_DIRS;
+        size_t lru_slot = STORAGE_DIR_CACHE_DIRS;
+        for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+            if(!cache->listings[i]) {
+                free_slot = i;
+            } else if(
+                lru_slot == STORAGE_DIR_CACHE_DIRS ||
+                cache->listings[i]->last_used < cache->listings[lru_slot]->last_used) {
+                lru_slot = i;
+            }
+        }
+
+        if(free_slot != STORAGE_DIR_CACHE_DIRS &&
+           cache->stats.size + cursor->size <= STORAGE_DIR_CACHE_SIZE) {
+            StorageDirListing* listing = malloc(sizeof(StorageDirListing));
+            listing->path = cursor->path;
+            listing->data = cursor->data;
+            listing->size = cursor->size;
+            listing->last_used = ++cache->use_counter;
+            listing->readers = 0;
+            listing->detached = false;
+            cache->listings[free_slot] = listing;
+            cache->stats.directories++;
+            cache->stats.size += listing->size;
+
+            // Ownership moved to the listing
+            cursor->path = NULL;
+            cursor->data = NULL;
+            break;
+        }
+
+        furi_check(lru_slot != STORAGE_DIR_CACHE_DIRS);
+        storage_dir_cache_detach(cache, lru_slot);
+        cache->stats.evictions++;
+    }
+}
+
+/******************* Cursors *******************/
+
+static StorageDirCursor* storage_dir_cache_get_cursor(StorageDirCache* cache, File* file) {
+    StorageDirCursorArray_it_t it;
+    for(StorageDirCursorArray_it(it, cache->cursors); !StorageDirCursorArray_end_p(it);
+        StorageDirCursorArray_next(it)) {
+        StorageDirCursor* cursor = StorageDirCursorArray_ref(it);
+        if(cursor->file == file) {
+            return cursor;
+        }
+    }
+    return NULL;
+}
+
+static void storage_dir_cache_cursor_bypass(StorageDirCursor* cursor) {
+    free(cursor->data);
+    cursor->data = NULL;
+    cursor->size = 0;
+    cursor->capacity = 0;
+    cursor->type = StorageDirCursorTypeBypass;
+}
+
+static void storage_dir_cache_remove_cursor(StorageDirCache* cache, File* file) {
+    for(size_t i = 0; i < StorageDirCursorArray_size(cache->cursors); i++) {
+        StorageDirCursor* cursor = StorageDirCursorArray_get(cache->cursors, i);
+        if(cursor->file != file) {
+            continue;
+        }
+
+        if(cursor->listing) {
+            cursor->listing->readers--;
+            if(cursor->listing->detached && !cursor->listing->readers) {
+                storage_dir_cache_listing_free(cursor->listing);
+            }
+        }
+        if(cursor->path) {
+            furi_string_free(cursor->path);
+        }
+        free(cursor->data);
+        StorageDirCursorArray_erase(cache->cursors, i);
+        break;
+    }
+}
+
+static StorageDirCursor*
+    storage_dir_cache_add_cursor(StorageDirCache* cache, File* file, StorageDirCursorType type) {
+    // Stale cursor of a file that was not closed properly
+    storage_dir_cache_remove_cursor(cache, file);
+
+    StorageDirCursor* cursor = StorageDirCursorArray_push_new(cache->cursors);
+    memset(cursor, 0, sizeof(StorageDirCursor));
+    cursor->file = file;
+    cursor->type = type;
+    return cursor;
+}
+
+/******************* API *******************/
+
+StorageDirCache* storage_dir_cache_alloc(void) {
+    StorageDirCache* cache = malloc(sizeof(StorageDirCache));
+    StorageDirCursorArray_init(cache->cursors);
+    return cache;
+}
+
+void storage_dir_cache_free(StorageDirCache* cache) {
+    while(StorageDirCursorArray_size(cache->cursors)) {
+        storage_dir_cache_remove_cursor(
+            cache, StorageDirCursorArray_get(cache->cursors, 0)->file);
+    }
+    storage_dir_cache_reset(cache);
+    StorageDirCursorArray_clear(cache->cursors);
+    free(cache);
+}
+
+bool storage_dir_cache_open(StorageDirCache* cache, File* file, FuriString* path) {
+    FuriString* key = furi_string_alloc_set(path);
+    storage_dir_cache_trim_path(key);
+
+    if(!storage_dir_cache_path_is_cacheable(key)) {
+        storage_dir_cache_remove_cursor(cache, file);
+        furi_string_free(key);
+        return false;
+    }
+
+    StorageDirListing* listing = storage_dir_cache_find(cache, key);
+    if(listing) {
+        cache->stats.hits++;
+        StorageDirCursor* cursor =
+            storage_dir_cache_add_cursor(cache, file, StorageDirCursorTypeCached);
+        cursor->listing = listing;
+        listing->readers++;
+        listing->last_used = ++cache->use_counter;
+        furi_string_free(key);
+    } else {
+        cache->stats.misses++;
+        StorageDirCursor* cursor =
+            storage_dir_cache_add_cursor(cache, file, StorageDirCursorTypeRecord);
+        cursor->path = key;
+    }
+
+    return listing != NULL;
+}
+
+bool storage_dir_cache_close(StorageDirCache* cache, File* file) {
+    StorageDirCursor* cursor = storage_dir_cache_get_cursor(cache, file);
+    const bool cached = cursor && cursor->type == StorageDirCursorTypeCached;
+    storage_dir_cache_remove_cursor(cache, file);
+    return cached;
+}
+
+bool storage_dir_cache_read(
+    StorageDirCache* cache,
+    File* file,
+    FileInfo* fileinfo,
+    char* name,
+    uint16_t name_length,
+    bool* result) {
+    StorageDirCursor* cursor = storage_dir_cache_get_cursor(cache, file);
+    if(!cursor || cursor->type != StorageDirCursorTypeCached) {
+        return false;
+    }
+
+    const StorageDirListing* listing = cursor->listing;
+    if(cursor->offset >= listing->size) {
+        // Same as filesystems report the end of a directory
+        if(name && name_length) {
+            name[0] = '\0';
+        }
+        file->error_id = FSE_NOT_EXIST;
+        *result = false;
+        return true;
+    }
+
+    const uint8_t* item = listing->data + cursor->offset;
+    const char* item_name = (const char*)item + ITEM_HEADER_SIZE;
+    if(fileinfo) {
+        fileinfo->flags = item[0];
+        memcpy(&fileinfo->size, item + 1, sizeof(uint64_t));
+    }
+    if(name) {
+        snprintf(name, name_length, "%s", item_name);
+    }
+
+    cursor->offset += ITEM_HEADER_SIZE + strlen(item_name) + 1;
+    file->error_id = FSE_OK;
+    *result = true;
+    return true;
+}
+
+bool storage_dir_cache_rewind(StorageDirCache* cache, File* file) {
+    StorageDirCursor* cursor = storage_dir_cache_get_cursor(cache, file);
+    if(!cursor) {
+        return false;
+    }
+
+    if(cursor->type == StorageDirCursorTypeCached) {
+        cursor->offset = 0;
+        file->error_id = FSE_OK;
+        return true;
+    } else if(cursor->type == StorageDirCursorTypeRecord) {
+        // Filesystem starts from the first item again
+        cursor->size = 0;
+    }
+
+    return false;
+}
+
+char* storage_dir_cache_record_buffer(StorageDirCache* cache, File* file) {
+    StorageDirCursor* cursor = storage_dir_cache_get_cursor(cache, file);
+    return (cursor && cursor->type == StorageDirCursorTypeRecord) ? cache->record_name : NULL;
+}
+
+void storage_dir_cache_record(
+    StorageDirCache* cache,
+    File* file,
+    bool result,
+    const FileInfo* fileinfo,
+    const char* name) {
+    StorageDirCursor* cursor = storage_dir_cache_get_cursor(cache, file);
+    if(!cursor || cursor->type != StorageDirCursorTypeRecord) {
+        return;
+    }
+
+    if(!result) {
+        if(file->error_id == FSE_NOT_EXIST) {
+            // Whole directory was read
+            storage_dir_cache_insert(cache, cursor);
+        }
+        storage_dir_cache_cursor_bypass(cursor);
+        return;
+    }
+
+    const size_t item_size = ITEM_HEADER_SIZE + strlen(name) + 1;
+    if(cursor->size + item_size > STORAGE_DIR_CACHE_SIZE) {
+        // Too large for the cache
+        storage_dir_cache_cursor_bypass(cursor);
+        return;
+    }
+
+    if(cursor->size + item_size > cursor->capacity) {
+        cursor->capacity = MIN(MAX(cursor->capacity * 2, 256U), STORAGE_DIR_CACHE_SIZE);
+        cursor->data = realloc(cursor->data, cursor->capacity); //-V701
+    }
+
+    uint8_t* item = cursor->data + cursor->size;
+    item[0] = fileinfo->flags;
+    memcpy(item + 1, &fileinfo->size, sizeof(uint64_t));
+    memcpy(item + ITEM_HEADER_SIZE, name, item_size - ITEM_HEADER_SIZE);
+    cursor->size += item_size;
+}
+
+void storage_dir_cache_writer_open(StorageDirCache* cache, File* file, FuriString* path) {
+    storage_dir_cache_invalidate(cache, path);
+    StorageDirCursor* cursor =
+        storage_dir_cache_add_cursor(cache, file, StorageDirCursorTypeWriter);
+    cursor->path = furi_string_alloc_set(path);
+}
+
+void storage_dir_cache_writer_close(StorageDirCache* cache, File* file) {
+    StorageDirCursor* cursor = storage_dir_cache_get_cursor(cache, file);
+    if(cursor && cursor->type == StorageDirCursorTypeWriter) {
+        // Size of the file is changed
+        FuriString* path = furi_string_alloc_set(cursor->path);
+        storage_dir_cache_remove_cursor(cache, file);
+        storage_dir_cache_invalidate(cache, path);
+        furi_string_free(path);
+    }
+}
+
+void storage_dir_cache_invalidate(StorageDirCache* cache, FuriString* path) {
+    FuriString* key = furi_string_alloc_set(path);
+    storage_dir_cache_trim_path(key);
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+        if(cache->listings[i] &&
+           storage_dir_cache_path_is_affected(cache->listings[i]->path, key)) {
+            storage_dir_cache_detach(cache, i);
+            cache->stats.invalidations++;
+        }
+    }
+
+    // Listings that are being recorded may already miss the change
+    StorageDirCursorArray_it_t it;
+    for(StorageDirCursorArray_it(it, cache->cursors); !StorageDirCursorArray_end_p(it);
+        StorageDirCursorArray_next(it)) {
+        StorageDirCursor* cursor = StorageDirCursorArray_ref(it);
+        if(cursor->type == StorageDirCursorTypeRecord &&
+           storage_dir_cache_path_is_affected(cursor->path, key)) {
+            storage_dir_cache_cursor_bypass(cursor);
+        }
+    }
+
+    furi_string_free(key);
+}
+
+void storage_dir_cache_reset(StorageDirCache* cache) {
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+        if(cache->listings[i]) {
+            storage_dir_cache_detach(cache, i);
+        }
+    }
+
+    StorageDirCursorArray_it_t it;
+    for(StorageDirCursorArray_it(it, cache->cursors); !StorageDirCursorArray_end_p(it);
+        StorageDirCursorArray_next(it)) {
+        StorageDirCursor* cursor = StorageDirCursorArray_ref(it);
+        if(cursor->type == StorageDirCursorTypeRecord) {
+            storage_dir_cache_cursor_bypass(cursor);
+        }
+    }
+}
+
+void storage_dir_cache_get_stats(StorageDirCache* cache, StorageDirCacheStats* stats) {
+    *stats = cache->stats;
+}
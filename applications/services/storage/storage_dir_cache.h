@@ -0,0 +1,102 @@
+#pragma once
+#include <furi.h>
+#include "storage.h"
+#include "filesystem_api_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Memory cap for cached directory listings, in bytes */
+#define STORAGE_DIR_CACHE_SIZE (8 * 1024)
+/** Maximum number of cached directories */
+#define STORAGE_DIR_CACHE_DIRS 8
+/** Name buffer size used while a listing is recorded */
+#define STORAGE_DIR_CACHE_NAME_MAX 256
+
+/**
+ * Directory listings cache, used only from the storage service thread.
+ *
+ * Listing is recorded while a directory is enumerated from the start to the end,
+ * next opens of the same path are served from RAM without filesystem calls.
+ * Listings are invalidated by changes of their contents, see storage_dir_cache_invalidate.
+ */
+typedef struct StorageDirCache StorageDirCache;
+
+StorageDirCache* storage_dir_cache_alloc(void);
+
+void storage_dir_cache_free(StorageDirCache* cache);
+
+/**
+ * Start directory enumeration
+ * @param cache cache instance
+ * @param file directory file
+ * @param path resolved directory path
+ * @return true if the listing is served from the cache and the filesystem must not be used
+ */
+bool storage_dir_cache_open(StorageDirCache* cache, File* file, FuriString* path);
+
+/**
+ * Finish directory enumeration
+ * @return true if the listing was served from the cache
+ */
+bool storage_dir_cache_close(StorageDirCache* cache, File* file);
+
+/**
+ * Read next item of a cached listing
+ * @param result output for read result, set only if the listing is served from the cache
+ * @return true if the listing is served from the cache
+ */
+bool storage_dir_cache_read(
+    StorageDirCache* cache,
+    File* file,
+    FileInfo* fileinfo,
+    char* name,
+    uint16_t name_length,
+    bool* result);
+
+/**
+ * Rewind cached listing or restart recording
+ * @return true if the listing is served from the cache
+ */
+bool storage_dir_cache_rewind(StorageDirCache* cache, File* file);
+
+/**
+ * Get name buffer for a filesystem read that must be passed to storage_dir_cache_record
+ * @return buffer of STORAGE_DIR_CACHE_NAME_MAX bytes, NULL if the listing is not recorded
+ */
+char* storage_dir_cache_record_buffer(StorageDirCache* cache, File* file);
+
+/**
+ * Record result of a filesystem directory read
+ * @param result dir read result, file error is used to detect the end of the directory
+ */
+void storage_dir_cache_record(
+    StorageDirCache* cache,
+    File* file,
+    bool result,
+    const FileInfo* fileinfo,
+    const char* name);
+
+/**
+ * Track file opened for writing, its directory is not cached until the file is closed
+ */
+void storage_dir_cache_writer_open(StorageDirCache* cache, File* file, FuriString* path);
+
+void storage_dir_cache_writer_close(StorageDirCache* cache, File* file);
+
+/**
+ * Drop listings affected by a change of path: its parent directory, itself and its subtree
+ */
+void storage_dir_cache_invalidate(StorageDirCache* cache, FuriString* path);
+
+/**
+ * Drop all listings, on filesystem mount, unmount and format
+ */
+void storage_dir_cache_reset(StorageDirCache* cache);
+
+void storage_dir_cache_get_stats(StorageDirCache* cache, StorageDirCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -913,6 +913,74 @@ bool storage_common_equivalent_path(
     return S_RETURN_BOOL;
 }
 
+/****************** BATCH ******************/
+
+size_t storage_batch(Storage* storage, StorageOp* ops, size_t count, bool stop_on_error) {
+    furi_check(ops || count == 0);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .batch = {
+            .ops = ops,
+            .count = count,
+            .stop_on_error = stop_on_error,
+            .callback = NULL,
+            .context = NULL,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandBatch);
+    S_API_EPILOGUE;
+    return return_data.size_value;
+}
+
+void storage_batch_submit(
+    Storage* storage,
+    StorageOp* ops,
+    size_t count,
+    bool stop_on_error,
+    StorageBatchCallback callback,
+    void* context) {
+    furi_check(ops || count == 0);
+
+    // Owned by the message, freed by the storage thread after processing
+    SAData* data = malloc(sizeof(SAData));
+    data->batch = (SADataBatch){
+        .ops = ops,
+        .count = count,
+        .stop_on_error = stop_on_error,
+        .callback = callback,
+        .context = context,
+        .thread_id = furi_thread_get_current_id(),
+    };
+
+    StorageMessage message = {
+        .lock = NULL,
+        .command = StorageCommandBatch,
+        .data = data,
+        .return_data = NULL,
+    };
+
+    furi_check(
+        furi_message_queue_put(storage->message_queue, &message, FuriWaitForever) ==
+        FuriStatusOk);
+}
+
+/****************** DIR CACHE ******************/
+
+void storage_get_dir_cache_stats(Storage* storage, StorageDirCacheStats* stats) {
+    furi_check(stats);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .dir_cache_stats = {
+            .stats = stats,
+        }};
+
+    S_API_MESSAGE(StorageCommandDirCacheStats);
+    S_API_EPILOGUE;
+}
+
 /****************** ERROR ******************/
 
 const char* storage_error_get_desc(FS_Error error_id) {
@@ -104,6 +104,19 @@ typedef struct {
     SDInfo* info;
 } SAInfo;
 
+typedef struct {
+    StorageDirCacheStats* stats;
+} SADataDirCacheStats;
+
+typedef struct {
+    StorageOp* ops;
+    size_t count;
+    bool stop_on_error;
+    StorageBatchCallback callback;
+    void* context;
+    FuriThreadId thread_id;
+} SADataBatch;
+
 typedef union {
     SADataFOpen fopen;
     SADataFRead fread;
@@ -127,12 +140,16 @@ typedef union {
     SADataRename rename;
 
     SAInfo sdinfo;
+
+    SADataBatch batch;
+    SADataDirCacheStats dir_cache_stats;
 } SAData;
 
 typedef union {
     bool bool_value;
     uint16_t uint16_value;
     uint64_t uint64_value;
+    size_t size_value;
     FS_Error error_value;
     const char* cstring_value;
 } SAReturn;
@@ -167,10 +184,12 @@ typedef enum {
 
     StorageCommandFileExpand,
     StorageCommandCommonRename,
+    StorageCommandBatch,
+    StorageCommandDirCacheStats,
 } StorageCommand;
 
 typedef struct {
-    FuriApiLock lock;
+    FuriApiLock lock; /**< NULL for asynchronous requests, data is owned by the message */
     StorageCommand command;
     SAData* data;
     SAReturn* return_data;
@@ -1,6 +1,7 @@
 #include "storage_processing.h"
 #include <m-list.h>
 #include <m-dict.h>
+#include <toolbox/profiler.h>
 
 #define STORAGE_PATH_PREFIX_LEN 4u
 _Static_assert(
@@ -122,6 +123,7 @@ bool storage_process_file_open(
         } else {
             if(access_mode & FSAM_WRITE) {
                 storage_data_timestamp(storage);
+                storage_dir_cache_writer_open(app->dir_cache, file, path);
             }
             storage_push_storage_file(file, path, storage);
 
@@ -142,6 +144,7 @@ bool storage_process_file_close(Storage* app, File* file) {
     } else {
         FS_CALL(storage, file.close(storage, file));
         storage_pop_storage_file(file, storage);
+        storage_dir_cache_writer_close(app->dir_cache, file);
 
         StorageEvent event = {.type = StorageEventTypeFileClose};
         furi_pubsub_publish(app->pubsub, &event);
@@ -150,6 +153,9 @@ bool storage_process_file_close(Storage* app, File* file) {
     return ret;
 }
 
+PROFILER_PROBE(storage_file_read_probe);
+PROFILER_PROBE(storage_file_write_probe);
+
 static uint16_t
     storage_process_file_read(Storage* app, File* file, void* buff, uint16_t const bytes_to_read) {
     uint16_t ret = 0;
@@ -158,7 +164,9 @@ static uint16_t
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
+        PROFILER_ENTER(storage_file_read_probe);
         FS_CALL(storage, file.read(storage, file, buff, bytes_to_read));
+        PROFILER_EXIT(storage_file_read_probe);
     }
 
     return ret;
@@ -176,7 +184,9 @@ static uint16_t storage_process_file_write(
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
         storage_data_timestamp(storage);
+        PROFILER_ENTER(storage_file_write_probe);
         FS_CALL(storage, file.write(storage, file, buff, bytes_to_write));
+        PROFILER_EXIT(storage_file_write_probe);
     }
 
     return ret;
@@ -291,7 +301,13 @@ bool storage_process_dir_open(Storage* app, File* file, FuriString* path) {
             file->error_id = FSE_ALREADY_OPEN;
         } else {
             storage_push_storage_file(file, path, storage);
-            FS_CALL(storage, dir.open(storage, file, cstr_path_without_vfs_prefix(path)));
+            if(storage_dir_cache_open(app->dir_cache, file, path)) {
+                // Listing is served from the cache, filesystem is not used until close
+                file->error_id = FSE_OK;
+                ret = true;
+            } else {
+                FS_CALL(storage, dir.open(storage, file, cstr_path_without_vfs_prefix(path)));
+            }
         }
     }
 
@@ -305,7 +321,12 @@ bool storage_process_dir_close(Storage* app, File* file) {
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
-        FS_CALL(storage, dir.close(storage, file));
+        if(storage_dir_cache_close(app->dir_cache, file)) {
+            file->error_id = FSE_OK;
+            ret = true;
+        } else {
+            FS_CALL(storage, dir.close(storage, file));
+        }
         storage_pop_storage_file(file, storage);
 
         StorageEvent event = {.type = StorageEventTypeDirClose};
@@ -322,10 +343,27 @@ bool storage_process_dir_read(
     char* name,
     const uint16_t name_length) {
     bool ret = false;
+    char* item_name = NULL;
     StorageData* storage = get_storage_by_file(file, app->storage);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
+    } else if(storage_dir_cache_read(app->dir_cache, file, fileinfo, name, name_length, &ret)) {
+        // Served from the cache
+    } else if((item_name = storage_dir_cache_record_buffer(app->dir_cache, file)) != NULL) {
+        // Full item is recorded, regardless of what the caller asked for
+        FileInfo item_info;
+        FS_CALL(
+            storage,
+            dir.read(storage, file, &item_info, item_name, STORAGE_DIR_CACHE_NAME_MAX));
+        storage_dir_cache_record(app->dir_cache, file, ret, &item_info, item_name);
+
+        if(fileinfo) {
+            *fileinfo = item_info;
+        }
+        if(name) {
+            snprintf(name, name_length, "%s", item_name);
+        }
     } else {
         FS_CALL(storage, dir.read(storage, file, fileinfo, name, name_length));
     }
@@ -339,6 +377,8 @@ bool storage_process_dir_rewind(Storage* app, File* file) {
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
+    } else if(storage_dir_cache_rewind(app->dir_cache, file)) {
+        ret = true;
     } else {
         FS_CALL(storage, dir.rewind(storage, file));
     }
@@ -384,6 +424,7 @@ static FS_Error storage_process_common_remove(Storage* app, FuriString* path) {
         }
 
         storage_data_timestamp(storage);
+        storage_dir_cache_invalidate(app->dir_cache, path);
         FS_CALL(storage, common.remove(storage, cstr_path_without_vfs_prefix(path)));
     } while(false);
 
@@ -415,6 +456,8 @@ static FS_Error storage_process_common_rename(Storage* app, FuriString* old, Fur
         }
 
         storage_data_timestamp(storage);
+        storage_dir_cache_invalidate(app->dir_cache, old);
+        storage_dir_cache_invalidate(app->dir_cache, new);
         FS_CALL(
             storage,
             common.rename(
@@ -430,6 +473,7 @@ static FS_Error storage_process_common_mkdir(Storage* app, FuriString* path) {
 
     if(ret == FSE_OK) {
         storage_data_timestamp(storage);
+        storage_dir_cache_invalidate(app->dir_cache, path);
         FS_CALL(storage, common.mkdir(storage, cstr_path_without_vfs_prefix(path)));
     }
 
@@ -490,6 +534,7 @@ static FS_Error storage_process_sd_format(Storage* app) {
     } else {
         ret = sd_format_card(&app->storage[ST_EXT]);
         storage_data_timestamp(&app->storage[ST_EXT]);
+        storage_dir_cache_reset(app->dir_cache);
     }
 
     return ret;
@@ -512,6 +557,7 @@ static FS_Error storage_process_sd_unmount(Storage* app) {
 
         sd_unmount_card(storage);
         storage_data_timestamp(storage);
+        storage_dir_cache_reset(app->dir_cache);
     } while(false);
 
     return ret;
@@ -529,6 +575,7 @@ static FS_Error storage_process_sd_mount(Storage* app) {
 
         ret = sd_mount_card(storage, true);
         storage_data_timestamp(storage);
+        storage_dir_cache_reset(app->dir_cache);
     } while(false);
 
     return ret;
@@ -616,6 +663,106 @@ void storage_process_alias(
     }
 }
 
+/******************** Batch processing *******************/
+
+static bool storage_process_batch_op_is_valid(const StorageOp* op) {
+    switch(op->type) {
+    case StorageOpTypeRead:
+        return op->read.file && (op->read.buffer || !op->read.size);
+    case StorageOpTypeWrite:
+        return op->write.file && (op->write.buffer || !op->write.size);
+    case StorageOpTypeSeek:
+        return op->seek.file;
+    case StorageOpTypeStat:
+        return op->stat.path;
+    case StorageOpTypeDirRead:
+        return op->dir_read.file;
+    default:
+        return false;
+    }
+}
+
+static void storage_process_batch_op(
+    Storage* app,
+    StorageOp* op,
+    FuriString* path,
+    FuriThreadId thread_id) {
+    op->result = 0;
+
+    if(!storage_process_batch_op_is_valid(op)) {
+        op->error = FSE_INVALID_PARAMETER;
+        return;
+    }
+
+    switch(op->type) {
+    case StorageOpTypeRead:
+        while(op->result < op->read.size) {
+            const uint16_t chunk = MIN(op->read.size - op->result, UINT16_MAX);
+            const uint16_t read = storage_process_file_read(
+                app, op->read.file, (uint8_t*)op->read.buffer + op->result, chunk);
+            op->result += read;
+            if(read != chunk || op->read.file->error_id != FSE_OK) {
+                break;
+            }
+        }
+        op->error = op->read.file->error_id;
+        break;
+    case StorageOpTypeWrite:
+        while(op->result < op->write.size) {
+            const uint16_t chunk = MIN(op->write.size - op->result, UINT16_MAX);
+            const uint16_t written = storage_process_file_write(
+                app, op->write.file, (const uint8_t*)op->write.buffer + op->result, chunk);
+            op->result += written;
+            if(written != chunk || op->write.file->error_id != FSE_OK) {
+                break;
+            }
+        }
+        op->error = op->write.file->error_id;
+        break;
+    case StorageOpTypeSeek:
+        op->result =
+            storage_process_file_seek(app, op->seek.file, op->seek.offset, op->seek.from_start);
+        op->error = op->seek.file->error_id;
+        break;
+    case StorageOpTypeStat:
+        furi_string_set(path, op->stat.path);
+        storage_process_alias(app, path, thread_id, false);
+        op->error = storage_process_common_stat(app, path, op->stat.fileinfo);
+        op->result = (op->error == FSE_OK);
+        break;
+    case StorageOpTypeDirRead:
+        op->result = storage_process_dir_read(
+            app,
+            op->dir_read.file,
+            op->dir_read.fileinfo,
+            op->dir_read.name,
+            op->dir_read.name_length);
+        op->error = op->dir_read.file->error_id;
+        break;
+    }
+}
+
+static size_t storage_process_batch(Storage* app, SADataBatch* batch) {
+    FuriString* path = furi_string_alloc();
+    size_t executed = 0;
+
+    while(executed < batch->count) {
+        StorageOp* op = &batch->ops[executed++];
+        storage_process_batch_op(app, op, path, batch->thread_id);
+        if(batch->stop_on_error && op->error != FSE_OK) {
+            break;
+        }
+    }
+
+    furi_string_free(path);
+
+    if(batch->callback) {
+        batch->callback(batch->ops, executed, batch->context);
+    }
+
+    return executed;
+}
+
 /****************** API calls processing ******************/
 
 void storage_process_message_internal(Storage* app, StorageMessage* message) {
@@ -788,13 +935,32 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
     case StorageCommandSDStatus:
         message->return_data->error_value = storage_process_sd_status(app);
         break;
+
+    // Directory cache
+    case StorageCommandDirCacheStats:
+        storage_dir_cache_get_stats(app->dir_cache, message->data->dir_cache_stats.stats);
+        break;
+
+    // Batch operations
+    case StorageCommandBatch: {
+        const size_t executed = storage_process_batch(app, &message->data->batch);
+        if(message->return_data) {
+            message->return_data->size_value = executed;
+        }
+        break;
+    }
     }
 
     if(path != NULL) { //-V547
         furi_string_free(path);
     }
 
-    api_lock_unlock(message->lock);
+    if(message->lock) {
+        api_lock_unlock(message->lock);
+    } else {
+        // Asynchronous request, nobody waits for the data
+        free(message->data);
+    }
 }
 
 void storage_process_message(Storage* app, StorageMessage* message) {
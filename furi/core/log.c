@@ -1,17 +1,36 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
 #include <furi_hal.h>
 #include <m-list.h>
 
 LIST_DEF(FuriLogHandlersList, FuriLogHandler, M_POD_OPLIST)
 
+#define TAG "FuriLog"
+
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+// Deferred mode ring buffer, must be a power of 2
+#define FURI_LOG_DEFERRED_BUFFER_SIZE (4096U)
+#define FURI_LOG_DEFERRED_RECORD_SIZE_MAX (256U)
+#define FURI_LOG_DEFERRED_RECORD_ALIGN (8U)
+#define FURI_LOG_DEFERRED_STRING_SIZE_MAX (64U)
+#define FURI_LOG_DEFERRED_SPEC_SIZE_MAX (48U)
+#define FURI_LOG_DEFERRED_THREAD_STACK_SIZE (2048U)
+#define FURI_LOG_DEFERRED_FLAG_WAKEUP (1UL << 0)
+
 typedef struct {
     FuriLogLevel log_level;
     FuriMutex* mutex;
     FuriLogHandlersList_t tx_handlers;
+    // Deferred mode
+    volatile bool deferred;
+    FuriThread* drain_thread;
+    uint8_t* buffer;
+    uint32_t head; /**< reserved by producers, free running */
+    uint32_t tail; /**< released by the drain thread, free running */
+    uint32_t dropped;
 } FuriLogParams;
 
 static FuriLogParams furi_log = {0};
@@ -107,49 +126,707 @@ void furi_log_puts(const char* data) {
     furi_log_tx((const uint8_t*)data, strlen(data));
 }
 
-void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
-        FuriString* string;
-        string = furi_string_alloc();
+static void furi_log_print_header(
+    FuriString* string,
+    uint32_t timestamp,
+    FuriLogLevel level,
+    const char* tag) {
+    const char* color = _FURI_LOG_CLR_RESET;
+    const char* log_letter = " ";
+    switch(level) {
+    case FuriLogLevelError:
+        color = _FURI_LOG_CLR_E;
+        log_letter = "E";
+        break;
+    case FuriLogLevelWarn:
+        color = _FURI_LOG_CLR_W;
+        log_letter = "W";
+        break;
+    case FuriLogLevelInfo:
+        color = _FURI_LOG_CLR_I;
+        log_letter = "I";
+        break;
+    case FuriLogLevelDebug:
+        color = _FURI_LOG_CLR_D;
+        log_letter = "D";
+        break;
+    case FuriLogLevelTrace:
+        color = _FURI_LOG_CLR_T;
+        log_letter = "T";
+        break;
+    default:
+        break;
+    }
 
-        const char* color = _FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = _FURI_LOG_CLR_E;
-            log_letter = "E";
-            break;
-        case FuriLogLevelWarn:
-            color = _FURI_LOG_CLR_W;
-            log_letter = "W";
-            break;
-        case FuriLogLevelInfo:
-            color = _FURI_LOG_CLR_I;
-            log_letter = "I";
-            break;
-        case FuriLogLevelDebug:
-            color = _FURI_LOG_CLR_D;
-            log_letter = "D";
-            break;
-        case FuriLogLevelTrace:
-            color = _FURI_LOG_CLR_T;
-            log_letter = "T";
+    // Timestamp
+    furi_string_printf(
+        string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, timestamp, color, log_letter, tag);
+    furi_log_puts(furi_string_get_cstr(string));
+    furi_string_reset(string);
+}
+
+/* Deferred mode
+ *
+ * Callers pack the record into a ring buffer instead of formatting it: timestamp, level,
+ * tag and format pointers and raw argument values. Strings referenced by %s are copied,
+ * tag and format are copied only if they do not reside in flash (e.g. loaded applications).
+ * Producers reserve space with a compare-and-swap on the head and mark the record ready
+ * once it is written, so threads log without taking the log mutex. Records that can not be
+ * packed are formatted on the caller side, which may allocate: logging from ISR is still not
+ * supported. A low priority drain thread formats ready records in order and passes them to
+ * the handlers.
+ */
+
+typedef enum {
+    FuriLogRecordStateFree = 0, /**< reserved, not written yet */
+    FuriLogRecordStateReady,
+    FuriLogRecordStatePadding, /**< unused space at the end of the buffer */
+} FuriLogRecordState;
+
+typedef enum {
+    FuriLogRecordFlagRaw = (1 << 0), /**< no header and line ending */
+    FuriLogRecordFlagTagInline = (1 << 1),
+    FuriLogRecordFlagFormatInline = (1 << 2),
+    FuriLogRecordFlagText = (1 << 3), /**< formatted by the caller, no arguments */
+} FuriLogRecordFlag;
+
+typedef struct {
+    uint16_t size; /**< whole record size including the header */
+    uint8_t state; /**< FuriLogRecordState, set last */
+    uint8_t level : 4; /**< FuriLogLevel */
+    uint8_t flags : 4; /**< FuriLogRecordFlag */
+    uint32_t timestamp;
+    const char* tag;
+    const char* format;
+    // followed by inline tag, inline format and packed arguments
+    uint8_t data[];
+} FuriLogRecord;
+
+typedef enum {
+    FuriLogArgTypeNone, /**< %% */
+    FuriLogArgTypeInt,
+    FuriLogArgTypeLong,
+    FuriLogArgTypeLongLong,
+    FuriLogArgTypeIntMax,
+    FuriLogArgTypeSize,
+    FuriLogArgTypePtrDiff,
+    FuriLogArgTypeDouble,
+    FuriLogArgTypeLongDouble,
+    FuriLogArgTypePointer,
+    FuriLogArgTypeString,
+    FuriLogArgTypeUnsupported,
+} FuriLogArgType;
+
+typedef struct {
+    const char* flags;
+    size_t flags_size;
+    const char* width;
+    size_t width_size;
+    bool width_star;
+    bool has_precision;
+    const char* precision;
+    size_t precision_size;
+    bool precision_star;
+    const char* length;
+    size_t length_size;
+    char conversion;
+    FuriLogArgType type;
+} FuriLogFormatSpec;
+
+static inline bool furi_log_is_persistent(const void* ptr) {
+    // Firmware constants live in flash, applications are loaded to RAM and may go away
+    return ((uintptr_t)ptr >= FLASH_BASE) && ((uintptr_t)ptr < SRAM1_BASE);
+}
+
+static inline size_t furi_log_skip_chars(const char* str, const char* chars) {
+    size_t size = 0;
+    while(str[size] && strchr(chars, str[size])) size++;
+    return size;
+}
+
+// Parse conversion specification following '%', returns position after it
+static const char* furi_log_format_parse(const char* format, FuriLogFormatSpec* spec) {
+    memset(spec, 0, sizeof(FuriLogFormatSpec));
+
+    spec->flags = format;
+    spec->flags_size = furi_log_skip_chars(format, "-+ #0");
+    format += spec->flags_size;
+
+    if(*format == '*') {
+        spec->width_star = true;
+        format++;
+    } else {
+        spec->width = format;
+        spec->width_size = furi_log_skip_chars(format, "0123456789");
+        format += spec->width_size;
+    }
+
+    if(*format == '.') {
+        spec->has_precision = true;
+        format++;
+        if(*format == '*') {
+            spec->precision_star = true;
+            format++;
+        } else {
+            spec->precision = format;
+            spec->precision_size = furi_log_skip_chars(format, "0123456789");
+            format += spec->precision_size;
+        }
+    }
+
+    spec->length = format;
+    spec->length_size = furi_log_skip_chars(format, "hljztL");
+    format += spec->length_size;
+
+    spec->conversion = *format;
+    if(*format) format++;
+
+    // Leave room for the values of '*' when the specification is rebuilt
+    if((size_t)(format - spec->flags) + 2 * 12 > FURI_LOG_DEFERRED_SPEC_SIZE_MAX) {
+        spec->type = FuriLogArgTypeUnsupported;
+        return format;
+    }
+
+    const char* length = spec->length;
+    const size_t length_size = spec->length_size;
+    switch(spec->conversion) {
+    case '%':
+        spec->type = FuriLogArgTypeNone;
+        break;
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+        if(length_size == 0 || length[0] == 'h') {
+            spec->type = (length_size <= 2) ? FuriLogArgTypeInt : FuriLogArgTypeUnsupported;
+        } else if(length_size == 1 && length[0] == 'l') {
+            spec->type = FuriLogArgTypeLong;
+        } else if(length_size == 2 && length[0] == 'l' && length[1] == 'l') {
+            spec->type = FuriLogArgTypeLongLong;
+        } else if(length_size == 1 && length[0] == 'j') {
+            spec->type = FuriLogArgTypeIntMax;
+        } else if(length_size == 1 && length[0] == 'z') {
+            spec->type = FuriLogArgTypeSize;
+        } else if(length_size == 1 && length[0] == 't') {
+            spec->type = FuriLogArgTypePtrDiff;
+        } else {
+            spec->type = FuriLogArgTypeUnsupported;
+        }
+        if(spec->conversion == 'c' && spec->type != FuriLogArgTypeInt) {
+            spec->type = FuriLogArgTypeUnsupported;
+        }
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        if(length_size == 0 || (length_size == 1 && length[0] == 'l')) {
+            spec->type = FuriLogArgTypeDouble;
+        } else if(length_size == 1 && length[0] == 'L') {
+            spec->type = FuriLogArgTypeLongDouble;
+        } else {
+            spec->type = FuriLogArgTypeUnsupported;
+        }
+        break;
+    case 'p':
+        spec->type = length_size ? FuriLogArgTypeUnsupported : FuriLogArgTypePointer;
+        break;
+    case 's':
+        spec->type = length_size ? FuriLogArgTypeUnsupported : FuriLogArgTypeString;
+        break;
+    default:
+        // %n and friends can not be deferred
+        spec->type = FuriLogArgTypeUnsupported;
+        break;
+    }
+
+    return format;
+}
+
+static size_t furi_log_arg_type_get_size(FuriLogArgType type) {
+    switch(type) {
+    case FuriLogArgTypeInt:
+        return sizeof(int);
+    case FuriLogArgTypeLong:
+        return sizeof(long);
+    case FuriLogArgTypeLongLong:
+        return sizeof(long long);
+    case FuriLogArgTypeIntMax:
+        return sizeof(intmax_t);
+    case FuriLogArgTypeSize:
+        return sizeof(size_t);
+    case FuriLogArgTypePtrDiff:
+        return sizeof(ptrdiff_t);
+    case FuriLogArgTypeDouble:
+        return sizeof(double);
+    case FuriLogArgTypeLongDouble:
+        return sizeof(long double);
+    case FuriLogArgTypePointer:
+        return sizeof(void*);
+    default:
+        return 0;
+    }
+}
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t used;
+} FuriLogPacker;
+
+static bool furi_log_pack(FuriLogPacker* packer, const void* data, size_t size) {
+    if(packer->size - packer->used < size) return false;
+    memcpy(&packer->data[packer->used], data, size);
+    packer->used += size;
+    return true;
+}
+
+static bool furi_log_pack_cstr(FuriLogPacker* packer, const char* str) {
+    return furi_log_pack(packer, str, strlen(str) + 1);
+}
+
+// Strings are copied up to the precision, so that non-terminated buffers are not overread.
+// Longer strings are not cut, the record is formatted by the caller instead.
+static bool furi_log_pack_string(FuriLogPacker* packer, const char* str, int precision) {
+    size_t size_max = FURI_LOG_DEFERRED_STRING_SIZE_MAX + 1;
+    if(precision >= 0 && (size_t)precision < size_max) size_max = precision;
+    if(!str) str = "(null)";
+    const size_t length = strnlen(str, size_max);
+    if(length > FURI_LOG_DEFERRED_STRING_SIZE_MAX) return false;
+    const uint8_t size = length;
+    return furi_log_pack(packer, &size, sizeof(size)) && furi_log_pack(packer, str, size);
+}
+
+static bool furi_log_pack_arg(
+    FuriLogPacker* packer,
+    FuriLogArgType type,
+    int precision,
+    va_list* args) {
+    switch(type) {
+    case FuriLogArgTypeInt: {
+        const int value = va_arg(*args, int);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypeLong: {
+        const long value = va_arg(*args, long);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypeLongLong: {
+        const long long value = va_arg(*args, long long);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypeIntMax: {
+        const intmax_t value = va_arg(*args, intmax_t);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypeSize: {
+        const size_t value = va_arg(*args, size_t);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypePtrDiff: {
+        const ptrdiff_t value = va_arg(*args, ptrdiff_t);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypeDouble: {
+        const double value = va_arg(*args, double);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypeLongDouble: {
+        const long double value = va_arg(*args, long double);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypePointer: {
+        const void* value = va_arg(*args, void*);
+        return furi_log_pack(packer, &value, sizeof(value));
+    }
+    case FuriLogArgTypeString:
+        return furi_log_pack_string(packer, va_arg(*args, const char*), precision);
+    case FuriLogArgTypeNone:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static FuriLogRecord* furi_log_deferred_reserve(size_t size) {
+    const uint32_t mask = FURI_LOG_DEFERRED_BUFFER_SIZE - 1;
+    uint32_t head = __atomic_load_n(&furi_log.head, __ATOMIC_RELAXED);
+    uint32_t padding;
+    uint32_t tail;
+
+    do {
+        const uint32_t to_end = FURI_LOG_DEFERRED_BUFFER_SIZE - (head & mask);
+        padding = (to_end < size) ? to_end : 0;
+        tail = __atomic_load_n(&furi_log.tail, __ATOMIC_ACQUIRE);
+        if(head - tail + padding + size > FURI_LOG_DEFERRED_BUFFER_SIZE) {
+            __atomic_fetch_add(&furi_log.dropped, 1, __ATOMIC_RELAXED);
+            return NULL;
+        }
+    } while(!__atomic_compare_exchange_n(
+        &furi_log.head, &head, head + padding + size, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    if(padding) {
+        FuriLogRecord* record = (FuriLogRecord*)&furi_log.buffer[head & mask];
+        record->size = padding;
+        __atomic_store_n(&record->state, FuriLogRecordStatePadding, __ATOMIC_RELEASE);
+    }
+
+    return (FuriLogRecord*)&furi_log.buffer[(head + padding) & mask];
+}
+
+// Returns false if the record can not be deferred, dropped records are considered handled
+static bool furi_log_deferred_push(
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    bool raw,
+    va_list args) {
+    uint8_t buffer[FURI_LOG_DEFERRED_RECORD_SIZE_MAX] __attribute__((aligned(8)));
+    FuriLogRecord* record = (FuriLogRecord*)buffer;
+    FuriLogPacker packer = {
+        .data = record->data,
+        .size = sizeof(buffer) - sizeof(FuriLogRecord),
+        .used = 0,
+    };
+
+    record->state = FuriLogRecordStateFree;
+    record->level = level;
+    record->flags = raw ? FuriLogRecordFlagRaw : 0;
+    record->timestamp = furi_get_tick();
+    record->tag = tag;
+    record->format = format;
+
+    if(!raw && !furi_log_is_persistent(tag)) {
+        record->flags |= FuriLogRecordFlagTagInline;
+        if(!furi_log_pack_cstr(&packer, tag)) return false;
+    }
+    const size_t tag_size = packer.used;
+
+    if(!furi_log_is_persistent(format)) {
+        record->flags |= FuriLogRecordFlagFormatInline;
+        if(!furi_log_pack_cstr(&packer, format)) return false;
+    }
+
+    va_list args_copy;
+    va_copy(args_copy, args);
+    bool success = true;
+    for(const char* format_tail = format; success && *format_tail;) {
+        if(*format_tail++ != '%') continue;
+
+        FuriLogFormatSpec spec;
+        format_tail = furi_log_format_parse(format_tail, &spec);
+        if(spec.width_star) {
+            const int width = va_arg(args_copy, int);
+            success = furi_log_pack(&packer, &width, sizeof(width));
+        }
+
+        int precision = -1;
+        if(spec.precision_star) {
+            precision = va_arg(args_copy, int);
+            success = success && furi_log_pack(&packer, &precision, sizeof(precision));
+        } else if(spec.has_precision) {
+            precision = atoi(spec.precision);
+        }
+
+        success = success && furi_log_pack_arg(&packer, spec.type, precision, &args_copy);
+    }
+    va_end(args_copy);
+
+    if(!success) {
+        // Arguments can not be deferred, keep the record in order as formatted text
+        packer.used = tag_size;
+        record->flags &= ~FuriLogRecordFlagFormatInline;
+        record->flags |= FuriLogRecordFlagText;
+
+        FuriString* text = furi_string_alloc();
+        va_copy(args_copy, args);
+        furi_string_vprintf(text, format, args_copy);
+        va_end(args_copy);
+        success = furi_log_pack_cstr(&packer, furi_string_get_cstr(text));
+        furi_string_free(text);
+
+        if(!success) return false;
+    }
+
+    const size_t size = sizeof(FuriLogRecord) + packer.used;
+    record->size = (size + FURI_LOG_DEFERRED_RECORD_ALIGN - 1) &
+                   ~(FURI_LOG_DEFERRED_RECORD_ALIGN - 1);
+
+    FuriLogRecord* slot = furi_log_deferred_reserve(record->size);
+    if(slot) {
+        memcpy(slot, record, size);
+        __atomic_store_n(&slot->state, FuriLogRecordStateReady, __ATOMIC_RELEASE);
+        // Always wake the drain thread, it may have emptied the buffer and gone to sleep
+        // between our tail load and reservation
+        furi_thread_flags_set(
+            furi_thread_get_id(furi_log.drain_thread), FURI_LOG_DEFERRED_FLAG_WAKEUP);
+    }
+
+    return true;
+}
+
+static const uint8_t* furi_log_unpack_arg(
+    const uint8_t* data,
+    FuriLogArgType type,
+    char* spec,
+    FuriString* string) {
+    union {
+        int i;
+        long l;
+        long long ll;
+        intmax_t im;
+        size_t z;
+        ptrdiff_t t;
+        double d;
+        long double ld;
+        void* p;
+    } value;
+
+    if(type == FuriLogArgTypeString) {
+        const uint8_t size = *data++;
+        char str[FURI_LOG_DEFERRED_STRING_SIZE_MAX + 1];
+        memcpy(str, data, size);
+        str[size] = '\0';
+        furi_string_cat_printf(string, spec, str);
+        return data + size;
+    }
+
+    const size_t size = furi_log_arg_type_get_size(type);
+    memcpy(&value, data, size);
+
+    switch(type) {
+    case FuriLogArgTypeInt:
+        furi_string_cat_printf(string, spec, value.i);
+        break;
+    case FuriLogArgTypeLong:
+        furi_string_cat_printf(string, spec, value.l);
+        break;
+    case FuriLogArgTypeLongLong:
+        furi_string_cat_printf(string, spec, value.ll);
+        break;
+    case FuriLogArgTypeIntMax:
+        furi_string_cat_printf(string, spec, value.im);
+        break;
+    case FuriLogArgTypeSize:
+        furi_string_cat_printf(string, spec, value.z);
+        break;
+    case FuriLogArgTypePtrDiff:
+        furi_string_cat_printf(string, spec, value.t);
+        break;
+    case FuriLogArgTypeDouble:
+        furi_string_cat_printf(string, spec, value.d);
+        break;
+    case FuriLogArgTypeLongDouble:
+        furi_string_cat_printf(string, spec, value.ld);
+        break;
+    case FuriLogArgTypePointer:
+        furi_string_cat_printf(string, spec, value.p);
+        break;
+    default:
+        break;
+    }
+
+    return data + size;
+}
+
+static void furi_log_deferred_format(const FuriLogRecord* record, FuriString* string) {
+    const uint8_t* data = record->data;
+    const char* tag = record->tag;
+    const char* format = record->format;
+
+    if(record->flags & FuriLogRecordFlagTagInline) {
+        tag = (const char*)data;
+        data += strlen(tag) + 1;
+    }
+    if(record->flags & FuriLogRecordFlagFormatInline) {
+        format = (const char*)data;
+        data += strlen(format) + 1;
+    }
+
+    if(!(record->flags & FuriLogRecordFlagRaw)) {
+        furi_log_print_header(string, record->timestamp, record->level, tag);
+    }
+
+    if(record->flags & FuriLogRecordFlagText) {
+        furi_string_cat_str(string, (const char*)data);
+        return;
+    }
+
+    while(*format) {
+        const char* start = strchr(format, '%');
+        if(!start) {
+            furi_string_cat_str(string, format);
             break;
-        default:
+        }
+        if(start != format) {
+            furi_string_cat_printf(string, "%.*s", (int)(start - format), format);
+        }
+
+        FuriLogFormatSpec spec;
+        format = furi_log_format_parse(start + 1, &spec);
+        if(spec.type == FuriLogArgTypeNone) {
+            furi_string_push_back(string, '%');
+            continue;
+        }
+
+        // Rebuild the specification with '*' replaced by the packed values
+        char spec_str[FURI_LOG_DEFERRED_SPEC_SIZE_MAX];
+        int width = 0;
+        int precision = -1;
+        if(spec.width_star) {
+            memcpy(&width, data, sizeof(width));
+            data += sizeof(width);
+        }
+        if(spec.precision_star) {
+            memcpy(&precision, data, sizeof(precision));
+            data += sizeof(precision);
+        }
+
+        int spec_size = snprintf(
+            spec_str, sizeof(spec_str), "%%%.*s", (int)spec.flags_size, spec.flags);
+        if(spec.width_star) {
+            spec_size += snprintf(
+                spec_str + spec_size, sizeof(spec_str) - spec_size, "%d", width);
+        } else {
+            spec_size += snprintf(
+                spec_str + spec_size,
+                sizeof(spec_str) - spec_size,
+                "%.*s",
+                (int)spec.width_size,
+                spec.width);
+        }
+        if(spec.precision_star && precision >= 0) {
+            spec_size += snprintf(
+                spec_str + spec_size, sizeof(spec_str) - spec_size, ".%d", precision);
+        } else if(spec.has_precision && !spec.precision_star) {
+            spec_size += snprintf(
+                spec_str + spec_size,
+                sizeof(spec_str) - spec_size,
+                ".%.*s",
+                (int)spec.precision_size,
+                spec.precision);
+        }
+        snprintf(
+            spec_str + spec_size,
+            sizeof(spec_str) - spec_size,
+            "%.*s%c",
+            (int)spec.length_size,
+            spec.length,
+            spec.conversion);
+
+        data = furi_log_unpack_arg(data, spec.type, spec_str, string);
+    }
+}
+
+// Pass ready records to the handlers, returns true if a record is still being written
+static bool furi_log_deferred_drain(FuriString* string) {
+    const uint32_t mask = FURI_LOG_DEFERRED_BUFFER_SIZE - 1;
+    uint32_t tail = furi_log.tail;
+    bool pending = false;
+
+    while(tail != __atomic_load_n(&furi_log.head, __ATOMIC_ACQUIRE)) {
+        FuriLogRecord* record = (FuriLogRecord*)&furi_log.buffer[tail & mask];
+        const uint8_t state = __atomic_load_n(&record->state, __ATOMIC_ACQUIRE);
+        if(state == FuriLogRecordStateFree) {
+            pending = true;
             break;
         }
 
-        // Timestamp
-        furi_string_printf(
-            string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, furi_get_tick(), color, log_letter, tag);
-        furi_log_puts(furi_string_get_cstr(string));
-        furi_string_reset(string);
+        const uint16_t size = record->size;
+        if(state == FuriLogRecordStateReady &&
+           furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+            furi_log_deferred_format(record, string);
+            furi_log_puts(furi_string_get_cstr(string));
+            if(!(record->flags & FuriLogRecordFlagRaw)) furi_log_puts("\r\n");
+            furi_string_reset(string);
+            furi_mutex_release(furi_log.mutex);
+        }
+
+        // Free space must look free to the producers: record headers may land anywhere in it
+        memset(record, 0, size);
+        tail += size;
+        __atomic_store_n(&furi_log.tail, tail, __ATOMIC_RELEASE);
+    }
+
+    return pending;
+}
+
+static int32_t furi_log_deferred_thread(void* context) {
+    UNUSED(context);
+    FuriString* string = furi_string_alloc();
+    uint32_t dropped_reported = 0;
+
+    while(true) {
+        const bool pending = furi_log_deferred_drain(string);
+
+        const uint32_t dropped = __atomic_load_n(&furi_log.dropped, __ATOMIC_RELAXED);
+        if(dropped != dropped_reported) {
+            furi_log_print_format(
+                FuriLogLevelWarn, TAG, "%lu records dropped", dropped - dropped_reported);
+            dropped_reported = dropped;
+        }
+
+        furi_thread_flags_wait(
+            FURI_LOG_DEFERRED_FLAG_WAKEUP, FuriFlagWaitAny, pending ? 1 : FuriWaitForever);
+    }
+
+    return 0;
+}
+
+void furi_log_set_deferred(bool deferred) {
+    furi_check(!FURI_IS_ISR());
+
+    if(deferred && !furi_log.drain_thread) {
+        furi_log.buffer = malloc(FURI_LOG_DEFERRED_BUFFER_SIZE);
+        furi_log.drain_thread = furi_thread_alloc_ex(
+            TAG, FURI_LOG_DEFERRED_THREAD_STACK_SIZE, furi_log_deferred_thread, NULL);
+        furi_thread_mark_as_service(furi_log.drain_thread);
+        furi_thread_set_priority(furi_log.drain_thread, FuriThreadPriorityLowest);
+        furi_thread_start(furi_log.drain_thread);
+    }
+
+    furi_log.deferred = deferred;
+
+    if(!deferred && furi_log.drain_thread) {
+        // Flush, so that records stay in order with the ones printed directly
+        while(__atomic_load_n(&furi_log.tail, __ATOMIC_ACQUIRE) !=
+              __atomic_load_n(&furi_log.head, __ATOMIC_ACQUIRE)) {
+            furi_thread_flags_set(
+                furi_thread_get_id(furi_log.drain_thread), FURI_LOG_DEFERRED_FLAG_WAKEUP);
+            furi_delay_tick(1);
+        }
+    }
+}
+
+bool furi_log_is_deferred(void) {
+    return furi_log.deferred;
+}
+
+uint32_t furi_log_get_dropped_count(void) {
+    return __atomic_load_n(&furi_log.dropped, __ATOMIC_RELAXED);
+}
+
+void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    if(level > furi_log.log_level) return;
+
+    va_list args;
+    va_start(args, format);
+
+    if((!furi_log.deferred || !furi_log_deferred_push(level, tag, format, false, args)) &&
+       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+        FuriString* string;
+        string = furi_string_alloc();
+
+        furi_log_print_header(string, furi_get_tick(), level, tag);
 
-        va_list args;
-        va_start(args, format);
         furi_string_vprintf(string, format, args);
-        va_end(args);
 
         furi_log_puts(furi_string_get_cstr(string));
         furi_string_free(string);
@@ -158,23 +835,29 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 
         furi_mutex_release(furi_log.mutex);
     }
+
+    va_end(args);
 }
 
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
-    if(level <= furi_log.log_level &&
+    if(level > furi_log.log_level) return;
+
+    va_list args;
+    va_start(args, format);
+
+    if((!furi_log.deferred || !furi_log_deferred_push(level, NULL, format, true, args)) &&
        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
         string = furi_string_alloc();
-        va_list args;
-        va_start(args, format);
         furi_string_vprintf(string, format, args);
-        va_end(args);
 
         furi_log_puts(furi_string_get_cstr(string));
         furi_string_free(string);
 
         furi_mutex_release(furi_log.mutex);
     }
+
+    va_end(args);
 }
 
 void furi_log_set_level(FuriLogLevel level) {
@@ -109,6 +109,33 @@ void furi_log_set_level(FuriLogLevel level);
  */
 FuriLogLevel furi_log_get_level(void);
 
+/** Enable or disable deferred logging
+ *
+ * In deferred mode log calls only store a compact binary record (timestamp, level, tag,
+ * format and raw arguments) into a lock-free ring buffer. Records are formatted and sent to
+ * the handlers by a low priority thread, started on the first call. Records that do not fit
+ * into the buffer are dropped and counted. Records with %s strings longer than 64
+ * characters are formatted by the caller. Disabling waits until pending records are
+ * printed. Logging from ISR is not supported in either mode.
+ *
+ * @warning    must be called from a thread
+ *
+ * @param[in]  deferred  true to enable deferred mode
+ */
+void furi_log_set_deferred(bool deferred);
+
+/** Check if deferred logging is enabled
+ *
+ * @return     true if deferred mode is enabled
+ */
+bool furi_log_is_deferred(void);
+
+/** Get number of records dropped in deferred mode
+ *
+ * @return     dropped records count since boot
+ */
+uint32_t furi_log_get_dropped_count(void);
+
 /** Log level to string
  *
  * @param[in]  level  The level
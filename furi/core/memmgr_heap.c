@@ -94,6 +94,15 @@ static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert);
  */
 static void prvHeapInit(void);
 
+/*
+ * Allocate a block from the end of the highest free block that fits, and return
+ * it to the heap.  Used for slab pages, so that they gather at the top of the
+ * heap instead of splitting the space used by regular allocations.  Must be
+ * called with the scheduler suspended.
+ */
+static void* prvMallocFromTop(size_t xWantedSize);
+static void prvFreeBlock(void* pv);
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -161,6 +170,11 @@ void memmgr_heap_disable_thread_trace(FuriThreadId thread_id) {
     (void)xTaskResumeAll();
 }
 
+/* Slab page lookup, defined with the slab allocator below */
+typedef struct MemmgrHeapSlabPage MemmgrHeapSlabPage;
+static MemmgrHeapSlabPage* memmgr_heap_slab_find_page(const void* pointer);
+static bool memmgr_heap_slab_is_allocated(MemmgrHeapSlabPage* page, const void* pointer);
+
 size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
     size_t leftovers = MEMMGR_HEAP_UNKNOWN;
     vTaskSuspendAll();
@@ -175,7 +189,12 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
                 !MemmgrHeapAllocDict_end_p(alloc_dict_it);
                 MemmgrHeapAllocDict_next(alloc_dict_it)) {
                 MemmgrHeapAllocDict_itref_t* data = MemmgrHeapAllocDict_ref(alloc_dict_it);
-                if(data->key != 0) {
+                MemmgrHeapSlabPage* page = memmgr_heap_slab_find_page((void*)data->key);
+                if(page) {
+                    if(memmgr_heap_slab_is_allocated(page, (void*)data->key)) {
+                        leftovers += data->value;
+                    }
+                } else if(data->key != 0) {
                     uint8_t* puc = (uint8_t*)data->key;
                     puc -= xHeapStructSize;
                     BlockLink_t* pxLink = (void*)puc;
@@ -224,6 +243,393 @@ static inline void traceFREE(void* pointer, size_t size) {
     }
 }
 
+/* Allocation event tracing
+ *
+ * Unlike thread tracking, events are appended to a preallocated ring buffer, so recording
+ * takes constant time and never allocates. Analysis is left to the reader.
+ */
+static MemmgrHeapTraceEvent* memmgr_heap_trace_events = NULL;
+static size_t memmgr_heap_trace_size = 0;
+static size_t memmgr_heap_trace_head = 0;
+static size_t memmgr_heap_trace_tail = 0;
+static uint32_t memmgr_heap_trace_dropped = 0;
+static volatile bool memmgr_heap_trace_running = false;
+
+// Record trace event, must be called with the scheduler suspended
+static void memmgr_heap_trace_record(
+    MemmgrHeapTraceEventType type,
+    void* pointer,
+    size_t size,
+    void* caller) {
+    if(!memmgr_heap_trace_running) return;
+
+    if(memmgr_heap_trace_head - memmgr_heap_trace_tail == memmgr_heap_trace_size) {
+        memmgr_heap_trace_dropped++;
+        return;
+    }
+
+    MemmgrHeapTraceEvent* event =
+        &memmgr_heap_trace_events[memmgr_heap_trace_head % memmgr_heap_trace_size];
+    event->tick = xTaskGetTickCount();
+    event->pointer = (uint32_t)pointer;
+    event->size = size;
+    event->type = type;
+    event->caller = (uint32_t)caller;
+    event->thread = (uint32_t)furi_thread_get_current_id();
+    memmgr_heap_trace_head++;
+}
+
+bool memmgr_heap_trace_start(size_t event_count) {
+    furi_check(event_count);
+
+    if(memmgr_heap_trace_events) return false;
+
+    // Allocated before tracing starts, so the buffer itself is not recorded
+    MemmgrHeapTraceEvent* events = pvPortMalloc(sizeof(MemmgrHeapTraceEvent) * event_count);
+
+    bool started = false;
+    vTaskSuspendAll();
+    {
+        if(memmgr_heap_trace_events == NULL) {
+            memmgr_heap_trace_events = events;
+            memmgr_heap_trace_size = event_count;
+            memmgr_heap_trace_head = 0;
+            memmgr_heap_trace_tail = 0;
+            memmgr_heap_trace_dropped = 0;
+            memmgr_heap_trace_running = true;
+            started = true;
+        }
+    }
+    (void)xTaskResumeAll();
+
+    if(!started) vPortFree(events);
+
+    return started;
+}
+
+void memmgr_heap_trace_stop() {
+    MemmgrHeapTraceEvent* events;
+
+    vTaskSuspendAll();
+    {
+        memmgr_heap_trace_running = false;
+        events = memmgr_heap_trace_events;
+        memmgr_heap_trace_events = NULL;
+        memmgr_heap_trace_size = 0;
+        memmgr_heap_trace_head = 0;
+        memmgr_heap_trace_tail = 0;
+    }
+    (void)xTaskResumeAll();
+
+    if(events) vPortFree(events);
+}
+
+bool memmgr_heap_trace_is_running() {
+    return memmgr_heap_trace_running;
+}
+
+size_t memmgr_heap_trace_read(MemmgrHeapTraceEvent* events, size_t count) {
+    size_t read = 0;
+
+    vTaskSuspendAll();
+    {
+        while(read < count && memmgr_heap_trace_tail != memmgr_heap_trace_head) {
+            events[read++] =
+                memmgr_heap_trace_events[memmgr_heap_trace_tail % memmgr_heap_trace_size];
+            memmgr_heap_trace_tail++;
+        }
+    }
+    (void)xTaskResumeAll();
+
+    return read;
+}
+
+uint32_t memmgr_heap_trace_get_dropped_count() {
+    return memmgr_heap_trace_dropped;
+}
+
+/* Small object slabs
+ *
+ * Allocations up to the largest class size are served from pages holding objects of a
+ * single size, tracked with a bitmap. This removes per-object heap headers and keeps
+ * short lived small objects from fragmenting the heap. Pages are taken from the top of the
+ * heap when a class runs out of free objects and are returned once empty. The last page of
+ * a class is kept until a heap allocation fails. Page table is sorted by address, so
+ * ownership of a freed pointer is found with a binary search. Disabled by default, see
+ * memmgr_heap_set_slab_enabled().
+ */
+#define MEMMGR_HEAP_SLAB_PAGE_PAYLOAD (1024U)
+#define MEMMGR_HEAP_SLAB_PAGES_MAX (48U)
+#define MEMMGR_HEAP_SLAB_OBJECTS_MAX (64U)
+
+struct MemmgrHeapSlabPage {
+    MemmgrHeapSlabPage* next; /*<< Next page of the same class. */
+    uint32_t used[MEMMGR_HEAP_SLAB_OBJECTS_MAX / 32]; /*<< Allocated objects bitmap. */
+    uint8_t class_index;
+    uint8_t used_count;
+};
+
+#define MEMMGR_HEAP_SLAB_PAGE_HEADER                                     \
+    ((sizeof(MemmgrHeapSlabPage) + ((size_t)(portBYTE_ALIGNMENT - 1))) & \
+     ~((size_t)portBYTE_ALIGNMENT_MASK))
+#define MEMMGR_HEAP_SLAB_PAGE_SIZE (MEMMGR_HEAP_SLAB_PAGE_HEADER + MEMMGR_HEAP_SLAB_PAGE_PAYLOAD)
+
+typedef struct {
+    const uint16_t object_size;
+    MemmgrHeapSlabPage* pages;
+    MemmgrHeapSlabStats stats;
+} MemmgrHeapSlabClass;
+
+static MemmgrHeapSlabClass memmgr_heap_slab_classes[] = {
+    {.object_size = 16},
+    {.object_size = 32},
+    {.object_size = 64},
+    {.object_size = 128},
+    {.object_size = 256},
+};
+
+static MemmgrHeapSlabPage* memmgr_heap_slab_pages[MEMMGR_HEAP_SLAB_PAGES_MAX];
+static volatile size_t memmgr_heap_slab_page_count = 0;
+static size_t memmgr_heap_slab_free_bytes = 0;
+static bool memmgr_heap_slab_enabled = false;
+
+static inline uint8_t* memmgr_heap_slab_page_objects(MemmgrHeapSlabPage* page) {
+    return (uint8_t*)page + MEMMGR_HEAP_SLAB_PAGE_HEADER;
+}
+
+// Heap block taken by the page, may be larger than the page if the free block was not split
+static inline size_t memmgr_heap_slab_page_block_size(MemmgrHeapSlabPage* page) {
+    const BlockLink_t* link = (void*)((uint8_t*)page - xHeapStructSize);
+    return link->xBlockSize & ~xBlockAllocatedBit;
+}
+
+static inline size_t memmgr_heap_slab_page_capacity(const MemmgrHeapSlabClass* slab_class) {
+    return MEMMGR_HEAP_SLAB_PAGE_PAYLOAD / slab_class->object_size;
+}
+
+// Find the page owning the pointer, must be called with the scheduler suspended
+static MemmgrHeapSlabPage* memmgr_heap_slab_find_page(const void* pointer) {
+    size_t low = 0;
+    size_t high = memmgr_heap_slab_page_count;
+
+    while(low < high) {
+        const size_t middle = (low + high) / 2;
+        if((const void*)memmgr_heap_slab_pages[middle] <= pointer) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if(low == 0) return NULL;
+
+    MemmgrHeapSlabPage* page = memmgr_heap_slab_pages[low - 1];
+    if((const uint8_t*)pointer >= (uint8_t*)page + MEMMGR_HEAP_SLAB_PAGE_SIZE) return NULL;
+
+    return page;
+}
+
+static MemmgrHeapSlabPage* memmgr_heap_slab_page_alloc(size_t class_index) {
+    if(memmgr_heap_slab_page_count == MEMMGR_HEAP_SLAB_PAGES_MAX) return NULL;
+
+    MemmgrHeapSlabPage* page = prvMallocFromTop(MEMMGR_HEAP_SLAB_PAGE_SIZE);
+    if(page == NULL) return NULL;
+
+    memset(page, 0, MEMMGR_HEAP_SLAB_PAGE_SIZE);
+    page->class_index = class_index;
+
+    size_t index = memmgr_heap_slab_page_count;
+    while(index > 0 && memmgr_heap_slab_pages[index - 1] > page) {
+        memmgr_heap_slab_pages[index] = memmgr_heap_slab_pages[index - 1];
+        index--;
+    }
+    memmgr_heap_slab_pages[index] = page;
+    memmgr_heap_slab_page_count++;
+
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[class_index];
+    page->next = slab_class->pages;
+    slab_class->pages = page;
+    slab_class->stats.page_count++;
+    slab_class->stats.objects_total += memmgr_heap_slab_page_capacity(slab_class);
+    memmgr_heap_slab_free_bytes += memmgr_heap_slab_page_block_size(page);
+
+    return page;
+}
+
+static void memmgr_heap_slab_page_free(MemmgrHeapSlabPage* page) {
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[page->class_index];
+
+    MemmgrHeapSlabPage** link = &slab_class->pages;
+    while(*link != page) link = &(*link)->next;
+    *link = page->next;
+
+    size_t index = 0;
+    while(memmgr_heap_slab_pages[index] != page) index++;
+    memmgr_heap_slab_page_count--;
+    for(; index < memmgr_heap_slab_page_count; index++) {
+        memmgr_heap_slab_pages[index] = memmgr_heap_slab_pages[index + 1];
+    }
+
+    slab_class->stats.page_count--;
+    slab_class->stats.objects_total -= memmgr_heap_slab_page_capacity(slab_class);
+    memmgr_heap_slab_free_bytes -= memmgr_heap_slab_page_block_size(page);
+
+    prvFreeBlock(page);
+}
+
+// Allocate small object, must be called with the scheduler suspended
+static void* memmgr_heap_slab_alloc(size_t size) {
+    if(!memmgr_heap_slab_enabled || size == 0) return NULL;
+
+    size_t class_index = 0;
+    while(memmgr_heap_slab_classes[class_index].object_size < size) {
+        if(++class_index == COUNT_OF(memmgr_heap_slab_classes)) return NULL;
+    }
+
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[class_index];
+    const size_t capacity = memmgr_heap_slab_page_capacity(slab_class);
+
+    // Page with free objects is kept at the list head
+    MemmgrHeapSlabPage* page = slab_class->pages;
+    if(page && page->used_count == capacity) {
+        MemmgrHeapSlabPage* previous = page;
+        for(page = page->next; page && page->used_count == capacity; page = page->next) {
+            previous = page;
+        }
+        if(page) {
+            previous->next = page->next;
+            page->next = slab_class->pages;
+            slab_class->pages = page;
+        }
+    }
+
+    if(page == NULL) {
+        page = memmgr_heap_slab_page_alloc(class_index);
+        if(page == NULL) {
+            slab_class->stats.fallbacks++;
+            return NULL;
+        }
+    }
+
+    size_t index = 0;
+    while(page->used[index / 32] == UINT32_MAX) index += 32;
+    index += __builtin_ctz(~page->used[index / 32]);
+    page->used[index / 32] |= 1UL << (index % 32);
+    page->used_count++;
+
+    slab_class->stats.objects_used++;
+    slab_class->stats.allocations++;
+    if(page->used_count == 1) {
+        memmgr_heap_slab_free_bytes -= memmgr_heap_slab_page_block_size(page);
+        memmgr_heap_slab_free_bytes += (capacity - 1) * slab_class->object_size;
+    } else {
+        memmgr_heap_slab_free_bytes -= slab_class->object_size;
+    }
+
+    return memmgr_heap_slab_page_objects(page) + index * slab_class->object_size;
+}
+
+static bool memmgr_heap_slab_is_allocated(MemmgrHeapSlabPage* page, const void* pointer) {
+    const MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[page->class_index];
+    const size_t offset = (const uint8_t*)pointer - memmgr_heap_slab_page_objects(page);
+    const size_t index = offset / slab_class->object_size;
+
+    return (offset % slab_class->object_size) == 0 &&
+           index < memmgr_heap_slab_page_capacity(slab_class) &&
+           (page->used[index / 32] & (1UL << (index % 32))) != 0;
+}
+
+// Free small object, returns false if the pointer does not belong to the slabs
+static bool memmgr_heap_slab_free(void* pointer) {
+    // Pages are never added while their objects are being freed
+    if(memmgr_heap_slab_page_count == 0) return false;
+
+    bool is_slab = false;
+    vTaskSuspendAll();
+    {
+        MemmgrHeapSlabPage* page = memmgr_heap_slab_find_page(pointer);
+        if(page) {
+            MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[page->class_index];
+            const size_t capacity = memmgr_heap_slab_page_capacity(slab_class);
+            const size_t offset = (uint8_t*)pointer - memmgr_heap_slab_page_objects(page);
+            const size_t index = offset / slab_class->object_size;
+
+            furi_check(memmgr_heap_slab_is_allocated(page, pointer), "invalid free");
+
+            traceFREE(pointer, slab_class->object_size);
+            memset(pointer, 0, slab_class->object_size);
+            page->used[index / 32] &= ~(1UL << (index % 32));
+            page->used_count--;
+            slab_class->stats.objects_used--;
+
+            if(page->used_count == 0) {
+                memmgr_heap_slab_free_bytes -= (capacity - 1) * slab_class->object_size;
+                memmgr_heap_slab_free_bytes += memmgr_heap_slab_page_block_size(page);
+                if(slab_class->pages != page || page->next != NULL) {
+                    memmgr_heap_slab_page_free(page);
+                }
+            } else {
+                memmgr_heap_slab_free_bytes += slab_class->object_size;
+            }
+
+            is_slab = true;
+        }
+    }
+    (void)xTaskResumeAll();
+
+    return is_slab;
+}
+
+bool memmgr_heap_slab_trim() {
+    bool released = false;
+    vTaskSuspendAll();
+    {
+        for(size_t i = 0; i < COUNT_OF(memmgr_heap_slab_classes); i++) {
+            MemmgrHeapSlabPage* page = memmgr_heap_slab_classes[i].pages;
+            while(page) {
+                MemmgrHeapSlabPage* next = page->next;
+                if(page->used_count == 0) {
+                    memmgr_heap_slab_page_free(page);
+                    released = true;
+                }
+                page = next;
+            }
+        }
+    }
+    (void)xTaskResumeAll();
+
+    return released;
+}
+
+void memmgr_heap_set_slab_enabled(bool enabled) {
+    memmgr_heap_slab_enabled = enabled;
+}
+
+bool memmgr_heap_is_slab_enabled() {
+    return memmgr_heap_slab_enabled;
+}
+
+size_t memmgr_heap_get_slab_free() {
+    return memmgr_heap_slab_free_bytes;
+}
+
+size_t memmgr_heap_get_slab_class_count() {
+    return COUNT_OF(memmgr_heap_slab_classes);
+}
+
+bool memmgr_heap_get_slab_stats(size_t index, MemmgrHeapSlabStats* stats) {
+    if(index >= COUNT_OF(memmgr_heap_slab_classes)) return false;
+
+    vTaskSuspendAll();
+    {
+        *stats = memmgr_heap_slab_classes[index].stats;
+        stats->object_size = memmgr_heap_slab_classes[index].object_size;
+    }
+    (void)xTaskResumeAll();
+
+    return true;
+}
+
 size_t memmgr_heap_get_max_free_block() {
     size_t max_free_size = 0;
     BlockLink_t* pxBlock;
@@ -253,6 +659,19 @@ void memmgr_heap_printf_free_blocks() {
     }
 
     //xTaskResumeAll();
+
+    for(size_t i = 0; i < memmgr_heap_get_slab_class_count(); i++) {
+        MemmgrHeapSlabStats stats;
+        memmgr_heap_get_slab_stats(i, &stats);
+        printf(
+            "Slab %zu: pages %zu objects %zu/%zu allocations %lu fallbacks %lu\r\n",
+            stats.object_size,
+            stats.page_count,
+            stats.objects_used,
+            stats.objects_total,
+            stats.allocations,
+            stats.fallbacks);
+    }
 }
 
 #ifdef HEAP_PRINT_DEBUG
@@ -341,7 +760,7 @@ static void print_heap_free(void* ptr) {
 #endif
 /*-----------------------------------------------------------*/
 
-void* pvPortMalloc(size_t xWantedSize) {
+static void* memmgr_heap_malloc(size_t xWantedSize, void* caller) {
     BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
     void* pvReturn = NULL;
     size_t to_wipe = xWantedSize;
@@ -373,11 +792,14 @@ void* pvPortMalloc(size_t xWantedSize) {
 
     vTaskSuspendAll();
     {
+        /* Small objects are served by the slabs first. */
+        pvReturn = memmgr_heap_slab_alloc(xWantedSize);
+
         /* Check the requested block size is not so large that the top bit is
         set.  The top bit of the block size member of the BlockLink_t structure
         is used to determine who owns the block - the application or the
         kernel, so it must be free. */
-        if((xWantedSize & xBlockAllocatedBit) == 0) {
+        if(pvReturn == NULL && (xWantedSize & xBlockAllocatedBit) == 0) {
             /* The wanted size is increased so it can contain a BlockLink_t
             structure in addition to the requested amount of bytes. */
             if(xWantedSize > 0) {
@@ -466,6 +888,9 @@ void* pvPortMalloc(size_t xWantedSize) {
         }
 
         traceMALLOC(pvReturn, xWantedSize);
+        if(pvReturn) {
+            memmgr_heap_trace_record(MemmgrHeapTraceEventAlloc, pvReturn, to_wipe, caller);
+        }
     }
     (void)xTaskResumeAll();
 
@@ -484,12 +909,21 @@ void* pvPortMalloc(size_t xWantedSize) {
     }
 #endif
 
+    /* Empty slab pages may split the heap, release them and try once more. */
+    if(pvReturn == NULL && to_wipe > 0 && memmgr_heap_slab_trim()) {
+        return memmgr_heap_malloc(to_wipe, caller);
+    }
+
     configASSERT((((size_t)pvReturn) & (size_t)portBYTE_ALIGNMENT_MASK) == 0);
 
     furi_check(pvReturn, xWantedSize ? "out of memory" : "malloc(0)");
     pvReturn = memset(pvReturn, 0, to_wipe);
     return pvReturn;
 }
+
+void* pvPortMalloc(size_t xWantedSize) {
+    return memmgr_heap_malloc(xWantedSize, __builtin_return_address(0));
+}
 /*-----------------------------------------------------------*/
 
 void vPortFree(void* pv) {
@@ -500,6 +934,17 @@ void vPortFree(void* pv) {
         furi_crash("memmgt in ISR");
     }
 
+    // Recorded before the block is released, so it can't be allocated again in between
+    if(pv != NULL && memmgr_heap_trace_running) {
+        vTaskSuspendAll();
+        memmgr_heap_trace_record(MemmgrHeapTraceEventFree, pv, 0, __builtin_return_address(0));
+        (void)xTaskResumeAll();
+    }
+
+    if(pv != NULL && memmgr_heap_slab_free(pv)) {
+        return;
+    }
+
     if(pv != NULL) {
         /* The memory being freed will have an BlockLink_t structure immediately
         before it. */
@@ -616,6 +1061,63 @@ static void prvHeapInit(void) {
 }
 /*-----------------------------------------------------------*/
 
+static void* prvMallocFromTop(size_t xWantedSize) {
+    BlockLink_t *pxBlock, *pxPreviousBlock;
+    BlockLink_t *pxFoundBlock = NULL, *pxFoundPreviousBlock = NULL;
+
+    xWantedSize += xHeapStructSize;
+    if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
+        xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
+    }
+
+    /* Free list is sorted by address, the last block that fits is the highest one. */
+    pxPreviousBlock = &xStart;
+    pxBlock = xStart.pxNextFreeBlock;
+    while(pxBlock != pxEnd) {
+        if(pxBlock->xBlockSize >= xWantedSize) {
+            pxFoundBlock = pxBlock;
+            pxFoundPreviousBlock = pxPreviousBlock;
+        }
+        pxPreviousBlock = pxBlock;
+        pxBlock = pxBlock->pxNextFreeBlock;
+    }
+
+    if(pxFoundBlock == NULL) {
+        return NULL;
+    }
+
+    if((pxFoundBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+        /* Split the block, the free part stays in the list in place. */
+        pxFoundBlock->xBlockSize -= xWantedSize;
+        pxBlock = (void*)(((uint8_t*)pxFoundBlock) + pxFoundBlock->xBlockSize);
+        pxBlock->xBlockSize = xWantedSize;
+    } else {
+        pxFoundPreviousBlock->pxNextFreeBlock = pxFoundBlock->pxNextFreeBlock;
+        pxBlock = pxFoundBlock;
+    }
+
+    xFreeBytesRemaining -= pxBlock->xBlockSize;
+    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+    }
+
+    pxBlock->xBlockSize |= xBlockAllocatedBit;
+    pxBlock->pxNextFreeBlock = NULL;
+
+    return ((uint8_t*)pxBlock) + xHeapStructSize;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFreeBlock(void* pv) {
+    BlockLink_t* pxLink = (void*)(((uint8_t*)pv) - xHeapStructSize);
+
+    configASSERT((pxLink->xBlockSize & xBlockAllocatedBit) != 0);
+    pxLink->xBlockSize &= ~xBlockAllocatedBit;
+    xFreeBytesRemaining += pxLink->xBlockSize;
+    prvInsertBlockIntoFreeList(pxLink);
+}
+/*-----------------------------------------------------------*/
+
 static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert) {
     BlockLink_t* pxIterator;
     uint8_t* puc;
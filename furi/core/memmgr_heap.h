@@ -6,6 +6,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <core/thread.h>
 
 #ifdef __cplusplus
@@ -34,13 +35,124 @@ void memmgr_heap_disable_thread_trace(FuriThreadId taks_handle);
  */
 size_t memmgr_heap_get_thread_memory(FuriThreadId taks_handle);
 
+typedef enum {
+    MemmgrHeapTraceEventAlloc,
+    MemmgrHeapTraceEventFree,
+} MemmgrHeapTraceEventType;
+
+/** Heap trace event */
+typedef struct {
+    uint32_t tick;
+    uint32_t pointer;
+    uint32_t size : 24; /**< requested size, 0 for free events */
+    uint32_t type : 8; /**< MemmgrHeapTraceEventType */
+    uint32_t caller; /**< return address of the malloc or free call */
+    uint32_t thread; /**< FuriThreadId of the calling thread */
+} MemmgrHeapTraceEvent;
+
+/** Memmgr heap start allocation event tracing
+ *
+ * Every malloc and free made by any thread is appended to a ring buffer allocated here.
+ * Events are dropped while the buffer is full, read them out with
+ * memmgr_heap_trace_read() to keep up.
+ *
+ * @param      event_count  - ring buffer capacity in events
+ *
+ * @return     true on success, false if tracing is already running
+ */
+bool memmgr_heap_trace_start(size_t event_count);
+
+/** Memmgr heap stop allocation event tracing and free the ring buffer
+ *
+ * Events that were not read yet are discarded.
+ */
+void memmgr_heap_trace_stop();
+
+/** Memmgr heap check if allocation event tracing is running
+ *
+ * @return     true if running
+ */
+bool memmgr_heap_trace_is_running();
+
+/** Memmgr heap read and remove events from the trace ring buffer
+ *
+ * @param      events  - events storage
+ * @param      count   - events storage capacity
+ *
+ * @return     number of events read, in order of occurrence
+ */
+size_t memmgr_heap_trace_read(MemmgrHeapTraceEvent* events, size_t count);
+
+/** Memmgr heap get count of trace events dropped on full buffer since start
+ *
+ * @return     dropped events count
+ */
+uint32_t memmgr_heap_trace_get_dropped_count();
+
+/** Small object slab class statistics */
+typedef struct {
+    size_t object_size;
+    size_t page_count;
+    size_t objects_total; /**< capacity of all pages of the class */
+    size_t objects_used;
+    uint32_t allocations;
+    uint32_t fallbacks; /**< allocations passed to the heap, as no page could be added */
+} MemmgrHeapSlabStats;
+
+/** Memmgr heap enable or disable small object slabs
+ *
+ * Slabs are disabled by default. Objects allocated from slabs stay valid after disabling.
+ *
+ * @param      enabled  - true to serve small allocations from slabs
+ */
+void memmgr_heap_set_slab_enabled(bool enabled);
+
+/** Memmgr heap check if small object slabs are enabled
+ *
+ * @return     true if small allocations are served from slabs
+ */
+bool memmgr_heap_is_slab_enabled();
+
+/** Memmgr heap get free space inside of slab pages
+ *
+ * Slab pages are not counted as free heap, this space can only be used by objects that fit
+ * into the slab size classes.
+ *
+ * @return     free bytes in slab pages
+ */
+size_t memmgr_heap_get_slab_free();
+
+/** Memmgr heap get slab size classes count
+ *
+ * @return     count of size classes
+ */
+size_t memmgr_heap_get_slab_class_count();
+
+/** Memmgr heap get slab class statistics
+ *
+ * @param      index  - size class index, classes are sorted by object size
+ * @param      stats  - statistics storage
+ *
+ * @return     true on success, false if index is out of range
+ */
+bool memmgr_heap_get_slab_stats(size_t index, MemmgrHeapSlabStats* stats);
+
+/** Memmgr heap release empty slab pages
+ *
+ * The last page of a class is kept for reuse even when empty and is not counted as free
+ * heap. Done automatically when a heap allocation fails.
+ *
+ * @return     true if any page was released
+ */
+bool memmgr_heap_slab_trim();
+
 /** Memmgr heap get the max contiguous block size on the heap
  *
  * @return     size_t max contiguous block size
  */
 size_t memmgr_heap_get_max_free_block();
 
-/** Print the address and size of all free blocks to stdout
+/** Print the address and size of all free blocks and slab statistics to stdout
  */
 void memmgr_heap_printf_free_blocks();
 
@@ -32,6 +32,65 @@ bool elf_resolve_from_hashtable(
     return result;
 }
 
+static inline const sym_entry*
+    elf_perfect_hash_find(const PerfectHashApiInterface* interface, uint32_t hash) {
+    if(interface->table_size == 0) {
+        return nullptr;
+    }
+
+    const size_t bucket = api_phf_bucket(hash, interface->bucket_count);
+    const size_t slot =
+        api_phf_slot(hash, interface->displacements[bucket], interface->table_size);
+    const sym_entry* entry = &interface->table[slot];
+    return entry->hash == hash ? entry : nullptr;
+}
+
+bool elf_resolve_from_perfect_hash(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    const PerfectHashApiInterface* phf_interface =
+        static_cast<const PerfectHashApiInterface*>(interface);
+
+    const sym_entry* entry = elf_perfect_hash_find(phf_interface, hash);
+    if(!entry) {
+        FURI_LOG_W(TAG, "Can't find symbol with hash %lx @ %p!", hash, phf_interface->table);
+        return false;
+    }
+
+    *address = entry->address;
+    return true;
+}
+
+size_t elf_resolve_batch(
+    const ElfApiInterface* interface,
+    const uint32_t* hashes,
+    Elf32_Addr* addresses,
+    size_t count) {
+    size_t resolved = 0;
+
+    if(interface->resolver_callback == &elf_resolve_from_perfect_hash) {
+        // Inline lookups, no logging for every missing symbol
+        const PerfectHashApiInterface* phf_interface =
+            static_cast<const PerfectHashApiInterface*>(interface);
+        for(size_t i = 0; i < count; i++) {
+            const sym_entry* entry = elf_perfect_hash_find(phf_interface, hashes[i]);
+            addresses[i] = entry ? entry->address : 0;
+            resolved += entry ? 1 : 0;
+        }
+    } else {
+        for(size_t i = 0; i < count; i++) {
+            if(interface->resolver_callback(interface, hashes[i], &addresses[i])) {
+                resolved++;
+            } else {
+                addresses[i] = 0;
+            }
+        }
+    }
+
+    return resolved;
+}
+
 uint32_t elf_symbolname_hash(const char* s) {
     return elf_gnu_hash(s);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <flipper_application/elf/elf_api_interface.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -28,6 +29,32 @@ bool elf_resolve_from_hashtable(
     uint32_t hash,
     Elf32_Addr* address);
 
+/**
+ * @brief Resolver for API entries using a minimal perfect hash
+ * @param interface pointer to PerfectHashApiInterface
+ * @param hash gnu hash of function name
+ * @param address output for function address
+ * @return true if the table contains a function
+ */
+bool elf_resolve_from_perfect_hash(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address);
+
+/**
+ * @brief Resolve multiple symbols in one call
+ * @param interface API interface
+ * @param hashes gnu hashes of symbol names
+ * @param addresses output for symbol addresses, 0 for symbols that are not found
+ * @param count number of symbols
+ * @return number of resolved symbols
+ */
+size_t elf_resolve_batch(
+    const ElfApiInterface* interface,
+    const uint32_t* hashes,
+    Elf32_Addr* addresses,
+    size_t count);
+
 uint32_t elf_symbolname_hash(const char* s);
 
 #ifdef __cplusplus
@@ -55,6 +82,53 @@ struct HashtableApiInterface : public ElfApiInterface {
         .hash = elf_gnu_hash(#x), .address = (uint32_t)(&(x)), \
     }
 
+/**
+ * @brief  PerfectHashApiInterface is an implementation of ElfApiInterface
+ * that uses a minimal perfect hash built by scripts/fbt/sdk/perfect_hash.py.
+ * table must be ordered by hash slots, displacements hold one value per bucket
+ */
+struct PerfectHashApiInterface : public ElfApiInterface {
+    const sym_entry* table;
+    size_t table_size;
+    const uint16_t* displacements;
+    size_t bucket_count;
+};
+
+constexpr uint32_t api_phf_mix(uint32_t value) {
+    value ^= value >> 16;
+    value *= 0x85EBCA6BU;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35U;
+    value ^= value >> 16;
+    return value;
+}
+
+constexpr size_t api_phf_bucket(uint32_t hash, size_t bucket_count) {
+    return ((uint64_t)api_phf_mix(hash) * bucket_count) >> 32;
+}
+
+constexpr size_t api_phf_slot(uint32_t hash, uint16_t displacement, size_t size) {
+    const uint32_t seed = displacement * 0x9E3779B9U;
+    return ((uint64_t)api_phf_mix(api_phf_mix(hash) ^ seed) * size) >> 32;
+}
+
+/* Compile-time check that every entry is placed in its perfect hash slot.
+ * Usage: static_assert(is_perfect_hash_valid(api_methods, displacements), "Invalid hash");
+ */
+template <std::size_t N, std::size_t B>
+constexpr bool is_perfect_hash_valid(
+    const std::array<sym_entry, N>& api_methods,
+    const std::array<uint16_t, B>& displacements) {
+    for(std::size_t i = 0; i < N; ++i) {
+        const uint32_t hash = api_methods[i].hash;
+        if(api_phf_slot(hash, displacements[api_phf_bucket(hash, B)], N) != i) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 constexpr bool operator<(const sym_entry& k1, const sym_entry& k2) {
     return k1.hash < k2.hash;
 }
@@ -1,7 +1,10 @@
 #include "elf_file.h"
 #include "elf_file_i.h"
 
+#include <furi_hal.h>
 #include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+#include <toolbox/path.h>
 #include <elf.h>
 #include "elf_api_interface.h"
 #include "../api_hashtable/api_hashtable.h"
@@ -11,9 +14,18 @@
 #define ELF_NAME_BUFFER_LEN 32
 #define SECTION_OFFSET(e, n) ((e)->section_table + (n) * sizeof(Elf32_Shdr))
 #define IS_FLAGS_SET(v, m) (((v) & (m)) == (m))
-#define RESOLVER_THREAD_YIELD_STEP 30
 #define FAST_RELOCATION_VERSION 1
 
+#define ELF_RELOCATION_BATCH 64
+#define ELF_SYMBOL_BUFFER_SIZE 512
+#define ELF_STRING_BUFFER_SIZE 256
+
+#define ELF_CACHE_MAGIC 0x43504146
+#define ELF_CACHE_VERSION 2
+#define ELF_CACHE_META_SIZE_MAX (16U * 1024U)
+#define ELF_CACHE_DIR_SIZE_MAX (1024U * 1024U)
+#define ELF_CACHE_TEMP_EXTENSION ".tmp"
+
 // #define ELF_DEBUG_LOG 1
 
 #ifndef ELF_DEBUG_LOG
@@ -55,6 +67,77 @@ static void address_cache_put(AddressCache_t cache, int symEntry, Elf32_Addr sym
     AddressCache_set_at(cache, symEntry, symAddr);
 }
 
+static void elf_buffer_free(ELFFileBuffer* buffer) {
+    if(buffer->data) {
+        free(buffer->data);
+        buffer->data = NULL;
+    }
+    buffer->size = 0;
+}
+
+/**
+ * Refill buffer with file data starting at offset
+ * @return false if there is no data at offset
+ */
+static bool elf_buffer_fill(ELFFile* elf, ELFFileBuffer* buffer, off_t offset) {
+    uint32_t start = DWT->CYCCNT;
+
+    if(!buffer->data) {
+        buffer->data = malloc(buffer->capacity);
+    }
+
+    buffer->offset = offset;
+    buffer->size = 0;
+    if(storage_file_seek(elf->fd, offset, true)) {
+        buffer->size = storage_file_read(elf->fd, buffer->data, buffer->capacity);
+    }
+
+    elf->load_cycles.read += DWT->CYCCNT - start;
+    return buffer->size > 0;
+}
+
+static bool elf_buffer_contains(ELFFileBuffer* buffer, off_t offset, size_t size) {
+    return offset >= buffer->offset && offset + size <= buffer->offset + buffer->size;
+}
+
+static bool
+    elf_buffer_read(ELFFile* elf, ELFFileBuffer* buffer, off_t offset, void* data, size_t size) {
+    furi_assert(size <= buffer->capacity);
+
+    if(!elf_buffer_contains(buffer, offset, size)) {
+        if(!elf_buffer_fill(elf, buffer, offset) || buffer->size < size) {
+            return false;
+        }
+    }
+
+    memcpy(data, &buffer->data[offset - buffer->offset], size);
+    return true;
+}
+
+static bool
+    elf_buffer_read_string(ELFFile* elf, ELFFileBuffer* buffer, off_t offset, FuriString* str) {
+    while(true) {
+        if(!elf_buffer_contains(buffer, offset, 1)) {
+            if(!elf_buffer_fill(elf, buffer, offset)) {
+                return false;
+            }
+        }
+
+        const char* chunk = (const char*)&buffer->data[offset - buffer->offset];
+        size_t available = buffer->offset + buffer->size - offset;
+        size_t length = strnlen(chunk, available);
+        for(size_t i = 0; i < length; i++) {
+            furi_string_push_back(str, chunk[i]);
+        }
+
+        if(length < available) {
+            return true;
+        }
+        // String continues past the buffered data
+        offset += length;
+    }
+}
+
 /**************************************************************************************************/
 /********************************************** ELF ***********************************************/
 /**************************************************************************************************/
@@ -80,6 +163,8 @@ static ELFSection* elf_file_get_or_put_section(ELFFile* elf, const char* name) {
                 .data = NULL,
                 .sec_idx = 0,
                 .size = 0,
+                .type = 0,
+                .align = 0,
                 .rel_count = 0,
                 .rel_offset = 0,
                 .fast_rel = NULL,
@@ -123,7 +208,8 @@ static bool elf_read_section_name(ELFFile* elf, off_t offset, FuriString* name)
 }
 
 static bool elf_read_symbol_name(ELFFile* elf, off_t offset, FuriString* name) {
-    return elf_read_string_from_offset(elf, elf->symbol_table_strings + offset, name);
+    return elf_buffer_read_string(
+        elf, &elf->string_buffer, elf->symbol_table_strings + offset, name);
 }
 
 static bool elf_read_section_header(ELFFile* elf, size_t section_idx, Elf32_Shdr* section_header) {
@@ -148,21 +234,24 @@ static bool elf_read_section(
     return true;
 }
 
+/**
+ * Read symbol, symbol name is only read if name is not NULL
+ * File position is not preserved
+ */
 static bool elf_read_symbol(ELFFile* elf, int n, Elf32_Sym* sym, FuriString* name) {
-    bool success = false;
-    off_t old = storage_file_tell(elf->fd);
     off_t pos = elf->symbol_table + n * sizeof(Elf32_Sym);
-    if(storage_file_seek(elf->fd, pos, true) &&
-       storage_file_read(elf->fd, sym, sizeof(Elf32_Sym)) == sizeof(Elf32_Sym)) {
-        if(sym->st_name)
-            success = elf_read_symbol_name(elf, sym->st_name, name);
-        else {
-            Elf32_Shdr shdr;
-            success = elf_read_section(elf, sym->st_shndx, &shdr, name);
-        }
+    if(!elf_buffer_read(elf, &elf->symbol_buffer, pos, sym, sizeof(Elf32_Sym))) {
+        return false;
+    }
+
+    if(!name) {
+        return true;
+    } else if(sym->st_name) {
+        return elf_read_symbol_name(elf, sym->st_name, name);
+    } else {
+        Elf32_Shdr shdr;
+        return elf_read_section(elf, sym->st_shndx, &shdr, name);
     }
-    storage_file_seek(elf->fd, old, true);
-    return success;
 }
 
 static ELFSection* elf_section_of(ELFFile* elf, int index) {
@@ -322,7 +411,8 @@ static void elf_relocate_mov(Elf32_Addr relAddr, int type, Elf32_Addr symAddr) {
                               | (addr & 0x00FF); /* imm8 */
 }
 
-static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf32_Addr symAddr) {
+static bool
+    elf_relocate_symbol_impl(ELFFile* elf, Elf32_Addr relAddr, int type, Elf32_Addr symAddr) {
     switch(type) {
     case R_ARM_TARGET1:
     case R_ARM_ABS32:
@@ -351,72 +441,127 @@ static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf3
     return true;
 }
 
+static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf32_Addr symAddr) {
+    uint32_t start = DWT->CYCCNT;
+    bool result = elf_relocate_symbol_impl(elf, relAddr, type, symAddr);
+    elf->load_cycles.relocate += DWT->CYCCNT - start;
+    elf->load_stats.relocation_count++;
+    return result;
+}
+
+static Elf32_Addr elf_resolve_symbol(ELFFile* elf, int symEntry, FuriString* symbol_name) {
+    Elf32_Sym sym;
+    furi_string_reset(symbol_name);
+    if(!elf_read_symbol(elf, symEntry, &sym, NULL)) {
+        FURI_LOG_E(TAG, "  symbol read fail");
+        return ELF_INVALID_ADDRESS;
+    }
+
+    // Only imports are resolved by name, local symbols are resolved by section
+    if(sym.st_shndx == SHN_UNDEF && sym.st_name &&
+       !elf_read_symbol_name(elf, sym.st_name, symbol_name)) {
+        FURI_LOG_E(TAG, "  symbol name read fail");
+        return ELF_INVALID_ADDRESS;
+    }
+
+    uint32_t start = DWT->CYCCNT;
+    Elf32_Addr symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
+    elf->load_cycles.resolve += DWT->CYCCNT - start;
+    elf->load_stats.symbol_count++;
+
+    return symAddr;
+}
+
+static bool elf_read_relocations(
+    ELFFile* elf,
+    ELFSection* s,
+    size_t first,
+    Elf32_Rel* rels,
+    size_t count) {
+    uint32_t start = DWT->CYCCNT;
+    const size_t size = count * sizeof(Elf32_Rel);
+    bool result = storage_file_seek(elf->fd, s->rel_offset + first * sizeof(Elf32_Rel), true) &&
+                  storage_file_read(elf->fd, rels, size) == size;
+    elf->load_cycles.read += DWT->CYCCNT - start;
+    return result;
+}
+
 static bool elf_relocate(ELFFile* elf, ELFSection* s) {
     if(s->data) {
-        Elf32_Rel rel;
+        // Only sections with plain relocations need the cache, it is shared by all of them
+        if(!elf->relocation_cache && elf->symbol_count > 0) {
+            elf->relocation_cache = malloc(sizeof(Elf32_Addr) * elf->symbol_count);
+        }
+
+        Elf32_Rel* rels = malloc(sizeof(Elf32_Rel) * ELF_RELOCATION_BATCH);
         size_t relEntries = s->rel_count;
-        size_t relCount;
-        (void)storage_file_seek(elf->fd, s->rel_offset, true);
         FURI_LOG_D(TAG, " Offset   Info     Type             Name");
 
         int relocate_result = true;
         FuriString* symbol_name;
         symbol_name = furi_string_alloc();
 
-        for(relCount = 0; relCount < relEntries; relCount++) {
-            if(relCount % RESOLVER_THREAD_YIELD_STEP == 0) {
-                FURI_LOG_D(TAG, "  reloc YIELD");
-                furi_delay_tick(1);
-            }
+        for(size_t batch = 0; batch < relEntries; batch += ELF_RELOCATION_BATCH) {
+            size_t batchCount = MIN((size_t)ELF_RELOCATION_BATCH, relEntries - batch);
 
-            if(storage_file_read(elf->fd, &rel, sizeof(Elf32_Rel)) != sizeof(Elf32_Rel)) {
+            // Symbol reads move file position, so every batch seeks explicitly
+            if(!elf_read_relocations(elf, s, batch, rels, batchCount)) {
                 FURI_LOG_E(TAG, "  reloc read fail");
-                furi_string_free(symbol_name);
-                return false;
+                relocate_result = false;
+                break;
             }
 
-            Elf32_Addr symAddr;
-
-            int symEntry = ELF32_R_SYM(rel.r_info);
-            int relType = ELF32_R_TYPE(rel.r_info);
-            Elf32_Addr relAddr = ((Elf32_Addr)s->data) + rel.r_offset;
+            for(size_t relCount = 0; relCount < batchCount; relCount++) {
+                Elf32_Rel* rel = &rels[relCount];
+                int symEntry = ELF32_R_SYM(rel->r_info);
+                int relType = ELF32_R_TYPE(rel->r_info);
+                Elf32_Addr relAddr = ((Elf32_Addr)s->data) + rel->r_offset;
 
-            if(!address_cache_get(elf->relocation_cache, symEntry, &symAddr)) {
-                Elf32_Sym sym;
-                furi_string_reset(symbol_name);
-                if(!elf_read_symbol(elf, symEntry, &sym, symbol_name)) {
-                    FURI_LOG_E(TAG, "  symbol read fail");
-                    furi_string_free(symbol_name);
-                    return false;
+                if((size_t)symEntry >= elf->symbol_count) {
+                    FURI_LOG_E(TAG, "  symbol index %d out of range", symEntry);
+                    relocate_result = false;
+                    continue;
                 }
 
-                FURI_LOG_D(
-                    TAG,
-                    " %08X %08X %-16s %s",
-                    (unsigned int)rel.r_offset,
-                    (unsigned int)rel.r_info,
-                    elf_reloc_type_to_str(relType),
-                    furi_string_get_cstr(symbol_name));
-
-                symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
-                address_cache_put(elf->relocation_cache, symEntry, symAddr);
-            }
+                // Zero means not resolved yet, resolved address is never zero
+                Elf32_Addr symAddr = elf->relocation_cache[symEntry];
+                if(symAddr == 0) {
+                    symAddr = elf_resolve_symbol(elf, symEntry, symbol_name);
+                    elf->relocation_cache[symEntry] = symAddr;
+
+                    FURI_LOG_D(
+                        TAG,
+                        " %08X %08X %-16s %s",
+                        (unsigned int)rel->r_offset,
+                        (unsigned int)rel->r_info,
+                        elf_reloc_type_to_str(relType),
+                        furi_string_get_cstr(symbol_name));
+                }
 
-            if(symAddr != ELF_INVALID_ADDRESS) {
-                FURI_LOG_D(
-                    TAG,
-                    "  symAddr=%08X relAddr=%08X",
-                    (unsigned int)symAddr,
-                    (unsigned int)relAddr);
-                if(!elf_relocate_symbol(elf, relAddr, relType, symAddr)) {
+                if(symAddr != ELF_INVALID_ADDRESS) {
+                    FURI_LOG_D(
+                        TAG,
+                        "  symAddr=%08X relAddr=%08X",
+                        (unsigned int)symAddr,
+                        (unsigned int)relAddr);
+                    if(!elf_relocate_symbol(elf, relAddr, relType, symAddr)) {
+                        relocate_result = false;
+                    }
+                } else {
+                    Elf32_Sym sym;
+                    furi_string_reset(symbol_name);
+                    elf_read_symbol(elf, symEntry, &sym, symbol_name);
+                    FURI_LOG_E(
+                        TAG, "  No symbol address of %s", furi_string_get_cstr(symbol_name));
                     relocate_result = false;
                 }
-            } else {
-                FURI_LOG_E(TAG, "  No symbol address of %s", furi_string_get_cstr(symbol_name));
-                relocate_result = false;
             }
+
+            FURI_LOG_D(TAG, "  reloc YIELD");
+            furi_thread_yield();
         }
         furi_string_free(symbol_name);
+        free(rels);
 
         return relocate_result;
     } else {
@@ -456,6 +601,9 @@ static bool str_prefix(const char* str, const char* prefix) {
 }
 
 static bool elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr* section_header) {
+    section->type = section_header->sh_type;
+    section->align = section_header->sh_addralign;
+
     if(section_header->sh_size == 0) {
         FURI_LOG_D(TAG, "No data for section");
         return true;
@@ -469,9 +617,13 @@ static bool elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr*
         return true;
     }
 
-    if((!storage_file_seek(elf->fd, section_header->sh_offset, true)) ||
-       (storage_file_read(elf->fd, section->data, section_header->sh_size) !=
-        section_header->sh_size)) {
+    uint32_t start = DWT->CYCCNT;
+    bool result = storage_file_seek(elf->fd, section_header->sh_offset, true) &&
+                  storage_file_read(elf->fd, section->data, section_header->sh_size) ==
+                      section_header->sh_size;
+    elf->load_cycles.read += DWT->CYCCNT - start;
+
+    if(!result) {
         FURI_LOG_E(TAG, "    seek/read fail");
         return false;
     }
@@ -480,6 +632,19 @@ static bool elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr*
     return true;
 }
 
+static void elf_file_register_section_type(ELFFile* elf, ELFSection* section_p, Elf32_Word type) {
+    if(type == SHT_PREINIT_ARRAY) {
+        furi_assert(elf->preinit_array == NULL);
+        elf->preinit_array = section_p;
+    } else if(type == SHT_INIT_ARRAY) {
+        furi_assert(elf->init_array == NULL);
+        elf->init_array = section_p;
+    } else if(type == SHT_FINI_ARRAY) {
+        furi_assert(elf->fini_array == NULL);
+        elf->fini_array = section_p;
+    }
+}
+
 static SectionType elf_preload_section(
     ELFFile* elf,
     size_t section_idx,
@@ -529,17 +694,7 @@ static SectionType elf_preload_section(
     if(section_header->sh_flags & SHF_ALLOC) {
         ELFSection* section_p = elf_file_get_or_put_section(elf, name);
         section_p->sec_idx = section_idx;
-
-        if(section_header->sh_type == SHT_PREINIT_ARRAY) {
-            furi_assert(elf->preinit_array == NULL);
-            elf->preinit_array = section_p;
-        } else if(section_header->sh_type == SHT_INIT_ARRAY) {
-            furi_assert(elf->init_array == NULL);
-            elf->init_array = section_p;
-        } else if(section_header->sh_type == SHT_FINI_ARRAY) {
-            furi_assert(elf->fini_array == NULL);
-            elf->fini_array = section_p;
-        }
+        elf_file_register_section_type(elf, section_p, section_header->sh_type);
 
         if(!elf_load_section_data(elf, section_p, section_header)) {
             FURI_LOG_E(TAG, "Error loading section '%s'", name);
@@ -606,14 +761,6 @@ static SectionType elf_preload_section(
     return SectionTypeUnused;
 }
 
-static Elf32_Addr elf_address_of_by_hash(ELFFile* elf, uint32_t hash) {
-    Elf32_Addr addr = 0;
-    if(elf->api_interface->resolver_callback(elf->api_interface, hash, &addr)) {
-        return addr;
-    }
-    return ELF_INVALID_ADDRESS;
-}
-
 static bool elf_file_find_string_by_hash(ELFFile* elf, uint32_t hash, FuriString* out) {
     bool result = false;
 
@@ -634,8 +781,38 @@ static bool elf_file_find_string_by_hash(ELFFile* elf, uint32_t hash, FuriString
     return result;
 }
 
+/**
+ * Resolve all imports of fast relocation records in one batch
+ * @return addresses of imports in record order, 0 for unresolved ones, NULL if there are none
+ */
+static Elf32_Addr* elf_resolve_fast_imports(ELFFile* elf, const uint8_t* start, uint32_t count) {
+    uint32_t* hashes = malloc(count * sizeof(uint32_t));
+    size_t imports_count = 0;
+
+    for(uint32_t i = 0; i < count; i++) {
+        const bool is_section = (*start & (0x1 << 7)) ? true : false;
+        start += 1;
+        if(!is_section) {
+            hashes[imports_count++] = *((uint32_t*)start);
+        }
+        start += is_section ? 8 : 4;
+        const uint32_t offsets_count = *((uint32_t*)start);
+        start += 4 + 3 * offsets_count;
+    }
+
+    Elf32_Addr* addresses = NULL;
+    if(imports_count) {
+        addresses = malloc(imports_count * sizeof(Elf32_Addr));
+        uint32_t cycles = DWT->CYCCNT;
+        elf_resolve_batch(elf->api_interface, hashes, addresses, imports_count);
+        elf->load_cycles.resolve += DWT->CYCCNT - cycles;
+    }
+
+    free(hashes);
+    return addresses;
+}
+
 static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
-    UNUSED(elf);
     const uint8_t* start = s->fast_rel->data;
     const uint8_t version = *start;
     bool no_errors = true;
@@ -650,6 +827,9 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
     start += 4;
     FURI_LOG_D(TAG, "Fast relocation records count: %ld", records_count);
 
+    Elf32_Addr* imports = elf_resolve_fast_imports(elf, start, records_count);
+    size_t import_index = 0;
+
     for(uint32_t i = 0; i < records_count; i++) {
         bool is_section = (*start & (0x1 << 7)) ? true : false;
         uint8_t type = *start & 0x7F;
@@ -682,8 +862,12 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
                 address = ((Elf32_Addr)symSec->data) + section_value;
             }
         } else {
-            address = elf_address_of_by_hash(elf, hash_or_section_index);
+            address = imports[import_index++];
+            if(!address) {
+                address = ELF_INVALID_ADDRESS;
+            }
         }
+        elf->load_stats.symbol_count++;
 
         if(address == ELF_INVALID_ADDRESS) {
             FuriString* symbol_name = furi_string_alloc();
@@ -713,6 +897,7 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
         }
     }
 
+    free(imports);
     aligned_free(s->fast_rel->data);
     free(s->fast_rel);
     s->fast_rel = NULL;
@@ -752,16 +937,532 @@ static void elf_file_call_section_list(ELFSection* section, bool reverse_order)
     }
 }
 
+static void elf_file_free_sections(ELFFile* elf) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        if(itref->value.data) {
+            aligned_free(itref->value.data);
+        }
+        if(itref->value.fast_rel) {
+            aligned_free(itref->value.fast_rel->data);
+            free(itref->value.fast_rel);
+        }
+        free((void*)itref->key);
+    }
+
+    ELFSectionDict_reset(elf->sections);
+    elf->preinit_array = NULL;
+    elf->init_array = NULL;
+    elf->fini_array = NULL;
+}
+
+/**************************************************************************************************/
+/****************************************** Image cache *******************************************/
+/**************************************************************************************************/
+
+/*
+ * Image cache keeps section data before relocation together with fast relocation records,
+ * so the next load restores sections with bulk reads instead of parsing the section table.
+ * Sections are placed at different addresses on each load and imports are resolved by hash,
+ * so relocation itself is still performed, but without reading the ELF file.
+ *
+ * Layout: header, meta (debug link, section directory, section records), section data.
+ * Image is written to a temporary file and renamed into place once complete, oldest images
+ * are removed when the cache directory grows over ELF_CACHE_DIR_SIZE_MAX.
+ */
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint16_t api_version_major;
+    uint16_t api_version_minor;
+    uint32_t file_size;
+    uint32_t headers_crc; /**< crc32 of the section header table */
+    uint32_t symbol_table;
+    uint32_t symbol_count;
+    uint32_t symbol_table_strings;
+    uint32_t debug_link_size;
+    uint32_t directory_count;
+    uint32_t section_count;
+    uint32_t meta_size;
+    uint32_t meta_crc;
+} ELFCacheHeader;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t size;
+    uint8_t name_size; /**< including terminator, name follows the record */
+} ELFCacheDirectoryRecord;
+
+typedef struct {
+    uint16_t sec_idx;
+    uint32_t type;
+    uint32_t size;
+    uint32_t align;
+    uint32_t fast_rel_size;
+    uint32_t fast_rel_align;
+    uint8_t name_size; /**< including terminator, name follows the record */
+} ELFCacheSectionRecord;
+
+#pragma pack(pop)
+
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    size_t position;
+} ELFCacheMetaReader;
+
+static const void* elf_cache_meta_take(ELFCacheMetaReader* reader, size_t size) {
+    if(size > reader->size - reader->position) {
+        return NULL;
+    }
+    const void* data = &reader->data[reader->position];
+    reader->position += size;
+    return data;
+}
+
+static const char* elf_cache_meta_take_name(ELFCacheMetaReader* reader, uint8_t name_size) {
+    const char* name = elf_cache_meta_take(reader, name_size);
+    if(!name || name_size == 0 || name[name_size - 1] != '\0') {
+        return NULL;
+    }
+    return name;
+}
+
+static bool elf_file_get_headers_crc(ELFFile* elf, uint32_t* crc) {
+    const size_t size = elf->sections_count * sizeof(Elf32_Shdr);
+    uint8_t* headers = malloc(size);
+    bool result = storage_file_seek(elf->fd, elf->section_table, true) &&
+                  storage_file_read(elf->fd, headers, size) == size;
+    if(result) {
+        *crc = crc32_calc_buffer(0, headers, size);
+    }
+    free(headers);
+    return result;
+}
+
+static const ELFCacheEntry* elf_file_cache_find(ELFFile* elf, const char* name) {
+    for(size_t i = 0; i < elf->cache_directory_count; i++) {
+        if(strcmp(elf->cache_directory[i].name, name) == 0) {
+            return &elf->cache_directory[i];
+        }
+    }
+    return NULL;
+}
+
+static void elf_file_cache_release(ELFFile* elf) {
+    if(elf->cache_directory) {
+        free(elf->cache_directory);
+        elf->cache_directory = NULL;
+    }
+    elf->cache_directory_count = 0;
+
+    if(elf->cache_meta) {
+        free(elf->cache_meta);
+        elf->cache_meta = NULL;
+    }
+}
+
+static bool elf_file_cache_read_data(
+    File* cache,
+    ELFSection* section,
+    uint32_t type,
+    uint32_t size,
+    uint32_t align) {
+    section->type = type;
+    section->align = align;
+    section->size = size;
+
+    if(size == 0) {
+        return true;
+    }
+
+    section->data = aligned_malloc(size, align);
+    return type == SHT_NOBITS || storage_file_read(cache, section->data, size) == size;
+}
+
+/* Debug link holds crc32 of the unstripped file, it changes with any code change */
+static bool elf_file_cache_check_debug_link(ELFFile* elf, const void* debug_link, size_t size) {
+    const ELFCacheEntry* entry = elf_file_cache_find(elf, ".gnu_debuglink");
+    if(!entry || entry->size != size) {
+        return false;
+    }
+
+    elf->debug_link_info.debug_link_size = size;
+    elf->debug_link_info.debug_link = malloc(size);
+    return storage_file_seek(elf->fd, entry->offset, true) &&
+           storage_file_read(elf->fd, elf->debug_link_info.debug_link, size) == size &&
+           memcmp(elf->debug_link_info.debug_link, debug_link, size) == 0;
+}
+
+static bool elf_file_cache_restore(
+    ELFFile* elf,
+    File* cache,
+    const ELFCacheHeader* header,
+    uint64_t data_size) {
+    ELFCacheMetaReader reader = {
+        .data = elf->cache_meta,
+        .size = header->meta_size,
+        .position = 0,
+    };
+
+    const void* debug_link = elf_cache_meta_take(&reader, header->debug_link_size);
+    if(!debug_link) return false;
+
+    elf->cache_directory = malloc(sizeof(ELFCacheEntry) * header->directory_count);
+    for(size_t i = 0; i < header->directory_count; i++) {
+        const ELFCacheDirectoryRecord* record =
+            elf_cache_meta_take(&reader, sizeof(ELFCacheDirectoryRecord));
+        if(!record) return false;
+
+        ELFCacheEntry* entry = &elf->cache_directory[elf->cache_directory_count];
+        entry->name = elf_cache_meta_take_name(&reader, record->name_size);
+        entry->offset = record->offset;
+        entry->size = record->size;
+        if(!entry->name) return false;
+        elf->cache_directory_count++;
+    }
+
+    if(!elf_file_cache_check_debug_link(elf, debug_link, header->debug_link_size)) {
+        return false;
+    }
+
+    for(size_t i = 0; i < header->section_count; i++) {
+        const ELFCacheSectionRecord* record =
+            elf_cache_meta_take(&reader, sizeof(ELFCacheSectionRecord));
+        if(!record) return false;
+
+        const char* name = elf_cache_meta_take_name(&reader, record->name_size);
+        if(!name) return false;
+
+        // Section data must be present in the cache, only .bss has no data
+        const uint64_t record_data_size =
+            (record->type == SHT_NOBITS ? 0 : record->size) + record->fast_rel_size;
+        if(record_data_size > data_size) return false;
+        data_size -= record_data_size;
+
+        ELFSection* section_p = elf_file_get_or_put_section(elf, name);
+        section_p->sec_idx = record->sec_idx;
+        elf_file_register_section_type(elf, section_p, record->type);
+
+        if(!elf_file_cache_read_data(
+               cache, section_p, record->type, record->size, record->align)) {
+            return false;
+        }
+
+        if(record->fast_rel_size) {
+            section_p->fast_rel = malloc(sizeof(ELFSection));
+            if(!elf_file_cache_read_data(
+                   cache,
+                   section_p->fast_rel,
+                   SHT_PROGBITS,
+                   record->fast_rel_size,
+                   record->fast_rel_align)) {
+                return false;
+            }
+        }
+    }
+
+    elf->symbol_table = header->symbol_table;
+    elf->symbol_count = header->symbol_count;
+    elf->symbol_table_strings = header->symbol_table_strings;
+    return true;
+}
+
+static bool elf_file_cache_load(ELFFile* elf) {
+    bool result = false;
+    uint32_t start = DWT->CYCCNT;
+    File* cache = storage_file_alloc(elf->storage);
+    ELFCacheHeader header;
+    uint32_t headers_crc;
+
+    do {
+        if(!storage_file_open(
+               cache, furi_string_get_cstr(elf->cache_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+
+        const uint64_t cache_size = storage_file_size(cache);
+        if(storage_file_read(cache, &header, sizeof(header)) != sizeof(header) ||
+           header.magic != ELF_CACHE_MAGIC || header.version != ELF_CACHE_VERSION ||
+           header.meta_size == 0 || header.meta_size > ELF_CACHE_META_SIZE_MAX ||
+           header.meta_size > cache_size - sizeof(header) || header.directory_count == 0 ||
+           header.directory_count > header.meta_size / sizeof(ELFCacheDirectoryRecord) ||
+           header.section_count == 0 ||
+           header.section_count > header.meta_size / sizeof(ELFCacheSectionRecord)) {
+            FURI_LOG_W(TAG, "Image cache is invalid");
+            break;
+        }
+
+        if(header.api_version_major != elf->api_interface->api_version_major ||
+           header.api_version_minor != elf->api_interface->api_version_minor ||
+           header.file_size != storage_file_size(elf->fd) ||
+           !elf_file_get_headers_crc(elf, &headers_crc) || header.headers_crc != headers_crc) {
+            FURI_LOG_I(TAG, "Image cache is outdated");
+            break;
+        }
+
+        elf->cache_meta = malloc(header.meta_size);
+        if(storage_file_read(cache, elf->cache_meta, header.meta_size) != header.meta_size ||
+           crc32_calc_buffer(0, elf->cache_meta, header.meta_size) != header.meta_crc) {
+            FURI_LOG_W(TAG, "Image cache is invalid");
+            break;
+        }
+
+        result = elf_file_cache_restore(
+            elf, cache, &header, cache_size - sizeof(header) - header.meta_size);
+        if(!result) {
+            FURI_LOG_W(TAG, "Image cache restore failed");
+        }
+    } while(false);
+
+    storage_file_free(cache);
+    elf->load_cycles.read += DWT->CYCCNT - start;
+
+    return result;
+}
+
+static bool elf_file_cache_is_supported(ELFFile* elf) {
+    if(!elf->debug_link_info.debug_link) {
+        return false;
+    }
+
+    // Only fast relocation records are position independent and can be stored as is
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        if(itref->value.rel_count && !itref->value.fast_rel) {
+            return false;
+        }
+        if(strlen(itref->key) >= UINT8_MAX) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool elf_file_cache_write_name(File* cache, const char* name) {
+    const uint8_t name_size = strlen(name) + 1;
+    return storage_file_write(cache, name, name_size) == name_size;
+}
+
+static bool elf_file_cache_write_directory(ELFFile* elf, File* cache, uint32_t* count) {
+    bool result = true;
+    FuriString* name = furi_string_alloc();
+
+    for(size_t section_idx = 1; section_idx < elf->sections_count && result; section_idx++) {
+        Elf32_Shdr section_header;
+        furi_string_reset(name);
+
+        if(!elf_read_section(elf, section_idx, &section_header, name)) {
+            result = false;
+        } else if(furi_string_size(name) && furi_string_size(name) < UINT8_MAX) {
+            ELFCacheDirectoryRecord record = {
+                .offset = section_header.sh_offset,
+                .size = section_header.sh_size,
+                .name_size = furi_string_size(name) + 1,
+            };
+            result = storage_file_write(cache, &record, sizeof(record)) == sizeof(record) &&
+                     elf_file_cache_write_name(cache, furi_string_get_cstr(name));
+            (*count)++;
+        }
+    }
+
+    furi_string_free(name);
+    return result;
+}
+
+static bool elf_file_cache_write_section_records(ELFFile* elf, File* cache, uint32_t* count) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
+        const ELFSection* section = &itref->value;
+        ELFCacheSectionRecord record = {
+            .sec_idx = section->sec_idx,
+            .type = section->type,
+            .size = section->size,
+            .align = section->align,
+            .fast_rel_size = section->fast_rel ? section->fast_rel->size : 0,
+            .fast_rel_align = section->fast_rel ? section->fast_rel->align : 0,
+            .name_size = strlen(itref->key) + 1,
+        };
+
+        if(storage_file_write(cache, &record, sizeof(record)) != sizeof(record) ||
+           !elf_file_cache_write_name(cache, itref->key)) {
+            return false;
+        }
+        (*count)++;
+    }
+
+    return true;
+}
+
+static bool elf_file_cache_write_section_data(ELFFile* elf, File* cache) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSection* section = &ELFSectionDict_cref(it)->value;
+        if(section->type != SHT_NOBITS && section->size &&
+           storage_file_write(cache, section->data, section->size) != section->size) {
+            return false;
+        }
+
+        const ELFSection* fast_rel = section->fast_rel;
+        if(fast_rel && fast_rel->size &&
+           storage_file_write(cache, fast_rel->data, fast_rel->size) != fast_rel->size) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool elf_file_cache_get_meta_crc(File* cache, uint32_t size, uint32_t* crc) {
+    uint8_t* meta = malloc(size);
+    bool result = storage_file_seek(cache, sizeof(ELFCacheHeader), true) &&
+                  storage_file_read(cache, meta, size) == size;
+    if(result) {
+        *crc = crc32_calc_buffer(0, meta, size);
+    }
+    free(meta);
+    return result;
+}
+
+/* Remove the oldest images until the cache fits into ELF_CACHE_DIR_SIZE_MAX */
+static void elf_file_cache_evict(ELFFile* elf) {
+    const char* cache_path = furi_string_get_cstr(elf->cache_path);
+    FuriString* cache_dir = furi_string_alloc();
+    FuriString* file_path = furi_string_alloc();
+    FuriString* oldest_path = furi_string_alloc();
+    File* dir = storage_file_alloc(elf->storage);
+    FileInfo file_info;
+    char name[ELF_NAME_BUFFER_LEN];
+
+    path_extract_dirname(cache_path, cache_dir);
+
+    while(storage_dir_open(dir, furi_string_get_cstr(cache_dir))) {
+        uint64_t total_size = 0;
+        uint32_t oldest_timestamp = UINT32_MAX;
+        furi_string_reset(oldest_path);
+
+        while(storage_dir_read(dir, &file_info, name, sizeof(name))) {
+            if(file_info_is_dir(&file_info)) continue;
+            total_size += file_info.size;
+
+            // Image that was just written is never evicted
+            path_concat(furi_string_get_cstr(cache_dir), name, file_path);
+            if(furi_string_equal_str(file_path, cache_path)) continue;
+
+            uint32_t timestamp;
+            if(storage_common_timestamp(
+                   elf->storage, furi_string_get_cstr(file_path), &timestamp) == FSE_OK &&
+               timestamp <= oldest_timestamp) {
+                oldest_timestamp = timestamp;
+                furi_string_set(oldest_path, file_path);
+            }
+        }
+        storage_dir_close(dir);
+
+        if(total_size <= ELF_CACHE_DIR_SIZE_MAX || furi_string_empty(oldest_path)) break;
+        FURI_LOG_I(TAG, "Evicting image cache %s", furi_string_get_cstr(oldest_path));
+        if(storage_common_remove(elf->storage, furi_string_get_cstr(oldest_path)) != FSE_OK) {
+            break;
+        }
+    }
+
+    storage_file_free(dir);
+    furi_string_free(oldest_path);
+    furi_string_free(file_path);
+    furi_string_free(cache_dir);
+}
+
+/* Must be called before relocation, while section data is still unmodified */
+static bool elf_file_cache_store(ELFFile* elf) {
+    if(!elf_file_cache_is_supported(elf)) {
+        FURI_LOG_I(TAG, "Image cache is not supported for this file");
+        return false;
+    }
+
+    bool result = false;
+    const char* cache_path = furi_string_get_cstr(elf->cache_path);
+    FuriString* temp_path = furi_string_alloc_printf("%s" ELF_CACHE_TEMP_EXTENSION, cache_path);
+    File* cache = storage_file_alloc(elf->storage);
+    ELFCacheHeader header = {
+        .magic = ELF_CACHE_MAGIC,
+        .version = ELF_CACHE_VERSION,
+        .api_version_major = elf->api_interface->api_version_major,
+        .api_version_minor = elf->api_interface->api_version_minor,
+        .file_size = storage_file_size(elf->fd),
+        .symbol_table = elf->symbol_table,
+        .symbol_count = elf->symbol_count,
+        .symbol_table_strings = elf->symbol_table_strings,
+        .debug_link_size = elf->debug_link_info.debug_link_size,
+    };
+
+    do {
+        if(!elf_file_get_headers_crc(elf, &header.headers_crc)) break;
+        if(!storage_file_open(
+               cache, furi_string_get_cstr(temp_path), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+            break;
+        }
+
+        // Header is written again when meta size and counts are known
+        if(storage_file_write(cache, &header, sizeof(header)) != sizeof(header)) break;
+        if(storage_file_write(cache, elf->debug_link_info.debug_link, header.debug_link_size) !=
+           header.debug_link_size) {
+            break;
+        }
+        if(!elf_file_cache_write_directory(elf, cache, &header.directory_count)) break;
+        if(!elf_file_cache_write_section_records(elf, cache, &header.section_count)) break;
+
+        header.meta_size = storage_file_tell(cache) - sizeof(header);
+        if(header.meta_size > ELF_CACHE_META_SIZE_MAX) break;
+        if(!elf_file_cache_write_section_data(elf, cache)) break;
+        if(!elf_file_cache_get_meta_crc(cache, header.meta_size, &header.meta_crc)) break;
+
+        if(!storage_file_seek(cache, 0, true) ||
+           storage_file_write(cache, &header, sizeof(header)) != sizeof(header) ||
+           !storage_file_sync(cache)) {
+            break;
+        }
+        storage_file_close(cache);
+
+        // Complete image replaces the old one at once, an interrupted write leaves no image
+        result = storage_common_rename(
+                     elf->storage, furi_string_get_cstr(temp_path), cache_path) == FSE_OK;
+    } while(false);
+
+    storage_file_free(cache);
+
+    if(result) {
+        elf_file_cache_evict(elf);
+    } else {
+        FURI_LOG_W(TAG, "Image cache write failed");
+        storage_common_remove(elf->storage, furi_string_get_cstr(temp_path));
+        storage_common_remove(elf->storage, cache_path);
+    }
+
+    furi_string_free(temp_path);
+
+    return result;
+}
+
 /**************************************************************************************************/
 /********************************************* Public *********************************************/
 /**************************************************************************************************/
 
 ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface) {
     ELFFile* elf = malloc(sizeof(ELFFile));
+    elf->storage = storage;
     elf->fd = storage_file_alloc(storage);
     elf->api_interface = api_interface;
     ELFSectionDict_init(elf->sections);
     AddressCache_init(elf->trampoline_cache);
+    elf->symbol_buffer.capacity = ELF_SYMBOL_BUFFER_SIZE;
+    elf->string_buffer.capacity = ELF_STRING_BUFFER_SIZE;
     elf->init_array_called = false;
     return elf;
 }
@@ -774,23 +1475,8 @@ void elf_file_free(ELFFile* elf) {
     }
 
     // free sections data
-    {
-        ELFSectionDict_it_t it;
-        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
-            ELFSectionDict_next(it)) {
-            const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
-            if(itref->value.data) {
-                aligned_free(itref->value.data);
-            }
-            if(itref->value.fast_rel) {
-                aligned_free(itref->value.fast_rel->data);
-                free(itref->value.fast_rel);
-            }
-            free((void*)itref->key);
-        }
-
-        ELFSectionDict_clear(elf->sections);
-    }
+    elf_file_free_sections(elf);
+    ELFSectionDict_clear(elf->sections);
 
     // free trampoline data
     {
@@ -808,6 +1494,17 @@ void elf_file_free(ELFFile* elf) {
         free(elf->debug_link_info.debug_link);
     }
 
+    if(elf->relocation_cache) {
+        free(elf->relocation_cache);
+    }
+    elf_buffer_free(&elf->symbol_buffer);
+    elf_buffer_free(&elf->string_buffer);
+
+    elf_file_cache_release(elf);
+    if(elf->cache_path) {
+        furi_string_free(elf->cache_path);
+    }
+
     elf_file_maybe_release_fd(elf);
     free(elf);
 }
@@ -831,7 +1528,32 @@ bool elf_file_open(ELFFile* elf, const char* path) {
     return true;
 }
 
+void elf_file_set_cache_path(ELFFile* elf, const char* cache_path) {
+    if(elf->cache_path) {
+        furi_string_set(elf->cache_path, cache_path);
+    } else {
+        elf->cache_path = furi_string_alloc_set(cache_path);
+    }
+}
+
 bool elf_file_load_section_table(ELFFile* elf) {
+    if(elf->cache_path) {
+        elf->cache_restored = elf_file_cache_load(elf);
+        if(elf->cache_restored) {
+            FURI_LOG_I(TAG, "Restored from image cache");
+            return true;
+        }
+
+        // Drop partially restored state before loading from the ELF file
+        elf_file_free_sections(elf);
+        elf_file_cache_release(elf);
+        if(elf->debug_link_info.debug_link) {
+            free(elf->debug_link_info.debug_link);
+            elf->debug_link_info.debug_link = NULL;
+            elf->debug_link_info.debug_link_size = 0;
+        }
+    }
+
     SectionType loaded_sections = SectionTypeERROR;
     FuriString* name = furi_string_alloc();
 
@@ -871,17 +1593,26 @@ ElfProcessSectionResult elf_process_section(
     FuriString* section_name = furi_string_alloc();
     Elf32_Shdr section_header;
 
-    // find section
-    // TODO FL-3526: why we start from 1?
-    for(size_t section_idx = 1; section_idx < elf->sections_count; section_idx++) {
-        furi_string_reset(section_name);
-        if(!elf_read_section(elf, section_idx, &section_header, section_name)) {
-            break;
+    if(elf->cache_restored) {
+        const ELFCacheEntry* entry = elf_file_cache_find(elf, name);
+        if(entry) {
+            section_header.sh_offset = entry->offset;
+            section_header.sh_size = entry->size;
+            result = ElfProcessSectionResultCannotProcess;
         }
+    } else {
+        // find section
+        // TODO FL-3526: why we start from 1?
+        for(size_t section_idx = 1; section_idx < elf->sections_count; section_idx++) {
+            furi_string_reset(section_name);
+            if(!elf_read_section(elf, section_idx, &section_header, section_name)) {
+                break;
+            }
 
-        if(furi_string_cmp(section_name, name) == 0) {
-            result = ElfProcessSectionResultCannotProcess;
-            break;
+            if(furi_string_cmp(section_name, name) == 0) {
+                result = ElfProcessSectionResultCannotProcess;
+                break;
+            }
         }
     }
 
@@ -903,7 +1634,10 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     ELFFileLoadStatus status = ELFFileLoadStatusSuccess;
     ELFSectionDict_it_t it;
 
-    AddressCache_init(elf->relocation_cache);
+    bool cache_stored = false;
+    if(elf->cache_path && !elf->cache_restored) {
+        cache_stored = elf_file_cache_store(elf);
+    }
 
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
@@ -926,9 +1660,18 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
         }
     }
 
-    FURI_LOG_D(TAG, "Relocation cache size: %u", AddressCache_size(elf->relocation_cache));
+    FURI_LOG_D(TAG, "Resolved symbols: %lu", elf->load_stats.symbol_count);
     FURI_LOG_D(TAG, "Trampoline cache size: %u", AddressCache_size(elf->trampoline_cache));
-    AddressCache_clear(elf->relocation_cache);
+    free(elf->relocation_cache);
+    elf->relocation_cache = NULL;
+    elf_buffer_free(&elf->symbol_buffer);
+    elf_buffer_free(&elf->string_buffer);
+    elf_file_cache_release(elf);
+
+    // Do not keep an image that can not be loaded
+    if(status != ELFFileLoadStatusSuccess && (cache_stored || elf->cache_restored)) {
+        storage_common_remove(elf->storage, furi_string_get_cstr(elf->cache_path));
+    }
 
     {
         size_t total_size = 0;
@@ -970,6 +1713,14 @@ const ElfApiInterface* elf_file_get_api_interface(ELFFile* elf_file) {
     return elf_file->api_interface;
 }
 
+const ELFLoadStats* elf_file_get_load_stats(ELFFile* elf_file) {
+    const uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    elf_file->load_stats.read_us = elf_file->load_cycles.read / cycles_per_us;
+    elf_file->load_stats.resolve_us = elf_file->load_cycles.resolve / cycles_per_us;
+    elf_file->load_stats.relocate_us = elf_file->load_cycles.relocate / cycles_per_us;
+    return &elf_file->load_stats;
+}
+
 void elf_file_init_debug_info(ELFFile* elf, ELFDebugInfo* debug_info) {
     // set entry
     debug_info->entry = elf->entry;
@@ -37,6 +37,17 @@ typedef enum {
     ELFFileLoadStatusMissingImports,
 } ELFFileLoadStatus;
 
+/**
+ * Time spent in loading phases, in microseconds
+ */
+typedef struct {
+    uint32_t read_us; /**< reading section data, relocation and symbol tables */
+    uint32_t resolve_us; /**< resolving symbol addresses */
+    uint32_t relocate_us; /**< patching code and data */
+    uint32_t relocation_count;
+    uint32_t symbol_count; /**< symbols resolved, each symbol is resolved once */
+} ELFLoadStats;
+
 typedef enum {
     ElfProcessSectionResultNotFound,
     ElfProcessSectionResultCannotProcess,
@@ -67,6 +78,17 @@ void elf_file_free(ELFFile* elf_file);
  */
 bool elf_file_open(ELFFile* elf_file, const char* path);
 
+/**
+ * @brief Enable image cache for the ELF file
+ * 
+ * Section table is restored from the cache if it matches the file and API version,
+ * otherwise the cache is written by elf_file_load_sections before relocation.
+ * Must be called before elf_file_load_section_table.
+ * @param elf_file 
+ * @param cache_path 
+ */
+void elf_file_set_cache_path(ELFFile* elf_file, const char* cache_path);
+
 /**
  * @brief Load ELF file section table (load stage #1)
  * @param elf_file 
@@ -118,6 +140,13 @@ void elf_file_call_fini(ELFFile* elf);
  */
 const ElfApiInterface* elf_file_get_api_interface(ELFFile* elf_file);
 
+/**
+ * @brief Get time spent in loading phases, from section table load to relocation
+ * @param elf_file 
+ * @return const ELFLoadStats* 
+ */
+const ELFLoadStats* elf_file_get_load_stats(ELFFile* elf_file);
+
 /**
  * @brief Get ELF file debug info
  * @param elf_file 
@@ -18,6 +18,8 @@ typedef struct ELFSection ELFSection;
 struct ELFSection {
     void* data;
     Elf32_Word size;
+    Elf32_Word type;
+    Elf32_Word align;
 
     size_t rel_count;
     Elf32_Off rel_offset;
@@ -28,6 +30,34 @@ struct ELFSection {
 
 DICT_DEF2(ELFSectionDict, const char*, M_CSTR_OPLIST, ELFSection, M_POD_OPLIST)
 
+/**
+ * Window of file data, serves small reads without seeking
+ */
+typedef struct {
+    uint8_t* data;
+    size_t capacity;
+    off_t offset; /**< file offset of the buffered data */
+    size_t size; /**< buffered data size */
+} ELFFileBuffer;
+
+/**
+ * CPU cycles spent in loading phases, converted to ELFLoadStats on request
+ */
+typedef struct {
+    uint32_t read;
+    uint32_t resolve;
+    uint32_t relocate;
+} ELFLoadCycles;
+
+/**
+ * Location of a section in the ELF file, restored from the image cache
+ */
+typedef struct {
+    const char* name;
+    off_t offset;
+    size_t size;
+} ELFCacheEntry;
+
 struct ELFFile {
     size_t sections_count;
     off_t section_table;
@@ -39,9 +69,15 @@ struct ELFFile {
     off_t entry;
     ELFSectionDict_t sections;
 
-    AddressCache_t relocation_cache;
+    Elf32_Addr* relocation_cache; /**< symbol addresses by symbol index, while loading */
     AddressCache_t trampoline_cache;
 
+    ELFFileBuffer symbol_buffer;
+    ELFFileBuffer string_buffer;
+    ELFLoadCycles load_cycles;
+    ELFLoadStats load_stats;
+
+    Storage* storage;
     File* fd;
     const ElfApiInterface* api_interface;
     ELFDebugLinkInfo debug_link_info;
@@ -51,6 +87,12 @@ struct ELFFile {
     ELFSection* fini_array;
 
     bool init_array_called;
+
+    FuriString* cache_path; /**< image cache file, NULL if cache is disabled */
+    bool cache_restored;
+    uint8_t* cache_meta;
+    ELFCacheEntry* cache_directory;
+    size_t cache_directory_count;
 };
 
 #ifdef __cplusplus
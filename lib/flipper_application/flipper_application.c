@@ -4,6 +4,7 @@
 #include "application_assets.h"
 #include <loader/firmware_api/firmware_api.h>
 #include <storage/storage_processing.h>
+#include <toolbox/crc32_calc.h>
 
 #include <m-list.h>
 
@@ -15,6 +16,7 @@ struct FlipperApplication {
     ELFFile* elf;
     FuriThread* thread;
     void* ep_thread_args;
+    bool cache_enabled;
 };
 
 /********************** Debugger access to loader state **********************/
@@ -57,9 +59,27 @@ FlipperApplication*
     app->elf = elf_file_alloc(storage, api_interface);
     app->thread = NULL;
     app->ep_thread_args = NULL;
+    app->cache_enabled = false;
     return app;
 }
 
+void flipper_application_set_cache_enabled(FlipperApplication* app, bool enabled) {
+    furi_assert(app);
+    app->cache_enabled = enabled;
+}
+
+bool flipper_application_is_cache_allowed(Storage* storage) {
+    return storage_dir_exists(storage, FLIPPER_APPLICATION_CACHE_PATH);
+}
+
+bool flipper_application_set_cache_allowed(Storage* storage, bool allowed) {
+    if(allowed) {
+        return storage_simply_mkdir(storage, FLIPPER_APPLICATION_CACHE_PATH);
+    } else {
+        return storage_simply_remove_recursive(storage, FLIPPER_APPLICATION_CACHE_PATH);
+    }
+}
+
 bool flipper_application_is_plugin(FlipperApplication* app) {
     return app->manifest.stack_size == 0;
 }
@@ -156,6 +176,15 @@ static FlipperApplicationPreloadStatus
 
     // if we are loading full file
     if(load_full) {
+        // cache file is named after the application path
+        if(app->cache_enabled) {
+            FuriString* cache_path = furi_string_alloc_printf(
+                FLIPPER_APPLICATION_CACHE_PATH "/%08lX.fapc",
+                crc32_calc_buffer(0, path, strlen(path)));
+            elf_file_set_cache_path(app->elf, furi_string_get_cstr(cache_path));
+            furi_string_free(cache_path);
+        }
+
         // load section table
         if(!elf_file_load_section_table(app->elf)) {
             return FlipperApplicationPreloadStatusInvalidFile;
@@ -201,6 +230,17 @@ const FlipperApplicationManifest* flipper_application_get_manifest(FlipperApplic
 FlipperApplicationLoadStatus flipper_application_map_to_memory(FlipperApplication* app) {
     ELFFileLoadStatus status = elf_file_load_sections(app->elf);
 
+    const ELFLoadStats* stats = elf_file_get_load_stats(app->elf);
+    FURI_LOG_I(
+        TAG,
+        "%s: read %lu us, resolve %lu us (%lu symbols), relocate %lu us (%lu relocations)",
+        app->manifest.name,
+        stats->read_us,
+        stats->resolve_us,
+        stats->symbol_count,
+        stats->relocate_us,
+        stats->relocation_count);
+
     switch(status) {
     case ELFFileLoadStatusSuccess:
         elf_file_init_debug_info(app->elf, &app->state);
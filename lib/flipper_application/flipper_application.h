@@ -12,6 +12,8 @@
 
 #include <stdbool.h>
 
+#define FLIPPER_APPLICATION_CACHE_PATH EXT_PATH(".fapcache")
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -76,6 +78,35 @@ FlipperApplication*
  */
 void flipper_application_free(FlipperApplication* app);
 
+/**
+ * @brief Enable image cache for the application
+ * 
+ * Cached image is validated against the file and firmware API version and lets
+ * the next launch skip section table parsing. Must be called before preload.
+ * @param app Application pointer
+ * @param enabled true to use image cache
+ */
+void flipper_application_set_cache_enabled(FlipperApplication* app, bool enabled);
+
+/**
+ * @brief Check if user allowed image cache
+ * 
+ * Image cache is opt-in, it is allowed while FLIPPER_APPLICATION_CACHE_PATH exists.
+ * @param storage Storage instance
+ * @return true if applications may be loaded with image cache
+ */
+bool flipper_application_is_cache_allowed(Storage* storage);
+
+/**
+ * @brief Allow or forbid image cache
+ * 
+ * Forbidding the cache removes all cached images.
+ * @param storage Storage instance
+ * @param allowed true to allow image cache
+ * @return true on success
+ */
+bool flipper_application_set_cache_allowed(Storage* storage, bool allowed);
+
 /**
  * @brief Validate elf file and load application metadata 
  * @param app Application pointer
@@ -120,6 +120,15 @@ FlipperFormat* flipper_format_file_alloc(Storage* storage);
  */
 FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage);
 
+/**
+ * Allocate FlipperFormat as file, buffered mode with custom read window size.
+ * Use bigger windows for large files that are read line by line.
+ * @param storage Pointer to a Storage instance
+ * @param window_size Read window size in bytes
+ * @return FlipperFormat* pointer to a FlipperFormat instance
+ */
+FlipperFormat* flipper_format_buffered_file_alloc_ex(Storage* storage, size_t window_size);
+
 /**
  * Open existing file. 
  * Use only if FlipperFormat allocated as a file.
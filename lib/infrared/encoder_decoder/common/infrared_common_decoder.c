@@ -217,6 +217,14 @@ InfraredMessage* infrared_common_decoder_check_ready(InfraredCommonDecoder* deco
     return message;
 }
 
+/* decoder matched its preamble and consumes data bits of a frame */
+bool infrared_common_decoder_is_framing(const InfraredCommonDecoder* decoder) {
+    furi_assert(decoder);
+
+    return (decoder->state == InfraredCommonDecoderStateDecode) &&
+           (decoder->protocol->timings.preamble_mark != 0);
+}
+
 InfraredMessage*
     infrared_common_decode(InfraredCommonDecoder* decoder, bool level, uint32_t duration) {
     furi_assert(decoder);
@@ -19,6 +19,8 @@ typedef struct {
     InfraredDecoderReset reset;
     InfraredFree free;
     InfraredDecoderCheckReady check_ready;
+    /* NULL for decoders without preamble, they can't be routed and get every timing */
+    InfraredDecoderIsFraming is_framing;
 } InfraredDecoders;
 
 typedef struct {
@@ -30,6 +32,10 @@ typedef struct {
 
 struct InfraredDecoderHandler {
     void** ctx;
+    /* decoders locked on their preamble, the only routable ones fed until the frame ends */
+    uint32_t routed;
+    /* decoders which missed timings while others were routed, reset before next feed */
+    uint32_t skipped;
 };
 
 struct InfraredEncoderHandler {
@@ -50,6 +56,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_nec_decode,
              .reset = infrared_decoder_nec_reset,
              .check_ready = infrared_decoder_nec_check_ready,
+             .is_framing = infrared_decoder_nec_is_framing,
              .free = infrared_decoder_nec_free},
         .encoder =
             {.alloc = infrared_encoder_nec_alloc,
@@ -64,6 +71,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_samsung32_decode,
              .reset = infrared_decoder_samsung32_reset,
              .check_ready = infrared_decoder_samsung32_check_ready,
+             .is_framing = infrared_decoder_samsung32_is_framing,
              .free = infrared_decoder_samsung32_free},
         .encoder =
             {.alloc = infrared_encoder_samsung32_alloc,
@@ -92,6 +100,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc6_decode,
              .reset = infrared_decoder_rc6_reset,
              .check_ready = infrared_decoder_rc6_check_ready,
+             .is_framing = infrared_decoder_rc6_is_framing,
              .free = infrared_decoder_rc6_free},
         .encoder =
             {.alloc = infrared_encoder_rc6_alloc,
@@ -106,6 +115,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_sirc_decode,
              .reset = infrared_decoder_sirc_reset,
              .check_ready = infrared_decoder_sirc_check_ready,
+             .is_framing = infrared_decoder_sirc_is_framing,
              .free = infrared_decoder_sirc_free},
         .encoder =
             {.alloc = infrared_encoder_sirc_alloc,
@@ -120,6 +130,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_kaseikyo_decode,
              .reset = infrared_decoder_kaseikyo_reset,
              .check_ready = infrared_decoder_kaseikyo_check_ready,
+             .is_framing = infrared_decoder_kaseikyo_is_framing,
              .free = infrared_decoder_kaseikyo_free},
         .encoder =
             {.alloc = infrared_encoder_kaseikyo_alloc,
@@ -134,6 +145,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rca_decode,
              .reset = infrared_decoder_rca_reset,
              .check_ready = infrared_decoder_rca_check_ready,
+             .is_framing = infrared_decoder_rca_is_framing,
              .free = infrared_decoder_rca_free},
         .encoder =
             {.alloc = infrared_encoder_rca_alloc,
@@ -144,6 +156,10 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
     },
 };
 
+_Static_assert(
+    COUNT_OF(infrared_encoder_decoder) <= 32,
+    "Decoder routing masks don't fit all decoders");
+
 static int infrared_find_index_by_protocol(InfraredProtocol protocol);
 static const InfraredProtocolVariant* infrared_get_variant_by_protocol(InfraredProtocol protocol);
 
@@ -153,16 +169,38 @@ const InfraredMessage*
 
     InfraredMessage* message = NULL;
     InfraredMessage* result = NULL;
+    uint32_t routed = 0;
 
+    /* While preamble isn't matched, timings are broadcast to every decoder. Once some
+     * decoders lock on their preamble, the rest of the frame goes to them only. */
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.decode) {
-            message = infrared_encoder_decoder[i].decoder.decode(handler->ctx[i], level, duration);
-            if(!result && message) {
-                result = message;
-            }
+        const InfraredDecoders* decoder = &infrared_encoder_decoder[i].decoder;
+        const uint32_t decoder_bit = 1UL << i;
+
+        if(!decoder->decode) continue;
+
+        if(decoder->is_framing && handler->routed && !(handler->routed & decoder_bit)) {
+            handler->skipped |= decoder_bit;
+            continue;
+        }
+
+        if(handler->skipped & decoder_bit) {
+            handler->skipped &= ~decoder_bit;
+            decoder->reset(handler->ctx[i]);
+        }
+
+        message = decoder->decode(handler->ctx[i], level, duration);
+        if(!result && message) {
+            result = message;
+        }
+
+        if(decoder->is_framing && decoder->is_framing(handler->ctx[i])) {
+            routed |= decoder_bit;
         }
     }
 
+    handler->routed = routed;
+
     return result;
 }
 
@@ -194,6 +232,9 @@ void infrared_free_decoder(InfraredDecoderHandler* handler) {
 }
 
 void infrared_reset_decoder(InfraredDecoderHandler* handler) {
+    handler->routed = 0;
+    handler->skipped = 0;
+
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         if(infrared_encoder_decoder[i].decoder.reset)
             infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
@@ -206,6 +247,16 @@ const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* hand
     InfraredMessage* message = NULL;
     InfraredMessage* result = NULL;
 
+    /* Signal is over, next one must be offered to every decoder again.
+     * Decoders that missed part of it hold stale state, drop it first. */
+    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+        if(handler->skipped & (1UL << i)) {
+            infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
+        }
+    }
+    handler->routed = 0;
+    handler->skipped = 0;
+
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         if(infrared_encoder_decoder[i].decoder.check_ready) {
             message = infrared_encoder_decoder[i].decoder.check_ready(handler->ctx[i]);
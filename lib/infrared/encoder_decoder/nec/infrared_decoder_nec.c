@@ -92,6 +92,10 @@ void infrared_decoder_nec_free(void* decoder) {
     infrared_common_decoder_free(decoder);
 }
 
+bool infrared_decoder_nec_is_framing(void* decoder) {
+    return infrared_common_decoder_is_framing(decoder);
+}
+
 void infrared_decoder_nec_reset(void* decoder) {
     infrared_common_decoder_reset(decoder);
 }
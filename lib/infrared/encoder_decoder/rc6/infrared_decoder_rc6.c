@@ -106,6 +106,11 @@ void infrared_decoder_rc6_free(void* decoder) {
     free(decoder_rc6);
 }
 
+bool infrared_decoder_rc6_is_framing(void* decoder) {
+    InfraredRc6Decoder* decoder_rc6 = decoder;
+    return infrared_common_decoder_is_framing(decoder_rc6->common_decoder);
+}
+
 void infrared_decoder_rc6_reset(void* decoder) {
     InfraredRc6Decoder* decoder_rc6 = decoder;
     infrared_common_decoder_reset(decoder_rc6->common_decoder);
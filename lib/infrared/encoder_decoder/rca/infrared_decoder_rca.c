@@ -40,6 +40,10 @@ void infrared_decoder_rca_free(void* decoder) {
     infrared_common_decoder_free(decoder);
 }
 
+bool infrared_decoder_rca_is_framing(void* decoder) {
+    return infrared_common_decoder_is_framing(decoder);
+}
+
 void infrared_decoder_rca_reset(void* decoder) {
     infrared_common_decoder_reset(decoder);
 }
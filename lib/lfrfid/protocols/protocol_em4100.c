@@ -28,6 +28,12 @@ typedef uint64_t EM4100DecodedData;
 #define EM_READ_LONG_TIME_BASE (512)
 #define EM_READ_JITTER_TIME_BASE (100)
 
+// Pulses outside of both Manchester windows never reach the decoder state machine
+#define EM_READ_TIMING_MIN(divisor) \
+    (EM_READ_SHORT_TIME_BASE / (divisor) - EM_READ_JITTER_TIME_BASE / (divisor) + 1)
+#define EM_READ_TIMING_MAX(divisor) \
+    (EM_READ_LONG_TIME_BASE / (divisor) + EM_READ_JITTER_TIME_BASE / (divisor) - 1)
+
 typedef struct {
     uint8_t data[EM4100_DECODED_DATA_SIZE];
 
@@ -339,6 +345,11 @@ const ProtocolBase protocol_em4100 = {
         {
             .start = (ProtocolDecoderStart)protocol_em4100_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_em4100_decoder_feed,
+            .timing =
+                {
+                    .min = EM_READ_TIMING_MIN(1),
+                    .max = EM_READ_TIMING_MAX(1),
+                },
         },
     .encoder =
         {
@@ -363,6 +374,11 @@ const ProtocolBase protocol_em4100_32 = {
         {
             .start = (ProtocolDecoderStart)protocol_em4100_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_em4100_decoder_feed,
+            .timing =
+                {
+                    .min = EM_READ_TIMING_MIN(2),
+                    .max = EM_READ_TIMING_MAX(2),
+                },
         },
     .encoder =
         {
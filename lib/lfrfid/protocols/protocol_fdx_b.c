@@ -371,6 +371,12 @@ const ProtocolBase protocol_fdx_b = {
         {
             .start = (ProtocolDecoderStart)protocol_fdx_b_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_fdx_b_decoder_feed,
+            .timing =
+                {
+                    .min = FDX_B_SHORT_TIME_LOW,
+                    .max = FDX_B_LONG_TIME_HIGH,
+                    .reject_after = 1,
+                },
         },
     .encoder =
         {
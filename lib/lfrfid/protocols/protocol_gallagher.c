@@ -292,6 +292,11 @@ const ProtocolBase protocol_gallagher = {
         {
             .start = (ProtocolDecoderStart)protocol_gallagher_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_gallagher_decoder_feed,
+            .timing =
+                {
+                    .min = GALLAGHER_READ_SHORT_TIME_LOW + 1,
+                    .max = GALLAGHER_READ_LONG_TIME_HIGH - 1,
+                },
         },
     .encoder =
         {
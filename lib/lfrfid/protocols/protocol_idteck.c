@@ -257,6 +257,11 @@ const ProtocolBase protocol_idteck = {
         {
             .start = (ProtocolDecoderStart)protocol_idteck_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_idteck_decoder_feed,
+            .timing =
+                {
+                    .min = IDTECK_US_PER_BIT / 4 + 1,
+                    .max = UINT32_MAX,
+                },
         },
     .encoder =
         {
@@ -344,6 +344,11 @@ const ProtocolBase protocol_indala26 = {
         {
             .start = (ProtocolDecoderStart)protocol_indala26_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_indala26_decoder_feed,
+            .timing =
+                {
+                    .min = INDALA26_US_PER_BIT / 4 + 1,
+                    .max = UINT32_MAX,
+                },
         },
     .encoder =
         {
@@ -199,6 +199,12 @@ const ProtocolBase protocol_jablotron = {
         {
             .start = (ProtocolDecoderStart)protocol_jablotron_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_jablotron_decoder_feed,
+            .timing =
+                {
+                    .min = JABLOTRON_SHORT_TIME_LOW,
+                    .max = JABLOTRON_LONG_TIME_HIGH,
+                    .reject_after = 1,
+                },
         },
     .encoder =
         {
@@ -255,6 +255,11 @@ const ProtocolBase protocol_keri = {
         {
             .start = (ProtocolDecoderStart)protocol_keri_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_keri_decoder_feed,
+            .timing =
+                {
+                    .min = KERI_US_PER_BIT / 4 + 1,
+                    .max = UINT32_MAX,
+                },
         },
     .encoder =
         {
@@ -311,6 +311,11 @@ const ProtocolBase protocol_nexwatch = {
         {
             .start = (ProtocolDecoderStart)protocol_nexwatch_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_nexwatch_decoder_feed,
+            .timing =
+                {
+                    .min = NEXWATCH_US_PER_BIT / 4 + 1,
+                    .max = UINT32_MAX,
+                },
         },
     .encoder =
         {
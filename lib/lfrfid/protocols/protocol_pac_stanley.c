@@ -219,6 +219,11 @@ const ProtocolBase protocol_pac_stanley = {
         {
             .start = (ProtocolDecoderStart)protocol_pac_stanley_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_pac_stanley_decoder_feed,
+            .timing =
+                {
+                    .min = 0,
+                    .max = PAC_STANLEY_MAX_TIME,
+                },
         },
     .encoder =
         {
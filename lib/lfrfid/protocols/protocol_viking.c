@@ -193,6 +193,11 @@ const ProtocolBase protocol_viking = {
         {
             .start = (ProtocolDecoderStart)protocol_viking_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_viking_decoder_feed,
+            .timing =
+                {
+                    .min = VIKING_READ_SHORT_TIME_LOW + 1,
+                    .max = VIKING_READ_LONG_TIME_HIGH - 1,
+                },
         },
     .encoder =
         {
@@ -2,6 +2,7 @@
 
 #include <lib/nfc/helpers/nfc_util.h>
 #include <furi.h>
+#include <string.h>
 
 // Algorithm from https://github.com/RfidResearchGroup/proxmark3.git
 
@@ -12,6 +13,38 @@
 
 #define BEBIT(x, n) FURI_BIT(x, (n) ^ 24)
 
+#define CRYPTO1_STATE_BITS (48U)
+
+// Filter function input bits 0-7 and 8-15 mapped to filter output table index
+static const uint8_t crypto1_filter_lut_low[256] = {
+    0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0,
+    16, 16, 16, 16, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24, 8, 24, 8,
+    8, 8, 24, 8, 8, 24, 24, 24, 24, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 8, 8,
+    24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16,
+    16, 16, 16, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24, 8, 24, 8, 8,
+    8, 24, 8, 8, 24, 24, 24, 24, 0, 0, 16, 16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 0, 0, 16,
+    16, 0, 16, 0, 0, 0, 16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24,
+    24, 24, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 0, 0, 16, 16, 0, 16, 0, 0, 0,
+    16, 0, 0, 16, 16, 16, 16, 8, 8, 24, 24, 8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24, 8, 8, 24, 24,
+    8, 24, 8, 8, 8, 24, 8, 8, 24, 24, 24, 24};
+
+static const uint8_t crypto1_filter_lut_high[256] = {
+    0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4,
+    2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6,
+    0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6,
+    0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4,
+    0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6,
+    0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4,
+    2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6,
+    2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6,
+    6};
+
+// LFSR taps as offsets back from the newest bit of bit-sliced history, see crypto1_batch_step()
+static const uint8_t crypto1_batch_taps[] = {
+    5, 7, 9, 13, 19, 21, 23, 29, 31, 33, 39, 43, // LF_POLY_ODD
+    6, 24, 34, 36, 38, 48, // LF_POLY_EVEN
+};
+
 Crypto1* crypto1_alloc() {
     Crypto1* instance = malloc(sizeof(Crypto1));
 
@@ -40,16 +73,45 @@ void crypto1_init(Crypto1* crypto1, uint64_t key) {
     }
 }
 
-static uint32_t crypto1_filter(uint32_t in) {
-    uint32_t out = 0;
-    out = 0xf22c0 >> (in & 0xf) & 16;
-    out |= 0x6c9c0 >> (in >> 4 & 0xf) & 8;
-    out |= 0x3c8b0 >> (in >> 8 & 0xf) & 4;
-    out |= 0x1e458 >> (in >> 12 & 0xf) & 2;
+static inline uint32_t crypto1_filter(uint32_t in) {
+    uint32_t out = crypto1_filter_lut_low[in & 0xff];
+    out |= crypto1_filter_lut_high[in >> 8 & 0xff];
     out |= 0x0d938 >> (in >> 16 & 0xf) & 1;
     return FURI_BIT(0xEC57E80A, out);
 }
 
+static inline uint32_t crypto1_parity(uint32_t x) {
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    return 0x6996 >> (x & 0xf) & 1;
+}
+
+// Shift one bit into x, y holds the other half of the state. Halves swap roles on every step
+static inline uint32_t crypto1_step(uint32_t* x, uint32_t* y, uint32_t in, uint32_t is_encrypted) {
+    uint32_t out = crypto1_filter(*y);
+    uint32_t feed = (out & is_encrypted) ^ in;
+    feed ^= crypto1_parity((LF_POLY_ODD & *y) ^ (LF_POLY_EVEN & *x));
+    *x = *x << 1 | feed;
+    return out;
+}
+
+// Process 8 bits, least significant first, state halves keep their roles after even steps
+static inline uint8_t crypto1_step_byte(Crypto1* crypto1, uint8_t in, uint32_t is_encrypted) {
+    uint32_t odd = crypto1->odd;
+    uint32_t even = crypto1->even;
+    uint8_t out = 0;
+
+    for(uint8_t i = 0; i < 8; i += 2) {
+        out |= crypto1_step(&even, &odd, FURI_BIT(in, i), is_encrypted) << i;
+        out |= crypto1_step(&odd, &even, FURI_BIT(in, i + 1), is_encrypted) << (i + 1);
+    }
+
+    crypto1->odd = odd;
+    crypto1->even = even;
+    return out;
+}
+
 uint8_t crypto1_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     furi_assert(crypto1);
     uint8_t out = crypto1_filter(crypto1->odd);
@@ -65,18 +127,15 @@ uint8_t crypto1_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
 
 uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     furi_assert(crypto1);
-    uint8_t out = 0;
-    for(uint8_t i = 0; i < 8; i++) {
-        out |= crypto1_bit(crypto1, FURI_BIT(in, i), is_encrypted) << i;
-    }
-    return out;
+    return crypto1_step_byte(crypto1, in, !!is_encrypted);
 }
 
 uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
     furi_assert(crypto1);
     uint32_t out = 0;
-    for(uint8_t i = 0; i < 32; i++) {
-        out |= (uint32_t)crypto1_bit(crypto1, BEBIT(in, i), is_encrypted) << (24 ^ i);
+    // Bytes go most significant first, bits within a byte least significant first
+    for(int8_t shift = 24; shift >= 0; shift -= 8) {
+        out |= (uint32_t)crypto1_step_byte(crypto1, in >> shift, !!is_encrypted) << shift;
     }
     return out;
 }
@@ -175,3 +234,122 @@ void crypto1_encrypt_reader_nonce(
         bit_buffer_set_byte_with_parity(out, i, byte, parity_bit);
     }
 }
+
+Crypto1Batch* crypto1_batch_alloc() {
+    Crypto1Batch* instance = malloc(sizeof(Crypto1Batch));
+
+    return instance;
+}
+
+void crypto1_batch_free(Crypto1Batch* instance) {
+    furi_assert(instance);
+
+    free(instance);
+}
+
+void crypto1_batch_init(Crypto1Batch* batch, const uint64_t* keys, size_t count) {
+    furi_assert(batch);
+    furi_assert(keys);
+    furi_assert(count <= CRYPTO1_BATCH_SIZE);
+
+    // Same bit order as crypto1_init(), odd and even halves interleaved
+    for(size_t i = 0; i < CRYPTO1_STATE_BITS; i++) {
+        uint32_t lanes = 0;
+        for(size_t lane = 0; lane < count; lane++) {
+            lanes |= (uint32_t)FURI_BIT(keys[lane], i ^ 7) << lane;
+        }
+        batch->history[CRYPTO1_STATE_BITS - 1 - i] = lanes;
+    }
+    batch->head = CRYPTO1_STATE_BITS;
+}
+
+// Filter function parts in boolean form, truth table 0xf22c
+static inline uint32_t
+    crypto1_batch_filter_a(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3) {
+    return ((x3 & x2) | x1) ^ ((x3 ^ x2) & (x1 | x0));
+}
+
+// Truth table 0xd938
+static inline uint32_t
+    crypto1_batch_filter_b(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3) {
+    return ((x3 | x2) ^ (x3 & x0)) ^ (x1 & ((x3 ^ x2) | x0));
+}
+
+// Truth table 0xEC57E80A
+static inline uint32_t crypto1_batch_filter_c(
+    uint32_t y0,
+    uint32_t y1,
+    uint32_t y2,
+    uint32_t y3,
+    uint32_t y4) {
+    return (y0 | ((y1 | y4) & (y3 ^ y4))) ^ ((y0 ^ (y1 & y3)) & ((y2 ^ y3) | (y1 & y4)));
+}
+
+static uint32_t crypto1_batch_step(Crypto1Batch* batch, uint32_t in, uint32_t is_encrypted) {
+    // New bits are appended, only the last 48 make the state
+    if(batch->head == CRYPTO1_BATCH_HISTORY_SIZE) {
+        memmove(
+            batch->history,
+            &batch->history[CRYPTO1_BATCH_HISTORY_SIZE - CRYPTO1_STATE_BITS],
+            CRYPTO1_STATE_BITS * sizeof(uint32_t));
+        batch->head = CRYPTO1_STATE_BITS;
+    }
+
+    // Bit n of the odd half is s[-1 - 2 * n], of the even half s[-2 - 2 * n]
+    const uint32_t* s = &batch->history[batch->head];
+    uint32_t out = crypto1_batch_filter_c(
+        crypto1_batch_filter_b(s[-33], s[-35], s[-37], s[-39]),
+        crypto1_batch_filter_a(s[-25], s[-27], s[-29], s[-31]),
+        crypto1_batch_filter_a(s[-17], s[-19], s[-21], s[-23]),
+        crypto1_batch_filter_b(s[-9], s[-11], s[-13], s[-15]),
+        crypto1_batch_filter_a(s[-1], s[-3], s[-5], s[-7]));
+
+    uint32_t feed = (out & is_encrypted) ^ in;
+    for(size_t i = 0; i < COUNT_OF(crypto1_batch_taps); i++) {
+        feed ^= s[-crypto1_batch_taps[i]];
+    }
+    batch->history[batch->head++] = feed;
+
+    return out;
+}
+
+void crypto1_batch_word(Crypto1Batch* batch, uint32_t in, int is_encrypted, uint32_t* out) {
+    furi_assert(batch);
+    furi_assert(out);
+
+    uint32_t is_encrypted_lanes = is_encrypted ? UINT32_MAX : 0;
+    for(uint8_t i = 0; i < 32; i++) {
+        uint32_t in_lanes = BEBIT(in, i) ? UINT32_MAX : 0;
+        out[24 ^ i] = crypto1_batch_step(batch, in_lanes, is_encrypted_lanes);
+    }
+}
+
+uint32_t crypto1_batch_check_reader_auth(
+    Crypto1Batch* batch,
+    const uint64_t* keys,
+    size_t count,
+    uint32_t cuid,
+    uint32_t nt,
+    uint32_t nr,
+    uint32_t ar) {
+    furi_assert(batch);
+    furi_assert(keys);
+    furi_assert(count <= CRYPTO1_BATCH_SIZE);
+
+    uint32_t keystream[32];
+
+    // Same sequence as the tag side of authentication
+    crypto1_batch_init(batch, keys, count);
+    crypto1_batch_word(batch, nt ^ cuid, 0, keystream);
+    crypto1_batch_word(batch, nr, 1, keystream);
+    crypto1_batch_word(batch, 0, 0, keystream);
+
+    uint32_t expected = ar ^ prng_successor(nt, 64);
+    uint32_t mismatch = 0;
+    for(uint8_t i = 0; i < 32; i++) {
+        mismatch |= keystream[i] ^ (FURI_BIT(expected, i) ? UINT32_MAX : 0);
+    }
+
+    uint32_t lanes = (count == CRYPTO1_BATCH_SIZE) ? UINT32_MAX : ((1UL << count) - 1);
+    return ~mismatch & lanes;
+}
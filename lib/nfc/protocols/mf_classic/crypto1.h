@@ -11,6 +11,19 @@ typedef struct {
     uint32_t even;
 } Crypto1;
 
+/** Number of keys processed in parallel by Crypto1Batch */
+#define CRYPTO1_BATCH_SIZE (32U)
+#define CRYPTO1_BATCH_HISTORY_SIZE (48U + 32U)
+
+/** Bit-sliced Crypto1 state of up to CRYPTO1_BATCH_SIZE keys
+ *
+ * Every history word holds one LFSR bit of all keys, bit n belongs to n-th key.
+ */
+typedef struct {
+    uint32_t history[CRYPTO1_BATCH_HISTORY_SIZE];
+    uint32_t head;
+} Crypto1Batch;
+
 Crypto1* crypto1_alloc();
 
 void crypto1_free(Crypto1* instance);
@@ -40,6 +53,48 @@ void crypto1_encrypt_reader_nonce(
 
 uint32_t prng_successor(uint32_t x, uint32_t n);
 
+Crypto1Batch* crypto1_batch_alloc();
+
+void crypto1_batch_free(Crypto1Batch* instance);
+
+/** Load keys into bit-sliced state
+ *
+ * @param batch     Crypto1Batch instance
+ * @param keys      keys, same format as in crypto1_init()
+ * @param count     number of keys, up to CRYPTO1_BATCH_SIZE
+ */
+void crypto1_batch_init(Crypto1Batch* batch, const uint64_t* keys, size_t count);
+
+/** Process 32 bits for all keys, same as crypto1_word() for every key
+ *
+ * @param batch         Crypto1Batch instance
+ * @param in            input bits, shared by all keys
+ * @param is_encrypted  input bits are encrypted
+ * @param out           array of 32 words, out[n] holds output bit n of every key
+ */
+void crypto1_batch_word(Crypto1Batch* batch, uint32_t in, int is_encrypted, uint32_t* out);
+
+/** Check which keys match an authentication captured from a reader
+ *
+ * @param batch     Crypto1Batch instance used as scratch state
+ * @param keys      candidate keys
+ * @param count     number of keys, up to CRYPTO1_BATCH_SIZE
+ * @param cuid      card uid
+ * @param nt        tag nonce
+ * @param nr        encrypted reader nonce
+ * @param ar        encrypted reader answer
+ *
+ * @return mask of keys that produce the reader answer, bit n for n-th key
+ */
+uint32_t crypto1_batch_check_reader_auth(
+    Crypto1Batch* batch,
+    const uint64_t* keys,
+    size_t count,
+    uint32_t cuid,
+    uint32_t nt,
+    uint32_t nr,
+    uint32_t ar);
+
 #ifdef __cplusplus
 }
 #endif
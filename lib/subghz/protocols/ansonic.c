@@ -48,6 +48,8 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
 
     .feed = subghz_protocol_decoder_ansonic_feed,
     .reset = subghz_protocol_decoder_ansonic_reset,
+    .is_idle = subghz_protocol_decoder_ansonic_is_idle,
+    .get_start_window = subghz_protocol_decoder_ansonic_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_ansonic_get_hash_data,
     .serialize = subghz_protocol_decoder_ansonic_serialize,
@@ -279,6 +281,21 @@ void subghz_protocol_decoder_ansonic_feed(void* context, bool level, uint32_t du
     }
 }
 
+bool subghz_protocol_decoder_ansonic_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAnsonic* instance = context;
+    return instance->decoder.parser_step == AnsonicDecoderStepReset;
+}
+
+void subghz_protocol_decoder_ansonic_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_ansonic_const.te_short * 35;
+    window->te_delta = subghz_protocol_ansonic_const.te_delta * 35;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -58,6 +58,8 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
 
     .feed = subghz_protocol_decoder_bett_feed,
     .reset = subghz_protocol_decoder_bett_reset,
+    .is_idle = subghz_protocol_decoder_bett_is_idle,
+    .get_start_window = subghz_protocol_decoder_bett_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_bett_get_hash_data,
     .serialize = subghz_protocol_decoder_bett_serialize,
@@ -289,6 +291,21 @@ void subghz_protocol_decoder_bett_feed(void* context, bool level, uint32_t durat
     }
 }
 
+bool subghz_protocol_decoder_bett_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBETT* instance = context;
+    return instance->decoder.parser_step == BETTDecoderStepReset;
+}
+
+void subghz_protocol_decoder_bett_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_bett_const.te_short * 44;
+    window->te_delta = subghz_protocol_bett_const.te_delta * 15;
+}
+
 uint32_t subghz_protocol_decoder_bett_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderBETT* instance = context;
@@ -54,6 +54,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
 
     .feed = subghz_protocol_decoder_came_feed,
     .reset = subghz_protocol_decoder_came_reset,
+    .is_idle = subghz_protocol_decoder_came_is_idle,
+    .get_start_window = subghz_protocol_decoder_came_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_came_get_hash_data,
     .serialize = subghz_protocol_decoder_came_serialize,
@@ -310,6 +312,21 @@ void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t durat
     }
 }
 
+bool subghz_protocol_decoder_came_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+    return instance->decoder.parser_step == CameDecoderStepReset;
+}
+
+void subghz_protocol_decoder_came_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_came_const.te_short * 56;
+    window->te_delta = subghz_protocol_came_const.te_delta * 47;
+}
+
 uint32_t subghz_protocol_decoder_came_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
@@ -45,6 +45,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
 
     .feed = subghz_protocol_decoder_came_atomo_feed,
     .reset = subghz_protocol_decoder_came_atomo_reset,
+    .is_idle = subghz_protocol_decoder_came_atomo_is_idle,
+    .get_start_window = subghz_protocol_decoder_came_atomo_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_came_atomo_get_hash_data,
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
@@ -463,6 +465,21 @@ void subghz_protocol_decoder_came_atomo_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_came_atomo_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameAtomo* instance = context;
+    return instance->decoder.parser_step == CameAtomoDecoderStepReset;
+}
+
+void subghz_protocol_decoder_came_atomo_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_came_atomo_const.te_long * 60;
+    window->te_delta = subghz_protocol_came_atomo_const.te_delta * 40;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -76,6 +76,22 @@ void subghz_protocol_decoder_came_atomo_reset(void* context);
  */
 void subghz_protocol_decoder_came_atomo_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderCameAtomo is waiting for a new frame.
+ * @param context Pointer to a SubGhzProtocolDecoderCameAtomo instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_came_atomo_is_idle(void* context);
+
+/**
+ * Get the pulse that can start a new frame on idle SubGhzProtocolDecoderCameAtomo.
+ * @param context Pointer to a SubGhzProtocolDecoderCameAtomo instance
+ * @param window Pointer to a SubGhzDecoderStartWindow instance
+ */
+void subghz_protocol_decoder_came_atomo_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderCameAtomo instance
@@ -76,6 +76,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
 
     .feed = subghz_protocol_decoder_came_twee_feed,
     .reset = subghz_protocol_decoder_came_twee_reset,
+    .is_idle = subghz_protocol_decoder_came_twee_is_idle,
+    .get_start_window = subghz_protocol_decoder_came_twee_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_came_twee_get_hash_data,
     .serialize = subghz_protocol_decoder_came_twee_serialize,
@@ -409,6 +411,21 @@ void subghz_protocol_decoder_came_twee_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_came_twee_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameTwee* instance = context;
+    return instance->decoder.parser_step == CameTweeDecoderStepReset;
+}
+
+void subghz_protocol_decoder_came_twee_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_came_twee_const.te_long * 51;
+    window->te_delta = subghz_protocol_came_twee_const.te_delta * 20;
+}
+
 uint32_t subghz_protocol_decoder_came_twee_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCameTwee* instance = context;
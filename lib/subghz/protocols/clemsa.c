@@ -57,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
 
     .feed = subghz_protocol_decoder_clemsa_feed,
     .reset = subghz_protocol_decoder_clemsa_reset,
+    .is_idle = subghz_protocol_decoder_clemsa_is_idle,
+    .get_start_window = subghz_protocol_decoder_clemsa_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_clemsa_get_hash_data,
     .serialize = subghz_protocol_decoder_clemsa_serialize,
@@ -301,6 +303,21 @@ void subghz_protocol_decoder_clemsa_feed(void* context, bool level, uint32_t dur
     }
 }
 
+bool subghz_protocol_decoder_clemsa_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderClemsa* instance = context;
+    return instance->decoder.parser_step == ClemsaDecoderStepReset;
+}
+
+void subghz_protocol_decoder_clemsa_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_clemsa_const.te_short * 51;
+    window->te_delta = subghz_protocol_clemsa_const.te_delta * 25;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
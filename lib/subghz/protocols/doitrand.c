@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
 
     .feed = subghz_protocol_decoder_doitrand_feed,
     .reset = subghz_protocol_decoder_doitrand_reset,
+    .is_idle = subghz_protocol_decoder_doitrand_is_idle,
+    .get_start_window = subghz_protocol_decoder_doitrand_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_doitrand_get_hash_data,
     .serialize = subghz_protocol_decoder_doitrand_serialize,
@@ -276,6 +278,21 @@ void subghz_protocol_decoder_doitrand_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_doitrand_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDoitrand* instance = context;
+    return instance->decoder.parser_step == DoitrandDecoderStepReset;
+}
+
+void subghz_protocol_decoder_doitrand_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_doitrand_const.te_short * 62;
+    window->te_delta = subghz_protocol_doitrand_const.te_delta * 30;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -73,6 +73,22 @@ void subghz_protocol_decoder_doitrand_reset(void* context);
  */
 void subghz_protocol_decoder_doitrand_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderDoitrand is waiting for a new frame.
+ * @param context Pointer to a SubGhzProtocolDecoderDoitrand instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_doitrand_is_idle(void* context);
+
+/**
+ * Get the pulse that can start a new frame on idle SubGhzProtocolDecoderDoitrand.
+ * @param context Pointer to a SubGhzProtocolDecoderDoitrand instance
+ * @param window Pointer to a SubGhzDecoderStartWindow instance
+ */
+void subghz_protocol_decoder_doitrand_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderDoitrand instance
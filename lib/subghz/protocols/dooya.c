@@ -43,6 +43,8 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
 
     .feed = subghz_protocol_decoder_dooya_feed,
     .reset = subghz_protocol_decoder_dooya_reset,
+    .is_idle = subghz_protocol_decoder_dooya_is_idle,
+    .get_start_window = subghz_protocol_decoder_dooya_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_dooya_get_hash_data,
     .serialize = subghz_protocol_decoder_dooya_serialize,
@@ -304,6 +306,21 @@ void subghz_protocol_decoder_dooya_feed(void* context, bool level, uint32_t dura
     }
 }
 
+bool subghz_protocol_decoder_dooya_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDooya* instance = context;
+    return instance->decoder.parser_step == DooyaDecoderStepReset;
+}
+
+void subghz_protocol_decoder_dooya_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_dooya_const.te_long * 12;
+    window->te_delta = subghz_protocol_dooya_const.te_delta * 20;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -73,6 +73,22 @@ void subghz_protocol_decoder_dooya_reset(void* context);
  */
 void subghz_protocol_decoder_dooya_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderDooya is waiting for a new frame.
+ * @param context Pointer to a SubGhzProtocolDecoderDooya instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_dooya_is_idle(void* context);
+
+/**
+ * Get the pulse that can start a new frame on idle SubGhzProtocolDecoderDooya.
+ * @param context Pointer to a SubGhzProtocolDecoderDooya instance
+ * @param window Pointer to a SubGhzDecoderStartWindow instance
+ */
+void subghz_protocol_decoder_dooya_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderDooya instance
@@ -64,6 +64,8 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
 
     .feed = subghz_protocol_decoder_faac_slh_feed,
     .reset = subghz_protocol_decoder_faac_slh_reset,
+    .is_idle = subghz_protocol_decoder_faac_slh_is_idle,
+    .get_start_window = subghz_protocol_decoder_faac_slh_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_faac_slh_get_hash_data,
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
@@ -483,6 +485,21 @@ void subghz_protocol_decoder_faac_slh_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_faac_slh_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderFaacSLH* instance = context;
+    return instance->decoder.parser_step == FaacSLHDecoderStepReset;
+}
+
+void subghz_protocol_decoder_faac_slh_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_faac_slh_const.te_long * 2;
+    window->te_delta = subghz_protocol_faac_slh_const.te_delta * 3;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -42,6 +42,8 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
 
     .feed = subghz_protocol_decoder_gate_tx_feed,
     .reset = subghz_protocol_decoder_gate_tx_reset,
+    .is_idle = subghz_protocol_decoder_gate_tx_is_idle,
+    .get_start_window = subghz_protocol_decoder_gate_tx_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_gate_tx_get_hash_data,
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
@@ -269,6 +271,21 @@ void subghz_protocol_decoder_gate_tx_feed(void* context, bool level, uint32_t du
     }
 }
 
+bool subghz_protocol_decoder_gate_tx_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderGateTx* instance = context;
+    return instance->decoder.parser_step == GateTXDecoderStepReset;
+}
+
+void subghz_protocol_decoder_gate_tx_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_gate_tx_const.te_short * 47;
+    window->te_delta = subghz_protocol_gate_tx_const.te_delta * 47;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -52,6 +52,8 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
 
     .feed = subghz_protocol_decoder_holtek_feed,
     .reset = subghz_protocol_decoder_holtek_reset,
+    .is_idle = subghz_protocol_decoder_holtek_is_idle,
+    .get_start_window = subghz_protocol_decoder_holtek_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_holtek_get_hash_data,
     .serialize = subghz_protocol_decoder_holtek_serialize,
@@ -288,6 +290,21 @@ void subghz_protocol_decoder_holtek_feed(void* context, bool level, uint32_t dur
     }
 }
 
+bool subghz_protocol_decoder_holtek_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek* instance = context;
+    return instance->decoder.parser_step == HoltekDecoderStepReset;
+}
+
+void subghz_protocol_decoder_holtek_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_holtek_const.te_short * 36;
+    window->te_delta = subghz_protocol_holtek_const.te_delta * 36;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
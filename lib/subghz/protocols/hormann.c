@@ -46,6 +46,8 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
 
     .feed = subghz_protocol_decoder_hormann_feed,
     .reset = subghz_protocol_decoder_hormann_reset,
+    .is_idle = subghz_protocol_decoder_hormann_is_idle,
+    .get_start_window = subghz_protocol_decoder_hormann_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_hormann_get_hash_data,
     .serialize = subghz_protocol_decoder_hormann_serialize,
@@ -280,6 +282,21 @@ void subghz_protocol_decoder_hormann_feed(void* context, bool level, uint32_t du
     }
 }
 
+bool subghz_protocol_decoder_hormann_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHormann* instance = context;
+    return instance->decoder.parser_step == HormannDecoderStepReset;
+}
+
+void subghz_protocol_decoder_hormann_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_hormann_const.te_short * 24;
+    window->te_delta = subghz_protocol_hormann_const.te_delta * 24;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -42,6 +42,8 @@ const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
 
     .feed = subghz_protocol_decoder_ido_feed,
     .reset = subghz_protocol_decoder_ido_reset,
+    .is_idle = subghz_protocol_decoder_ido_is_idle,
+    .get_start_window = subghz_protocol_decoder_ido_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_ido_get_hash_data,
     .deserialize = subghz_protocol_decoder_ido_deserialize,
@@ -160,6 +162,21 @@ void subghz_protocol_decoder_ido_feed(void* context, bool level, uint32_t durati
     }
 }
 
+bool subghz_protocol_decoder_ido_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIDo* instance = context;
+    return instance->decoder.parser_step == IDoDecoderStepReset;
+}
+
+void subghz_protocol_decoder_ido_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_ido_const.te_short * 10;
+    window->te_delta = subghz_protocol_ido_const.te_delta * 5;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
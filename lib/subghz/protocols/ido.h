@@ -38,6 +38,20 @@ void subghz_protocol_decoder_ido_reset(void* context);
  */
 void subghz_protocol_decoder_ido_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderIDo is waiting for a new frame.
+ * @param context Pointer to a SubGhzProtocolDecoderIDo instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_ido_is_idle(void* context);
+
+/**
+ * Get the pulse that can start a new frame on idle SubGhzProtocolDecoderIDo.
+ * @param context Pointer to a SubGhzProtocolDecoderIDo instance
+ * @param window Pointer to a SubGhzDecoderStartWindow instance
+ */
+void subghz_protocol_decoder_ido_get_start_window(void* context, SubGhzDecoderStartWindow* window);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderIDo instance
@@ -51,6 +51,8 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
 
     .feed = subghz_protocol_decoder_intertechno_v3_feed,
     .reset = subghz_protocol_decoder_intertechno_v3_reset,
+    .is_idle = subghz_protocol_decoder_intertechno_v3_is_idle,
+    .get_start_window = subghz_protocol_decoder_intertechno_v3_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_intertechno_v3_get_hash_data,
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
@@ -346,6 +348,21 @@ void subghz_protocol_decoder_intertechno_v3_feed(void* context, bool level, uint
     }
 }
 
+bool subghz_protocol_decoder_intertechno_v3_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIntertechno_V3* instance = context;
+    return instance->decoder.parser_step == IntertechnoV3DecoderStepReset;
+}
+
+void subghz_protocol_decoder_intertechno_v3_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_intertechno_v3_const.te_short * 37;
+    window->te_delta = subghz_protocol_intertechno_v3_const.te_delta * 15;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
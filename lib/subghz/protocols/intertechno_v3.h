@@ -74,6 +74,22 @@ void subghz_protocol_decoder_intertechno_v3_reset(void* context);
  */
 void subghz_protocol_decoder_intertechno_v3_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderIntertechno_V3 is waiting for a new frame.
+ * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_intertechno_v3_is_idle(void* context);
+
+/**
+ * Get the pulse that can start a new frame on idle SubGhzProtocolDecoderIntertechno_V3.
+ * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
+ * @param window Pointer to a SubGhzDecoderStartWindow instance
+ */
+void subghz_protocol_decoder_intertechno_v3_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
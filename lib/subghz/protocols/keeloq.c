@@ -60,6 +60,8 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
 
     .feed = subghz_protocol_decoder_keeloq_feed,
     .reset = subghz_protocol_decoder_keeloq_reset,
+    .is_idle = subghz_protocol_decoder_keeloq_is_idle,
+    .get_start_window = subghz_protocol_decoder_keeloq_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_keeloq_get_hash_data,
     .serialize = subghz_protocol_decoder_keeloq_serialize,
@@ -714,6 +716,21 @@ void subghz_protocol_decoder_keeloq_feed(void* context, bool level, uint32_t dur
     }
 }
 
+bool subghz_protocol_decoder_keeloq_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+    return instance->decoder.parser_step == KeeloqDecoderStepReset;
+}
+
+void subghz_protocol_decoder_keeloq_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_keeloq_const.te_short;
+    window->te_delta = subghz_protocol_keeloq_const.te_delta;
+}
+
 /**
  * Validation of decrypt data.
  * @param instance Pointer to a SubGhzBlockGeneric instance
@@ -44,6 +44,8 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
 
     .feed = subghz_protocol_decoder_kia_feed,
     .reset = subghz_protocol_decoder_kia_reset,
+    .is_idle = subghz_protocol_decoder_kia_is_idle,
+    .get_start_window = subghz_protocol_decoder_kia_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_kia_get_hash_data,
     .serialize = subghz_protocol_decoder_kia_serialize,
@@ -191,6 +193,21 @@ void subghz_protocol_decoder_kia_feed(void* context, bool level, uint32_t durati
     }
 }
 
+bool subghz_protocol_decoder_kia_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKIA* instance = context;
+    return instance->decoder.parser_step == KIADecoderStepReset;
+}
+
+void subghz_protocol_decoder_kia_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_kia_const.te_short;
+    window->te_delta = subghz_protocol_kia_const.te_delta;
+}
+
 uint8_t subghz_protocol_kia_crc8(uint8_t* data, size_t len) {
     uint8_t crc = 0x08;
     size_t i, j;
@@ -38,6 +38,20 @@ void subghz_protocol_decoder_kia_reset(void* context);
  */
 void subghz_protocol_decoder_kia_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderKIA is waiting for a new frame.
+ * @param context Pointer to a SubGhzProtocolDecoderKIA instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_kia_is_idle(void* context);
+
+/**
+ * Get the pulse that can start a new frame on idle SubGhzProtocolDecoderKIA.
+ * @param context Pointer to a SubGhzProtocolDecoderKIA instance
+ * @param window Pointer to a SubGhzDecoderStartWindow instance
+ */
+void subghz_protocol_decoder_kia_get_start_window(void* context, SubGhzDecoderStartWindow* window);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderKIA instance
@@ -48,6 +48,8 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
 
     .feed = subghz_protocol_decoder_linear_feed,
     .reset = subghz_protocol_decoder_linear_reset,
+    .is_idle = subghz_protocol_decoder_linear_is_idle,
+    .get_start_window = subghz_protocol_decoder_linear_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_linear_get_hash_data,
     .serialize = subghz_protocol_decoder_linear_serialize,
@@ -293,6 +295,21 @@ void subghz_protocol_decoder_linear_feed(void* context, bool level, uint32_t dur
     }
 }
 
+bool subghz_protocol_decoder_linear_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinear* instance = context;
+    return instance->decoder.parser_step == LinearDecoderStepReset;
+}
+
+void subghz_protocol_decoder_linear_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_linear_const.te_short * 42;
+    window->te_delta = subghz_protocol_linear_const.te_delta * 20;
+}
+
 uint32_t subghz_protocol_decoder_linear_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderLinear* instance = context;
@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
 
     .feed = subghz_protocol_decoder_linear_delta3_feed,
     .reset = subghz_protocol_decoder_linear_delta3_reset,
+    .is_idle = subghz_protocol_decoder_linear_delta3_is_idle,
+    .get_start_window = subghz_protocol_decoder_linear_delta3_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_linear_delta3_get_hash_data,
     .serialize = subghz_protocol_decoder_linear_delta3_serialize,
@@ -304,6 +306,21 @@ void subghz_protocol_decoder_linear_delta3_feed(void* context, bool level, uint3
     }
 }
 
+bool subghz_protocol_decoder_linear_delta3_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinearDelta3* instance = context;
+    return instance->decoder.parser_step == LinearDecoderStepReset;
+}
+
+void subghz_protocol_decoder_linear_delta3_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_linear_delta3_const.te_short * 70;
+    window->te_delta = subghz_protocol_linear_delta3_const.te_delta * 24;
+}
+
 uint32_t subghz_protocol_decoder_linear_delta3_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderLinearDelta3* instance = context;
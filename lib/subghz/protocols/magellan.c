@@ -44,6 +44,8 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
 
     .feed = subghz_protocol_decoder_magellan_feed,
     .reset = subghz_protocol_decoder_magellan_reset,
+    .is_idle = subghz_protocol_decoder_magellan_is_idle,
+    .get_start_window = subghz_protocol_decoder_magellan_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_magellan_get_hash_data,
     .serialize = subghz_protocol_decoder_magellan_serialize,
@@ -348,6 +350,21 @@ void subghz_protocol_decoder_magellan_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_magellan_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMagellan* instance = context;
+    return instance->decoder.parser_step == MagellanDecoderStepReset;
+}
+
+void subghz_protocol_decoder_magellan_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_magellan_const.te_short;
+    window->te_delta = subghz_protocol_magellan_const.te_delta;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
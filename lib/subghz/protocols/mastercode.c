@@ -56,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
 
     .feed = subghz_protocol_decoder_mastercode_feed,
     .reset = subghz_protocol_decoder_mastercode_reset,
+    .is_idle = subghz_protocol_decoder_mastercode_is_idle,
+    .get_start_window = subghz_protocol_decoder_mastercode_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_mastercode_get_hash_data,
     .serialize = subghz_protocol_decoder_mastercode_serialize,
@@ -304,6 +306,21 @@ void subghz_protocol_decoder_mastercode_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_mastercode_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMastercode* instance = context;
+    return instance->decoder.parser_step == MastercodeDecoderStepReset;
+}
+
+void subghz_protocol_decoder_mastercode_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_mastercode_const.te_short * 15;
+    window->te_delta = subghz_protocol_mastercode_const.te_delta * 15;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
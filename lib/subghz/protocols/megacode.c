@@ -54,6 +54,8 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
 
     .feed = subghz_protocol_decoder_megacode_feed,
     .reset = subghz_protocol_decoder_megacode_reset,
+    .is_idle = subghz_protocol_decoder_megacode_is_idle,
+    .get_start_window = subghz_protocol_decoder_megacode_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_megacode_get_hash_data,
     .serialize = subghz_protocol_decoder_megacode_serialize,
@@ -323,6 +325,21 @@ void subghz_protocol_decoder_megacode_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_megacode_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMegaCode* instance = context;
+    return instance->decoder.parser_step == MegaCodeDecoderStepReset;
+}
+
+void subghz_protocol_decoder_megacode_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_megacode_const.te_short * 13;
+    window->te_delta = subghz_protocol_megacode_const.te_delta * 17;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -44,6 +44,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
 
     .feed = subghz_protocol_decoder_nero_radio_feed,
     .reset = subghz_protocol_decoder_nero_radio_reset,
+    .is_idle = subghz_protocol_decoder_nero_radio_is_idle,
+    .get_start_window = subghz_protocol_decoder_nero_radio_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_nero_radio_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
@@ -350,6 +352,21 @@ void subghz_protocol_decoder_nero_radio_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_nero_radio_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroRadio* instance = context;
+    return instance->decoder.parser_step == NeroRadioDecoderStepReset;
+}
+
+void subghz_protocol_decoder_nero_radio_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_nero_radio_const.te_short;
+    window->te_delta = subghz_protocol_nero_radio_const.te_delta;
+}
+
 uint32_t subghz_protocol_decoder_nero_radio_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroRadio* instance = context;
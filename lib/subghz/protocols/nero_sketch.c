@@ -43,6 +43,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
 
     .feed = subghz_protocol_decoder_nero_sketch_feed,
     .reset = subghz_protocol_decoder_nero_sketch_reset,
+    .is_idle = subghz_protocol_decoder_nero_sketch_is_idle,
+    .get_start_window = subghz_protocol_decoder_nero_sketch_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_nero_sketch_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
@@ -321,6 +323,21 @@ void subghz_protocol_decoder_nero_sketch_feed(void* context, bool level, uint32_
     }
 }
 
+bool subghz_protocol_decoder_nero_sketch_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroSketch* instance = context;
+    return instance->decoder.parser_step == NeroSketchDecoderStepReset;
+}
+
+void subghz_protocol_decoder_nero_sketch_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_nero_sketch_const.te_short;
+    window->te_delta = subghz_protocol_nero_sketch_const.te_delta;
+}
+
 uint32_t subghz_protocol_decoder_nero_sketch_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroSketch* instance = context;
@@ -41,6 +41,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
 
     .feed = subghz_protocol_decoder_nice_flo_feed,
     .reset = subghz_protocol_decoder_nice_flo_reset,
+    .is_idle = subghz_protocol_decoder_nice_flo_is_idle,
+    .get_start_window = subghz_protocol_decoder_nice_flo_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_nice_flo_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
@@ -276,6 +278,21 @@ void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t d
     }
 }
 
+bool subghz_protocol_decoder_nice_flo_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+    return instance->decoder.parser_step == NiceFloDecoderStepReset;
+}
+
+void subghz_protocol_decoder_nice_flo_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_nice_flo_const.te_short * 36;
+    window->te_delta = subghz_protocol_nice_flo_const.te_delta * 36;
+}
+
 uint32_t subghz_protocol_decoder_nice_flo_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
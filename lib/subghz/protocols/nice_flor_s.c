@@ -59,6 +59,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
 
     .feed = subghz_protocol_decoder_nice_flor_s_feed,
     .reset = subghz_protocol_decoder_nice_flor_s_reset,
+    .is_idle = subghz_protocol_decoder_nice_flor_s_is_idle,
+    .get_start_window = subghz_protocol_decoder_nice_flor_s_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_nice_flor_s_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
@@ -626,6 +628,21 @@ void subghz_protocol_decoder_nice_flor_s_feed(void* context, bool level, uint32_
     }
 }
 
+bool subghz_protocol_decoder_nice_flor_s_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlorS* instance = context;
+    return instance->decoder.parser_step == NiceFlorSDecoderStepReset;
+}
+
+void subghz_protocol_decoder_nice_flor_s_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_nice_flor_s_const.te_short * 38;
+    window->te_delta = subghz_protocol_nice_flor_s_const.te_delta * 38;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
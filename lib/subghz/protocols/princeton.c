@@ -52,6 +52,8 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
 
     .feed = subghz_protocol_decoder_princeton_feed,
     .reset = subghz_protocol_decoder_princeton_reset,
+    .is_idle = subghz_protocol_decoder_princeton_is_idle,
+    .get_start_window = subghz_protocol_decoder_princeton_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_princeton_get_hash_data,
     .serialize = subghz_protocol_decoder_princeton_serialize,
@@ -296,6 +298,21 @@ void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_princeton_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+    return instance->decoder.parser_step == PrincetonDecoderStepReset;
+}
+
+void subghz_protocol_decoder_princeton_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_princeton_const.te_short * 36;
+    window->te_delta = subghz_protocol_princeton_const.te_delta * 36;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
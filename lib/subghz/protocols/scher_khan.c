@@ -50,6 +50,8 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
 
     .feed = subghz_protocol_decoder_scher_khan_feed,
     .reset = subghz_protocol_decoder_scher_khan_reset,
+    .is_idle = subghz_protocol_decoder_scher_khan_is_idle,
+    .get_start_window = subghz_protocol_decoder_scher_khan_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_scher_khan_get_hash_data,
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
@@ -204,6 +206,21 @@ void subghz_protocol_decoder_scher_khan_feed(void* context, bool level, uint32_t
     }
 }
 
+bool subghz_protocol_decoder_scher_khan_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderScherKhan* instance = context;
+    return instance->decoder.parser_step == ScherKhanDecoderStepReset;
+}
+
+void subghz_protocol_decoder_scher_khan_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_scher_khan_const.te_short * 2;
+    window->te_delta = subghz_protocol_scher_khan_const.te_delta;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
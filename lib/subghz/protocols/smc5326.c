@@ -67,6 +67,8 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
 
     .feed = subghz_protocol_decoder_smc5326_feed,
     .reset = subghz_protocol_decoder_smc5326_reset,
+    .is_idle = subghz_protocol_decoder_smc5326_is_idle,
+    .get_start_window = subghz_protocol_decoder_smc5326_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_smc5326_get_hash_data,
     .serialize = subghz_protocol_decoder_smc5326_serialize,
@@ -308,6 +310,21 @@ void subghz_protocol_decoder_smc5326_feed(void* context, bool level, uint32_t du
     }
 }
 
+bool subghz_protocol_decoder_smc5326_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSMC5326* instance = context;
+    return instance->decoder.parser_step == SMC5326DecoderStepReset;
+}
+
+void subghz_protocol_decoder_smc5326_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = false;
+    window->te = subghz_protocol_smc5326_const.te_short * 24;
+    window->te_delta = subghz_protocol_smc5326_const.te_delta * 12;
+}
+
 uint32_t subghz_protocol_decoder_smc5326_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderSMC5326* instance = context;
@@ -48,6 +48,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
 
     .feed = subghz_protocol_decoder_somfy_keytis_feed,
     .reset = subghz_protocol_decoder_somfy_keytis_reset,
+    .is_idle = subghz_protocol_decoder_somfy_keytis_is_idle,
+    .get_start_window = subghz_protocol_decoder_somfy_keytis_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_somfy_keytis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
@@ -588,6 +590,21 @@ void subghz_protocol_decoder_somfy_keytis_feed(void* context, bool level, uint32
     }
 }
 
+bool subghz_protocol_decoder_somfy_keytis_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSomfyKeytis* instance = context;
+    return instance->decoder.parser_step == SomfyKeytisDecoderStepReset;
+}
+
+void subghz_protocol_decoder_somfy_keytis_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_somfy_keytis_const.te_short * 4;
+    window->te_delta = subghz_protocol_somfy_keytis_const.te_delta * 4;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
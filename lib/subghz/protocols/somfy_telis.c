@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
 
     .feed = subghz_protocol_decoder_somfy_telis_feed,
     .reset = subghz_protocol_decoder_somfy_telis_reset,
+    .is_idle = subghz_protocol_decoder_somfy_telis_is_idle,
+    .get_start_window = subghz_protocol_decoder_somfy_telis_get_start_window,
 
     .get_hash_data = subghz_protocol_decoder_somfy_telis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_telis_serialize,
@@ -538,6 +540,21 @@ void subghz_protocol_decoder_somfy_telis_feed(void* context, bool level, uint32_
     }
 }
 
+bool subghz_protocol_decoder_somfy_telis_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSomfyTelis* instance = context;
+    return instance->decoder.parser_step == SomfyTelisDecoderStepReset;
+}
+
+void subghz_protocol_decoder_somfy_telis_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_somfy_telis_const.te_short * 4;
+    window->te_delta = subghz_protocol_somfy_telis_const.te_delta * 4;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
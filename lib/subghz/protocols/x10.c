@@ -71,6 +71,8 @@ const SubGhzProtocolDecoder subghz_protocol_x10_decoder = {
     .free = subghz_protocol_decoder_x10_free,
     .feed = subghz_protocol_decoder_x10_feed,
     .reset = subghz_protocol_decoder_x10_reset,
+    .is_idle = subghz_protocol_decoder_x10_is_idle,
+    .get_start_window = subghz_protocol_decoder_x10_get_start_window,
     .get_hash_data = subghz_protocol_decoder_x10_get_hash_data,
     .serialize = subghz_protocol_decoder_x10_serialize,
     .deserialize = subghz_protocol_decoder_x10_deserialize,
@@ -201,6 +203,21 @@ void subghz_protocol_decoder_x10_feed(void* context, bool level, uint32_t durati
     }
 }
 
+bool subghz_protocol_decoder_x10_is_idle(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderX10* instance = context;
+    return instance->decoder.parser_step == X10DecoderStepReset;
+}
+
+void subghz_protocol_decoder_x10_get_start_window(
+    void* context,
+    SubGhzDecoderStartWindow* window) {
+    UNUSED(context);
+    window->level = true;
+    window->te = subghz_protocol_x10_const.te_short * 16;
+    window->te_delta = subghz_protocol_x10_const.te_delta * 7;
+}
+
 /** 
  * Set the serial and btn values based on the data and data_count_bit.
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -38,6 +38,20 @@ void subghz_protocol_decoder_x10_reset(void* context);
  */
 void subghz_protocol_decoder_x10_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Check if decoder SubGhzProtocolDecoderX10 is waiting for a new frame.
+ * @param context Pointer to a SubGhzProtocolDecoderX10 instance
+ * @return true if decoder is in reset state
+ */
+bool subghz_protocol_decoder_x10_is_idle(void* context);
+
+/**
+ * Get the pulse that can start a new frame on idle SubGhzProtocolDecoderX10.
+ * @param context Pointer to a SubGhzProtocolDecoderX10 instance
+ * @param window Pointer to a SubGhzDecoderStartWindow instance
+ */
+void subghz_protocol_decoder_x10_get_start_window(void* context, SubGhzDecoderStartWindow* window);
+
 /**
  * Validates if the current data is valid.
  * 
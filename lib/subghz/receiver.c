@@ -4,9 +4,21 @@
 #include "protocols/protocol_items.h"
 
 #include <m-array.h>
+#include <toolbox/profiler.h>
+
+// Pre-filter index covers durations up to 32ms in 512us steps, last bucket is open-ended
+#define SUBGHZ_RECEIVER_BUCKET_SHIFT (9U)
+#define SUBGHZ_RECEIVER_BUCKET_COUNT (64U)
+// Decoders beyond this count are always fed
+#define SUBGHZ_RECEIVER_INDEX_SLOTS_MAX (256U)
+#define SUBGHZ_RECEIVER_INDEX_WORDS (SUBGHZ_RECEIVER_INDEX_SLOTS_MAX / 32U)
 
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+    bool indexed;
+    bool start_level;
+    uint32_t start_duration_min;
+    uint32_t start_duration_max;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -16,10 +28,60 @@ struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
 
+    bool prefilter;
+    // Indexed decoders in the middle of a frame
+    uint32_t active[SUBGHZ_RECEIVER_INDEX_WORDS];
+    // Idle indexed decoders by start pulse level and duration bucket
+    uint16_t bucket_offset[SUBGHZ_RECEIVER_BUCKET_COUNT * 2 + 1];
+    uint8_t* bucket_slots;
+    SubGhzReceiverStats stats;
+
     SubGhzReceiverCallback callback;
     void* context;
 };
 
+static inline size_t subghz_receiver_get_bucket(bool level, uint32_t duration) {
+    size_t bucket = duration >> SUBGHZ_RECEIVER_BUCKET_SHIFT;
+    if(bucket >= SUBGHZ_RECEIVER_BUCKET_COUNT) {
+        bucket = SUBGHZ_RECEIVER_BUCKET_COUNT - 1;
+    }
+    return (level ? SUBGHZ_RECEIVER_BUCKET_COUNT : 0) + bucket;
+}
+
+static void subghz_receiver_build_index(SubGhzReceiver* instance) {
+    const size_t slot_count = SubGhzReceiverSlotArray_size(instance->slots);
+    const size_t bucket_total = SUBGHZ_RECEIVER_BUCKET_COUNT * 2;
+
+    // Count slots per bucket first, then lay them out contiguously
+    memset(instance->bucket_offset, 0, sizeof(instance->bucket_offset));
+    for(size_t pass = 0; pass < 2; pass++) {
+        uint16_t fill[SUBGHZ_RECEIVER_BUCKET_COUNT * 2] = {0};
+
+        for(size_t i = 0; i < slot_count; i++) {
+            SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+            if(!slot->indexed) continue;
+
+            size_t first = subghz_receiver_get_bucket(slot->start_level, slot->start_duration_min);
+            size_t last = subghz_receiver_get_bucket(slot->start_level, slot->start_duration_max);
+            for(size_t bucket = first; bucket <= last; bucket++) {
+                if(pass == 0) {
+                    instance->bucket_offset[bucket + 1]++;
+                } else {
+                    instance->bucket_slots[instance->bucket_offset[bucket] + fill[bucket]] = i;
+                    fill[bucket]++;
+                }
+            }
+        }
+
+        if(pass == 0) {
+            for(size_t bucket = 0; bucket < bucket_total; bucket++) {
+                instance->bucket_offset[bucket + 1] += instance->bucket_offset[bucket];
+            }
+            instance->bucket_slots = malloc(instance->bucket_offset[bucket_total] + 1);
+        }
+    }
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
@@ -31,11 +93,32 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
             subghz_protocol_registry_get_by_index(protocol_registry_items, i);
 
         if(protocol->decoder && protocol->decoder->alloc) {
+            size_t index = SubGhzReceiverSlotArray_size(instance->slots);
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
             slot->base = protocol->decoder->alloc(environment);
+            slot->indexed = false;
+
+            if(protocol->decoder->is_idle && protocol->decoder->get_start_window &&
+               index < SUBGHZ_RECEIVER_INDEX_SLOTS_MAX) {
+                SubGhzDecoderStartWindow window;
+                protocol->decoder->get_start_window(slot->base, &window);
+                // DURATION_DIFF(duration, te) < te_delta
+                if(window.te_delta > 0) {
+                    slot->indexed = true;
+                    slot->start_level = window.level;
+                    slot->start_duration_min =
+                        (window.te >= window.te_delta) ? (window.te - window.te_delta + 1) : 0;
+                    slot->start_duration_max = window.te + window.te_delta - 1;
+                }
+            }
         }
     }
 
+    subghz_receiver_build_index(instance);
+    instance->prefilter = false;
+    memset(instance->active, 0, sizeof(instance->active));
+    memset(&instance->stats, 0, sizeof(instance->stats));
+
     instance->callback = NULL;
     instance->context = NULL;
     return instance;
@@ -55,19 +138,129 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
         }
     SubGhzReceiverSlotArray_clear(instance->slots);
 
+    free(instance->bucket_slots);
     free(instance);
 }
 
-void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration) {
-    furi_assert(instance);
-    furi_assert(instance->slots);
+static inline bool subghz_receiver_slot_is_enabled(
+    SubGhzReceiver* instance,
+    const SubGhzReceiverSlot* slot) {
+    return (slot->base->protocol->flag & instance->filter) != 0;
+}
+
+static inline void
+    subghz_receiver_slot_feed(SubGhzReceiverSlot* slot, bool level, uint32_t duration) {
+    slot->base->protocol->decoder->feed(slot->base, level, duration);
+}
 
+static inline bool subghz_receiver_slot_is_idle(SubGhzReceiverSlot* slot) {
+    return slot->base->protocol->decoder->is_idle(slot->base);
+}
+
+static void subghz_receiver_decode_prefiltered(
+    SubGhzReceiver* instance,
+    bool level,
+    uint32_t duration) {
+    // Decoders in the middle of a frame plus idle decoders whose start pulse may match
+    uint32_t candidates[SUBGHZ_RECEIVER_INDEX_WORDS];
+    memcpy(candidates, instance->active, sizeof(candidates));
+
+    size_t bucket = subghz_receiver_get_bucket(level, duration);
+    for(size_t i = instance->bucket_offset[bucket]; i < instance->bucket_offset[bucket + 1];
+        i++) {
+        size_t slot_index = instance->bucket_slots[i];
+        candidates[slot_index / 32] |= (1UL << (slot_index % 32));
+    }
+
+    // Single pass in registry order, so callbacks fire exactly as without pre-filtering
+    uint32_t enabled = 0;
+    uint32_t performed = 0;
+    size_t slot_index = 0;
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
+            const size_t word = slot_index / 32;
+            const uint32_t bit = (1UL << (slot_index % 32));
+            slot_index++;
+
+            if(!subghz_receiver_slot_is_enabled(instance, slot)) {
+                if(slot->indexed) instance->active[word] &= ~bit;
+                continue;
+            }
+            enabled++;
+
+            if(slot->indexed) {
+                if(!(candidates[word] & bit)) continue;
+                if(!(instance->active[word] & bit) &&
+                   (level != slot->start_level || duration < slot->start_duration_min ||
+                    duration > slot->start_duration_max)) {
+                    continue;
+                }
+            }
+
+            subghz_receiver_slot_feed(slot, level, duration);
+            performed++;
+
+            if(slot->indexed) {
+                if(subghz_receiver_slot_is_idle(slot)) {
+                    instance->active[word] &= ~bit;
+                } else {
+                    instance->active[word] |= bit;
+                }
             }
         }
+
+    instance->stats.feeds_performed += performed;
+    instance->stats.feeds_skipped += enabled - performed;
+}
+
+static inline void
+    subghz_receiver_decode_pulse(SubGhzReceiver* instance, bool level, uint32_t duration) {
+    if(instance->prefilter) {
+        subghz_receiver_decode_prefiltered(instance, level, duration);
+    } else {
+        for
+            M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+                if(subghz_receiver_slot_is_enabled(instance, slot)) {
+                    subghz_receiver_slot_feed(slot, level, duration);
+                    instance->stats.feeds_performed++;
+                }
+            }
+    }
+}
+
+PROFILER_PROBE(subghz_receiver_decode_probe);
+
+void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration) {
+    furi_assert(instance);
+    furi_assert(instance->slots);
+
+    PROFILER_ENTER(subghz_receiver_decode_probe);
+    subghz_receiver_decode_pulse(instance, level, duration);
+    PROFILER_EXIT(subghz_receiver_decode_probe);
+}
+
+PROFILER_PROBE(subghz_receiver_decode_batch_probe);
+
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* pulses,
+    size_t count) {
+    furi_assert(instance);
+    furi_assert(instance->slots);
+    furi_assert(pulses);
+
+    PROFILER_ENTER(subghz_receiver_decode_batch_probe);
+
+    // Pulse by pulse across all decoders: rx callbacks may reset the receiver,
+    // so decoders must see the same sequence as with subghz_receiver_decode
+    for(size_t i = 0; i < count; i++) {
+        subghz_receiver_decode_pulse(
+            instance,
+            level_duration_get_level(pulses[i]),
+            level_duration_get_duration(pulses[i]));
+    }
+
+    PROFILER_EXIT(subghz_receiver_decode_batch_probe);
 }
 
 void subghz_receiver_reset(SubGhzReceiver* instance) {
@@ -78,6 +271,7 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
         }
+    memset(instance->active, 0, sizeof(instance->active));
 }
 
 static void subghz_receiver_rx_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
@@ -108,6 +302,26 @@ void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag fil
     instance->filter = filter;
 }
 
+void subghz_receiver_set_prefilter(SubGhzReceiver* instance, bool enable) {
+    furi_assert(instance);
+    if(instance->prefilter == enable) return;
+
+    // Decoders state is unknown when switching modes, start from scratch
+    subghz_receiver_reset(instance);
+    instance->prefilter = enable;
+}
+
+void subghz_receiver_get_stats(SubGhzReceiver* instance, SubGhzReceiverStats* stats) {
+    furi_assert(instance);
+    furi_assert(stats);
+    *stats = instance->stats;
+}
+
+void subghz_receiver_reset_stats(SubGhzReceiver* instance) {
+    furi_assert(instance);
+    memset(&instance->stats, 0, sizeof(instance->stats));
+}
+
 SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
     SubGhzReceiver* instance,
     const char* decoder_name) {
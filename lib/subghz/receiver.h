@@ -9,6 +9,11 @@ extern "C" {
 
 typedef struct SubGhzReceiver SubGhzReceiver;
 
+typedef struct {
+    uint64_t feeds_performed; ///< Decoder feed calls made
+    uint64_t feeds_skipped; ///< Decoder feed calls avoided by pre-filtering
+} SubGhzReceiverStats;
+
 typedef void (*SubGhzReceiverCallback)(
     SubGhzReceiver* decoder,
     SubGhzProtocolDecoderBase* decoder_base,
@@ -35,6 +40,18 @@ void subghz_receiver_free(SubGhzReceiver* instance);
  */
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration);
 
+/**
+ * Parse a sequence of levels and durations received from the air.
+ * Same as calling subghz_receiver_decode for every pulse, rx callbacks fire in the same order.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param pulses Pointer to a LevelDuration array, must not contain reset or wait markers
+ * @param count Number of pulses in array
+ */
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* pulses,
+    size_t count);
+
 /**
  * Reset decoder SubGhzReceiver.
  * @param instance Pointer to a SubGhzReceiver instance
@@ -59,6 +76,28 @@ void subghz_receiver_set_rx_callback(
  */
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter);
 
+/**
+ * Enable decoder pre-filtering.
+ * Idle decoders that provide start window are only fed with pulses that can start a frame.
+ * Decoders without start window and decoders in the middle of a frame are always fed.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param enable true to enable pre-filtering
+ */
+void subghz_receiver_set_prefilter(SubGhzReceiver* instance, bool enable);
+
+/**
+ * Get decoder feed statistics.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param stats Pointer to a SubGhzReceiverStats instance to fill
+ */
+void subghz_receiver_get_stats(SubGhzReceiver* instance, SubGhzReceiverStats* stats);
+
+/**
+ * Reset decoder feed statistics.
+ * @param instance Pointer to a SubGhzReceiver instance
+ */
+void subghz_receiver_reset_stats(SubGhzReceiver* instance);
+
 /**
  * Search for a cattery by his name.
  * @param instance Pointer to a SubGhzReceiver instance
@@ -4,6 +4,8 @@
 
 #define TAG "SubGhzWorker"
 
+#define SUBGHZ_WORKER_BATCH_SIZE (64U)
+
 struct SubGhzWorker {
     FuriThread* thread;
     FuriStreamBuffer* stream;
@@ -16,7 +18,11 @@ struct SubGhzWorker {
 
     SubGhzWorkerOverrunCallback overrun_callback;
     SubGhzWorkerPairCallback pair_callback;
+    SubGhzWorkerPairBatchCallback pair_batch_callback;
     void* context;
+
+    LevelDuration batch[SUBGHZ_WORKER_BATCH_SIZE];
+    size_t batch_count;
 };
 
 /** Rx callback timer
@@ -38,6 +44,24 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
     if(sizeof(LevelDuration) != ret) instance->overrun = true;
 }
 
+static void subghz_worker_flush_batch(SubGhzWorker* instance) {
+    if(instance->batch_count) {
+        instance->pair_batch_callback(instance->context, instance->batch, instance->batch_count);
+        instance->batch_count = 0;
+    }
+}
+
+static void subghz_worker_pair(SubGhzWorker* instance, bool level, uint32_t duration) {
+    if(instance->pair_batch_callback) {
+        instance->batch[instance->batch_count++] = level_duration_make(level, duration);
+        if(instance->batch_count == SUBGHZ_WORKER_BATCH_SIZE) {
+            subghz_worker_flush_batch(instance);
+        }
+    } else if(instance->pair_callback) {
+        instance->pair_callback(instance->context, level, duration);
+    }
+}
+
 /** Worker callback thread
  * 
  * @param context 
@@ -53,6 +77,7 @@ static int32_t subghz_worker_thread_callback(void* context) {
         if(ret == sizeof(LevelDuration)) {
             if(level_duration_is_reset(level_duration)) {
                 FURI_LOG_E(TAG, "Overrun buffer");
+                subghz_worker_flush_batch(instance);
                 if(instance->overrun_callback) instance->overrun_callback(instance->context);
             } else {
                 bool level = level_duration_get_level(level_duration);
@@ -63,18 +88,23 @@ static int32_t subghz_worker_thread_callback(void* context) {
                     instance->filter_level_duration.duration += duration;
 
                 } else if(instance->filter_level_duration.level != level) {
-                    if(instance->pair_callback)
-                        instance->pair_callback(
-                            instance->context,
-                            instance->filter_level_duration.level,
-                            instance->filter_level_duration.duration);
+                    subghz_worker_pair(
+                        instance,
+                        instance->filter_level_duration.level,
+                        instance->filter_level_duration.duration);
 
                     instance->filter_level_duration.duration = duration;
                     instance->filter_level_duration.level = level;
                 }
             }
         }
+
+        // Hand over collected pairs as soon as the capture stream is drained
+        if(furi_stream_buffer_is_empty(instance->stream)) {
+            subghz_worker_flush_batch(instance);
+        }
     }
+    subghz_worker_flush_batch(instance);
 
     return 0;
 }
@@ -115,6 +145,13 @@ void subghz_worker_set_pair_callback(SubGhzWorker* instance, SubGhzWorkerPairCal
     instance->pair_callback = callback;
 }
 
+void subghz_worker_set_pair_batch_callback(
+    SubGhzWorker* instance,
+    SubGhzWorkerPairBatchCallback callback) {
+    furi_assert(instance);
+    instance->pair_batch_callback = callback;
+}
+
 void subghz_worker_set_context(SubGhzWorker* instance, void* context) {
     furi_assert(instance);
     instance->context = context;
@@ -78,6 +78,7 @@ typedef SubGhzProtocolStatus (*SubGhzDeserialize)(void* context, FlipperFormat*
 // Decoder specific
 typedef void (*SubGhzDecoderFeed)(void* decoder, bool level, uint32_t duration);
 typedef void (*SubGhzDecoderReset)(void* decoder);
+typedef bool (*SubGhzDecoderIsIdle)(void* decoder);
 typedef uint32_t (*SubGhzGetHashData)(void* decoder);
 typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 
@@ -85,6 +86,17 @@ typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
 
+/** Pulse that can start a new frame on idle decoder
+ * Matches `level == window.level && DURATION_DIFF(duration, window.te) < window.te_delta`
+ */
+typedef struct {
+    bool level;
+    uint32_t te;
+    uint32_t te_delta;
+} SubGhzDecoderStartWindow;
+
+typedef void (*SubGhzDecoderGetStartWindow)(void* decoder, SubGhzDecoderStartWindow* window);
+
 typedef struct {
     SubGhzAlloc alloc;
     SubGhzFree free;
@@ -96,6 +108,10 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+
+    // Optional, lets receiver skip feeding idle decoder with pulses that can't start a frame
+    SubGhzDecoderIsIdle is_idle;
+    SubGhzDecoderGetStartWindow get_start_window;
 } SubGhzProtocolDecoder;
 
 typedef struct {
@@ -22,9 +22,25 @@ typedef struct {
 
 _Static_assert(sizeof(CompressHeader) == 4, "Incorrect CompressHeader size");
 
+typedef struct CompressIconCacheEntry {
+    const uint8_t* icon_data;
+    struct CompressIconCacheEntry* prev;
+    struct CompressIconCacheEntry* next;
+    size_t size;
+    uint8_t decoded_buff[];
+} CompressIconCacheEntry;
+
 struct CompressIcon {
     heatshrink_decoder* decoder;
     uint8_t decoded_buff[COMPRESS_ICON_DECODED_BUFF_SIZE];
+    // Decoded icons, most recently used first
+    CompressIconCacheEntry* cache_head;
+    CompressIconCacheEntry* cache_tail;
+    volatile size_t cache_size;
+    size_t cache_used;
+    uint32_t cache_entries;
+    uint32_t cache_hits;
+    uint32_t cache_misses;
 };
 
 CompressIcon* compress_icon_alloc() {
@@ -39,12 +55,73 @@ CompressIcon* compress_icon_alloc() {
     return instance;
 }
 
+static void compress_icon_cache_remove(CompressIcon* instance, CompressIconCacheEntry* entry) {
+    if(entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        instance->cache_head = entry->next;
+    }
+    if(entry->next) {
+        entry->next->prev = entry->prev;
+    } else {
+        instance->cache_tail = entry->prev;
+    }
+}
+
+static void compress_icon_cache_push_front(CompressIcon* instance, CompressIconCacheEntry* entry) {
+    entry->prev = NULL;
+    entry->next = instance->cache_head;
+    if(instance->cache_head) {
+        instance->cache_head->prev = entry;
+    } else {
+        instance->cache_tail = entry;
+    }
+    instance->cache_head = entry;
+}
+
+static void compress_icon_cache_trim(CompressIcon* instance, size_t cache_size) {
+    while(instance->cache_used > cache_size) {
+        CompressIconCacheEntry* entry = instance->cache_tail;
+        compress_icon_cache_remove(instance, entry);
+        instance->cache_used -= sizeof(CompressIconCacheEntry) + entry->size;
+        instance->cache_entries--;
+        free(entry);
+    }
+}
+
 void compress_icon_free(CompressIcon* instance) {
     furi_assert(instance);
+    compress_icon_cache_trim(instance, 0);
     heatshrink_decoder_free(instance->decoder);
     free(instance);
 }
 
+// Decode compressed icon to decoded_buff, returns decoded size
+static size_t compress_icon_decode_int(CompressIcon* instance, const uint8_t* icon_data) {
+    CompressHeader* header = (CompressHeader*)icon_data;
+    size_t data_processed = 0;
+    size_t decoded_size = 0;
+    heatshrink_decoder_sink(
+        instance->decoder,
+        (uint8_t*)&icon_data[sizeof(CompressHeader)],
+        header->compressed_buff_size,
+        &data_processed);
+    while(1) {
+        HSD_poll_res res = heatshrink_decoder_poll(
+            instance->decoder,
+            instance->decoded_buff,
+            sizeof(instance->decoded_buff),
+            &data_processed);
+        furi_assert((res == HSDR_POLL_EMPTY) || (res == HSDR_POLL_MORE));
+        decoded_size = MIN(decoded_size + data_processed, sizeof(instance->decoded_buff));
+        if(res != HSDR_POLL_MORE) {
+            break;
+        }
+    }
+    heatshrink_decoder_reset(instance->decoder);
+    return decoded_size;
+}
+
 void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint8_t** decoded_buff) {
     furi_assert(instance);
     furi_assert(icon_data);
@@ -52,30 +129,77 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
 
     CompressHeader* header = (CompressHeader*)icon_data;
     if(header->is_compressed) {
-        size_t data_processed = 0;
-        heatshrink_decoder_sink(
-            instance->decoder,
-            (uint8_t*)&icon_data[sizeof(CompressHeader)],
-            header->compressed_buff_size,
-            &data_processed);
-        while(1) {
-            HSD_poll_res res = heatshrink_decoder_poll(
-                instance->decoder,
-                instance->decoded_buff,
-                sizeof(instance->decoded_buff),
-                &data_processed);
-            furi_assert((res == HSDR_POLL_EMPTY) || (res == HSDR_POLL_MORE));
-            if(res != HSDR_POLL_MORE) {
-                break;
-            }
-        }
-        heatshrink_decoder_reset(instance->decoder);
+        compress_icon_decode_int(instance, icon_data);
         *decoded_buff = instance->decoded_buff;
     } else {
         *decoded_buff = (uint8_t*)&icon_data[1];
     }
 }
 
+void compress_icon_set_cache_size(CompressIcon* instance, size_t cache_size) {
+    furi_assert(instance);
+    instance->cache_size = cache_size;
+}
+
+void compress_icon_get_cache_stats(CompressIcon* instance, CompressIconCacheStats* stats) {
+    furi_assert(instance);
+    furi_assert(stats);
+
+    stats->size = instance->cache_size;
+    stats->used = instance->cache_used;
+    stats->entries = instance->cache_entries;
+    stats->hits = instance->cache_hits;
+    stats->misses = instance->cache_misses;
+}
+
+void compress_icon_decode_cached(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    uint8_t** decoded_buff) {
+    furi_assert(instance);
+    furi_assert(icon_data);
+    furi_assert(decoded_buff);
+
+    const size_t cache_size = instance->cache_size;
+    compress_icon_cache_trim(instance, cache_size);
+
+    CompressHeader* header = (CompressHeader*)icon_data;
+    if(!header->is_compressed || !cache_size) {
+        compress_icon_decode(instance, icon_data, decoded_buff);
+        return;
+    }
+
+    for(CompressIconCacheEntry* entry = instance->cache_head; entry; entry = entry->next) {
+        if(entry->icon_data == icon_data) {
+            instance->cache_hits++;
+            if(entry != instance->cache_head) {
+                compress_icon_cache_remove(instance, entry);
+                compress_icon_cache_push_front(instance, entry);
+            }
+            *decoded_buff = entry->decoded_buff;
+            return;
+        }
+    }
+
+    instance->cache_misses++;
+    const size_t decoded_size = compress_icon_decode_int(instance, icon_data);
+    *decoded_buff = instance->decoded_buff;
+
+    const size_t entry_size = sizeof(CompressIconCacheEntry) + decoded_size;
+    if(entry_size > cache_size) {
+        return;
+    }
+
+    compress_icon_cache_trim(instance, cache_size - entry_size);
+    CompressIconCacheEntry* entry = malloc(entry_size);
+    entry->icon_data = icon_data;
+    entry->size = decoded_size;
+    memcpy(entry->decoded_buff, instance->decoded_buff, decoded_size);
+    compress_icon_cache_push_front(instance, entry);
+    instance->cache_used += entry_size;
+    instance->cache_entries++;
+}
+
 struct Compress {
     heatshrink_encoder* encoder;
     heatshrink_decoder* decoder;
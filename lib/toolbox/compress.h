@@ -38,6 +38,50 @@ void compress_icon_free(CompressIcon* instance);
  */
 void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint8_t** decoded_buff);
 
+/** Compress Icon cache statistics */
+typedef struct {
+    size_t size; /**< RAM budget, bytes */
+    size_t used; /**< Decoded icons and their bookkeeping, bytes */
+    uint32_t entries;
+    uint32_t hits;
+    uint32_t misses;
+} CompressIconCacheStats;
+
+/** Set RAM budget of decoded icons cache, disabled by default
+ *
+ * Budget is applied on next `compress_icon_decode_cached` call, so it can be
+ * changed from any thread.
+ *
+ * @param      instance    The Compress Icon instance
+ * @param      cache_size  cache size in bytes, 0 to disable the cache
+ */
+void compress_icon_set_cache_size(CompressIcon* instance, size_t cache_size);
+
+/** Get decoded icons cache statistics
+ *
+ * @param      instance  The Compress Icon instance
+ * @param      stats     pointer to statistics to fill
+ */
+void compress_icon_get_cache_stats(CompressIcon* instance, CompressIconCacheStats* stats);
+
+/** Decompress icon using LRU cache of decoded icons
+ *
+ * Cache is keyed by icon_data pointer, so the data must stay unchanged while
+ * instance is alive, like icons stored in firmware flash.
+ *
+ * @warning    decoded_buff pointer set by this function is valid till next
+ *             `compress_icon_decode`, `compress_icon_decode_cached` or
+ *             `compress_icon_free` call
+ *
+ * @param      instance      The Compress Icon instance
+ * @param      icon_data     pointer to icon data
+ * @param[in]  decoded_buff  pointer to decoded buffer pointer
+ */
+void compress_icon_decode_cached(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    uint8_t** decoded_buff);
+
 /** Compress control structure */
 typedef struct Compress Compress;
 
@@ -8,11 +8,38 @@
 
 #define TAG "KeysDict"
 
+#define KEYS_DICT_INDEX_MAGIC (0x4B444958U)
+#define KEYS_DICT_INDEX_VERSION (1U)
+
+typedef enum {
+    KeysDictIndexStateUnknown,
+    KeysDictIndexStateReady,
+    KeysDictIndexStateMissing, // No valid index on storage, keys_dict_build_index makes one
+    KeysDictIndexStateUnavailable,
+} KeysDictIndexState;
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t reserved;
+    uint32_t dict_size;
+    uint32_t dict_timestamp;
+    uint32_t key_count;
+} FURI_PACKED KeysDictIndexHeader;
+
 struct KeysDict {
     Stream* stream;
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+
+    Storage* storage;
+    FuriString* path;
+    FuriString* index_path;
+    File* index;
+    KeysDictIndexState index_state;
+    uint32_t index_key_count;
 };
 
 static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
@@ -76,6 +103,12 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
     instance->stream = buffered_file_stream_alloc(storage);
     furi_assert(instance->stream);
 
+    instance->storage = storage;
+    instance->path = furi_string_alloc_set(path);
+    instance->index_path = furi_string_alloc_printf("%s%s", path, KEYS_DICT_INDEX_EXTENSION);
+    instance->index = storage_file_alloc(storage);
+    instance->index_state = KeysDictIndexStateUnknown;
+
     FS_OpenMode open_mode = (mode == KeysDictModeOpenAlways) ? FSOM_OPEN_ALWAYS :
                                                                FSOM_OPEN_EXISTING;
 
@@ -90,6 +123,7 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
 
     if(!file_exists) {
         buffered_file_stream_close(instance->stream);
+        instance->index_state = KeysDictIndexStateUnavailable;
     } else {
         // Eventually add new line character in the last line to avoid skipping keys
         keys_dict_add_ending_new_line(instance);
@@ -121,6 +155,10 @@ void keys_dict_free(KeysDict* instance) {
 
     buffered_file_stream_close(instance->stream);
     stream_free(instance->stream);
+
+    storage_file_free(instance->index);
+    furi_string_free(instance->index_path);
+    furi_string_free(instance->path);
     free(instance);
 
     furi_record_close(RECORD_STORAGE);
@@ -137,7 +175,7 @@ static void keys_dict_int_to_str(KeysDict* instance, const uint8_t* key_int, Fur
         furi_string_cat_printf(key_str, "%02X", key_int[i]);
 }
 
-static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int) {
+static bool keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int) {
     furi_assert(instance);
     furi_assert(key_str);
     furi_assert(key_int);
@@ -151,9 +189,11 @@ static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64
         h = furi_string_get_char(key_str, i);
         l = furi_string_get_char(key_str, i + 1);
 
-        args_char_to_hex(h, l, &key_byte_tmp);
+        if(!args_char_to_hex(h, l, &key_byte_tmp)) return false;
         *key_int |= (uint64_t)key_byte_tmp << (8 * (instance->key_size - 1 - i / 2));
     }
+
+    return true;
 }
 
 size_t keys_dict_get_total_keys(KeysDict* instance) {
@@ -184,6 +224,14 @@ static bool keys_dict_get_next_key_str(KeysDict* instance, FuriString* key) {
     return key_read;
 }
 
+static bool keys_dict_get_next_key_int(KeysDict* instance, FuriString* temp_key, uint64_t* key) {
+    while(keys_dict_get_next_key_str(instance, temp_key)) {
+        if(keys_dict_str_to_int(instance, temp_key, key)) return true;
+        FURI_LOG_W(TAG, "Skipping malformed key %s", furi_string_get_cstr(temp_key));
+    }
+    return false;
+}
+
 bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
     furi_assert(instance);
     furi_assert(instance->stream);
@@ -192,13 +240,11 @@ bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
 
     FuriString* temp_key = furi_string_alloc();
 
-    bool key_read = keys_dict_get_next_key_str(instance, temp_key);
+    uint64_t key_int = 0;
+    bool key_read = keys_dict_get_next_key_int(instance, temp_key, &key_int);
 
     if(key_read) {
         size_t tmp_len = key_size;
-        uint64_t key_int = 0;
-
-        keys_dict_str_to_int(instance, temp_key, &key_int);
 
         while(tmp_len--) {
             key[tmp_len] = (uint8_t)key_int;
@@ -210,6 +256,193 @@ bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
     return key_read;
 }
 
+size_t keys_dict_get_next_keys(KeysDict* instance, uint64_t* keys, size_t count) {
+    furi_assert(instance);
+    furi_assert(instance->stream);
+    furi_assert(keys);
+    furi_check(instance->key_size <= sizeof(uint64_t));
+
+    FuriString* temp_key = furi_string_alloc();
+
+    size_t keys_read = 0;
+    while(keys_read < count && keys_dict_get_next_key_int(instance, temp_key, &keys[keys_read])) {
+        keys_read++;
+    }
+
+    furi_string_free(temp_key);
+    return keys_read;
+}
+
+static void keys_dict_index_invalidate(KeysDict* instance) {
+    if(instance->index_state == KeysDictIndexStateUnavailable) return;
+
+    if(storage_file_is_open(instance->index)) storage_file_close(instance->index);
+    storage_simply_remove(instance->storage, furi_string_get_cstr(instance->index_path));
+    instance->index_state = KeysDictIndexStateMissing;
+}
+
+static bool keys_dict_index_get_source_info(KeysDict* instance, KeysDictIndexHeader* header) {
+    header->magic = KEYS_DICT_INDEX_MAGIC;
+    header->version = KEYS_DICT_INDEX_VERSION;
+    header->key_size = instance->key_size;
+    header->reserved = 0;
+    header->dict_size = stream_size(instance->stream);
+    header->key_count = 0;
+
+    return storage_common_timestamp(
+               instance->storage, furi_string_get_cstr(instance->path), &header->dict_timestamp) ==
+           FSE_OK;
+}
+
+static int keys_dict_index_compare(const void* a, const void* b) {
+    const uint64_t key_a = *(const uint64_t*)a;
+    const uint64_t key_b = *(const uint64_t*)b;
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+static bool keys_dict_index_open(KeysDict* instance, const KeysDictIndexHeader* expected) {
+    KeysDictIndexHeader header;
+
+    bool success = false;
+    do {
+        if(!storage_file_open(
+               instance->index,
+               furi_string_get_cstr(instance->index_path),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING))
+            break;
+        if(storage_file_read(instance->index, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != expected->magic || header.version != expected->version) break;
+        if(header.key_size != expected->key_size) break;
+        // Dictionary was edited since the index was built
+        if(header.dict_size != expected->dict_size) break;
+        if(header.dict_timestamp != expected->dict_timestamp) break;
+        if(storage_file_size(instance->index) !=
+           sizeof(header) + header.key_count * sizeof(uint64_t))
+            break;
+
+        instance->index_key_count = header.key_count;
+        success = true;
+    } while(false);
+
+    if(!success) storage_file_close(instance->index);
+
+    return success;
+}
+
+static bool keys_dict_index_build(KeysDict* instance, KeysDictIndexHeader* header) {
+    // Sorting is done in RAM, don't take the last free block for that
+    size_t keys_size = instance->total_keys * sizeof(uint64_t);
+    if(keys_size > memmgr_heap_get_max_free_block() / 2) {
+        FURI_LOG_W(TAG, "Not enough memory to index %zu keys", instance->total_keys);
+        return false;
+    }
+
+    uint64_t* keys = malloc(keys_size + sizeof(uint64_t));
+
+    uint32_t actual_pos = stream_tell(instance->stream);
+    stream_rewind(instance->stream);
+    size_t key_count = keys_dict_get_next_keys(instance, keys, instance->total_keys);
+    stream_seek(instance->stream, actual_pos, StreamOffsetFromStart);
+
+    qsort(keys, key_count, sizeof(uint64_t), keys_dict_index_compare);
+
+    // Duplicates are useless for lookup
+    size_t unique_count = 0;
+    for(size_t i = 0; i < key_count; i++) {
+        if(unique_count == 0 || keys[unique_count - 1] != keys[i]) {
+            keys[unique_count++] = keys[i];
+        }
+    }
+    header->key_count = unique_count;
+
+    const char* index_path = furi_string_get_cstr(instance->index_path);
+    size_t keys_write_size = unique_count * sizeof(uint64_t);
+    bool success =
+        storage_file_open(instance->index, index_path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+        storage_file_write(instance->index, header, sizeof(KeysDictIndexHeader)) ==
+            sizeof(KeysDictIndexHeader) &&
+        storage_file_write(instance->index, keys, keys_write_size) == keys_write_size;
+    storage_file_close(instance->index);
+    free(keys);
+
+    if(!success) {
+        FURI_LOG_W(TAG, "Unable to write index %s", index_path);
+        storage_simply_remove(instance->storage, index_path);
+    } else {
+        FURI_LOG_I(TAG, "Indexed %zu keys", unique_count);
+    }
+
+    return success;
+}
+
+/** Open a valid index, build a new one only if asked to
+ * Building costs a full list scan and sort, single lookups are cheaper without it
+ */
+static bool keys_dict_index_prepare(KeysDict* instance, bool build) {
+    if(instance->index_state == KeysDictIndexStateUnknown ||
+       (build && instance->index_state == KeysDictIndexStateMissing)) {
+        KeysDictIndexHeader header;
+        instance->index_state = KeysDictIndexStateUnavailable;
+
+        do {
+            // Flush pending writes, so the size covers all keys
+            if(!buffered_file_stream_sync(instance->stream)) break;
+            if(!keys_dict_index_get_source_info(instance, &header)) break;
+            if(keys_dict_index_open(instance, &header)) {
+                instance->index_state = KeysDictIndexStateReady;
+                break;
+            }
+            if(!build) {
+                instance->index_state = KeysDictIndexStateMissing;
+                break;
+            }
+            if(!keys_dict_index_build(instance, &header)) break;
+            if(!keys_dict_index_open(instance, &header)) break;
+            instance->index_state = KeysDictIndexStateReady;
+        } while(false);
+    }
+
+    return instance->index_state == KeysDictIndexStateReady;
+}
+
+static bool keys_dict_index_lookup(KeysDict* instance, uint64_t key) {
+    size_t low = 0;
+    size_t high = instance->index_key_count;
+    bool key_found = false;
+
+    while(low < high) {
+        size_t mid = low + (high - low) / 2;
+        uint64_t mid_key = 0;
+
+        if(!storage_file_seek(
+               instance->index, sizeof(KeysDictIndexHeader) + mid * sizeof(uint64_t), true) ||
+           storage_file_read(instance->index, &mid_key, sizeof(uint64_t)) != sizeof(uint64_t)) {
+            break;
+        }
+
+        if(mid_key == key) {
+            key_found = true;
+            break;
+        } else if(mid_key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return key_found;
+}
+
+static uint64_t keys_dict_bytes_to_int(KeysDict* instance, const uint8_t* key) {
+    furi_check(instance->key_size <= sizeof(uint64_t));
+    uint64_t key_int = 0;
+    for(size_t i = 0; i < instance->key_size; i++) {
+        key_int = (key_int << 8) | key[i];
+    }
+    return key_int;
+}
+
 static bool keys_dict_is_key_present_str(KeysDict* instance, FuriString* key) {
     furi_assert(instance);
     furi_assert(instance->stream);
@@ -236,12 +469,24 @@ static bool keys_dict_is_key_present_str(KeysDict* instance, FuriString* key) {
     return line_found;
 }
 
+bool keys_dict_build_index(KeysDict* instance) {
+    furi_assert(instance);
+    furi_assert(instance->stream);
+    furi_check(instance->key_size <= sizeof(uint64_t));
+
+    return keys_dict_index_prepare(instance, true);
+}
+
 bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key_size) {
     furi_assert(instance);
     furi_assert(instance->stream);
     furi_assert(instance->key_size == key_size);
     furi_assert(key);
 
+    if(keys_dict_index_prepare(instance, false)) {
+        return keys_dict_index_lookup(instance, keys_dict_bytes_to_int(instance, key));
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -266,6 +511,7 @@ static bool keys_dict_add_key_str(KeysDict* instance, FuriString* key) {
        stream_insert_string(instance->stream, key)) {
         instance->total_keys++;
         key_added = true;
+        keys_dict_index_invalidate(instance);
     }
 
     stream_seek(instance->stream, actual_pos, StreamOffsetFromStart);
@@ -300,6 +546,12 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
 
     bool key_removed = false;
 
+    // Skip the file scan for keys that are not in the list at all
+    if(keys_dict_index_prepare(instance, false) &&
+       !keys_dict_index_lookup(instance, keys_dict_bytes_to_int(instance, key))) {
+        return false;
+    }
+
     uint8_t* temp_key = malloc(key_size);
 
     stream_rewind(instance->stream);
@@ -316,6 +568,7 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
             }
             instance->total_keys--;
             key_removed = true;
+            keys_dict_index_invalidate(instance);
         }
     }
 
@@ -8,6 +8,9 @@
 extern "C" {
 #endif
 
+/** Lookup index is cached next to the list, at list path with this extension appended */
+#define KEYS_DICT_INDEX_EXTENSION ".idx"
+
 typedef enum {
     KeysDictModeOpenExisting,
     KeysDictModeOpenAlways,
@@ -56,7 +59,21 @@ size_t keys_dict_get_total_keys(KeysDict* instance);
 */
 bool keys_dict_rewind(KeysDict* instance);
 
+/** Build sorted index of the list for fast key lookups
+ * Index is cached at list path with KEYS_DICT_INDEX_EXTENSION appended and
+ * reused while the list is unchanged. Adding or deleting a key drops it.
+ * Worth it only before many lookups, a single lookup is cheaper with a list scan.
+ * Keys must be at most 8 bytes.
+ *
+ * @param instance  - KeysDict list instance
+ *
+ * @return Returns true if index is ready, false if it can't be built
+*/
+bool keys_dict_build_index(KeysDict* instance);
+
 /** Check if key is present in list
+ * Uses binary search when a valid index exists, see keys_dict_build_index,
+ * scans the list otherwise.
  *
  * @param instance  - KeysDict list instance
  * @param key       - key to check
@@ -78,6 +95,19 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
 */
 bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size);
 
+/** Get next keys from the list in bulk
+ * Same as keys_dict_get_next_key(), but avoids per key overhead. Each key is
+ * packed into uint64_t, first key byte is the most significant one, so keys
+ * must be at most 8 bytes.
+ *
+ * @param instance  - KeysDict list instance
+ * @param keys      - Array where to store keys
+ * @param count     - Capacity of keys array
+ *
+ * @return Returns number of keys retrieved, 0 if there are no more keys
+*/
+size_t keys_dict_get_next_keys(KeysDict* instance, uint64_t* keys, size_t count);
+
 /** Add key to list
  *
  * @param instance  - KeysDict list instance
@@ -1,87 +1,258 @@
 #include "profiler.h"
-#include <stdlib.h>
-#include <m-dict.h>
+
+#include <stdio.h>
+#include <inttypes.h>
+
+// Device backend counts core cycles, host backend counts nanoseconds of monotonic clock
+#ifdef __arm__
 #include <furi.h>
-#include <furi_hal_gpio.h>
+#include <furi_hal.h>
+
+#define PROFILER_LOCK() FURI_CRITICAL_ENTER()
+#define PROFILER_UNLOCK() FURI_CRITICAL_EXIT()
+
+typedef FuriThreadId ProfilerThreadId;
+
+static inline uint32_t profiler_get_ticks(void) {
+    return DWT->CYCCNT;
+}
+
+static inline uint32_t profiler_get_ticks_per_us(void) {
+    return furi_hal_cortex_instructions_per_microsecond();
+}
+
+static inline ProfilerThreadId profiler_get_thread_id(void) {
+    return furi_thread_get_current_id();
+}
+#else
+#include <time.h>
+
+// Host tools are expected to profile from a single thread
+#define PROFILER_LOCK()
+#define PROFILER_UNLOCK()
+
+typedef uint32_t ProfilerThreadId;
+
+static inline uint32_t profiler_get_ticks(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+static inline uint32_t profiler_get_ticks_per_us(void) {
+    return 1000;
+}
+
+static inline ProfilerThreadId profiler_get_thread_id(void) {
+    return 1;
+}
+#endif
+
+#define PROFILER_DUMP_LINE_SIZE (256U)
 
 typedef struct {
-    uint32_t start;
-    uint32_t length;
-    uint32_t count;
-} ProfilerRecord;
+    ProfilerProbe* probes;
+    // Innermost scope of the tracked thread
+    ProfilerProbe* current;
+    ProfilerThreadId current_thread;
+} Profiler;
 
-DICT_DEF2(ProfilerRecordDict, const char*, M_CSTR_OPLIST, ProfilerRecord, M_POD_OPLIST)
-#define M_OPL_ProfilerRecord_t() DICT_OPLIST(ProfilerRecord, M_CSTR_OPLIST, M_POD_OPLIST)
+static Profiler profiler = {0};
 
-struct Profiler {
-    ProfilerRecordDict_t records;
-};
+static void profiler_probe_clear(ProfilerProbe* probe) {
+    probe->parent = NULL;
+    probe->count = 0;
+    probe->total = 0;
+    probe->children = 0;
+    probe->min = UINT32_MAX;
+    probe->max = 0;
+    for(size_t i = 0; i < PROFILER_HISTOGRAM_SIZE; i++) {
+        probe->histogram[i] = 0;
+    }
+}
 
-Profiler* profiler_alloc() {
-    Profiler* profiler = malloc(sizeof(Profiler));
-    ProfilerRecordDict_init(profiler->records);
-    return profiler;
+static bool profiler_probe_is_ancestor(const ProfilerProbe* probe, const ProfilerProbe* scope) {
+    for(; scope; scope = scope->parent) {
+        if(scope == probe) return true;
+    }
+    return false;
+}
+
+static size_t profiler_get_histogram_bucket(uint32_t ticks) {
+    uint32_t us = ticks / profiler_get_ticks_per_us();
+    size_t bucket = us ? (32 - __builtin_clz(us)) : 0;
+    return (bucket < PROFILER_HISTOGRAM_SIZE) ? bucket : (PROFILER_HISTOGRAM_SIZE - 1);
 }
 
-void profiler_free(Profiler* profiler) {
-    ProfilerRecordDict_clear(profiler->records);
-    free(profiler);
+void profiler_enter(ProfilerProbe* probe) {
+    ProfilerThreadId thread_id = profiler_get_thread_id();
+
+    PROFILER_LOCK();
+
+    if(!probe->registered) {
+        probe->next = profiler.probes;
+        profiler.probes = probe;
+        probe->registered = true;
+    }
+
+    // Recursive call, outermost one covers the whole time
+    if(probe->depth++ == 0) {
+        if(profiler.current == NULL || profiler.current_thread == thread_id) {
+            probe->detached = false;
+            probe->outer = profiler.current;
+            // First seen parent wins, keeping the probe tree free of cycles
+            if(probe->outer && !probe->parent &&
+               !profiler_probe_is_ancestor(probe, probe->outer)) {
+                probe->parent = probe->outer;
+            }
+
+            profiler.current = probe;
+            profiler.current_thread = thread_id;
+        } else {
+            probe->detached = true;
+            probe->outer = NULL;
+        }
+
+        probe->start = profiler_get_ticks();
+    }
+
+    PROFILER_UNLOCK();
 }
 
-void profiler_prealloc(Profiler* profiler, const char* key) {
-    ProfilerRecord record = {
-        .start = 0,
-        .length = 0,
-        .count = 0,
-    };
+void profiler_exit(ProfilerProbe* probe) {
+    uint32_t ticks = profiler_get_ticks();
+
+    PROFILER_LOCK();
 
-    ProfilerRecordDict_set_at(profiler->records, key, record);
+    if(probe->depth > 0 && --probe->depth == 0) {
+        uint32_t length = ticks - probe->start;
+
+        probe->count++;
+        probe->total += length;
+        if(length < probe->min) probe->min = length;
+        if(length > probe->max) probe->max = length;
+        probe->histogram[profiler_get_histogram_bucket(length)]++;
+
+        if(!probe->detached) {
+            if(probe->outer) probe->outer->children += length;
+            profiler.current = probe->outer;
+        }
+    }
+
+    PROFILER_UNLOCK();
 }
 
-void profiler_start(Profiler* profiler, const char* key) {
-    ProfilerRecord* record = ProfilerRecordDict_get(profiler->records, key);
-    if(record == NULL) {
-        profiler_prealloc(profiler, key);
-        record = ProfilerRecordDict_get(profiler->records, key);
+void profiler_reset(void) {
+    PROFILER_LOCK();
+    for(ProfilerProbe* probe = profiler.probes; probe; probe = probe->next) {
+        profiler_probe_clear(probe);
     }
+    PROFILER_UNLOCK();
+}
 
-    furi_check(record->start == 0);
-    record->start = DWT->CYCCNT;
+const ProfilerProbe* profiler_get_probes(void) {
+    return profiler.probes;
 }
 
-void profiler_stop(Profiler* profiler, const char* key) {
-    ProfilerRecord* record = ProfilerRecordDict_get(profiler->records, key);
-    furi_check(record != NULL);
+uint64_t profiler_probe_get_self(const ProfilerProbe* probe) {
+    return (probe->total > probe->children) ? (probe->total - probe->children) : 0;
+}
 
-    record->length += DWT->CYCCNT - record->start;
-    record->start = 0;
-    record->count++;
+uint64_t profiler_ticks_to_us(uint64_t ticks) {
+    return ticks / profiler_get_ticks_per_us();
 }
 
-void profiler_dump(Profiler* profiler) {
-    printf("Profiler:\r\n");
+static void profiler_dump_text(
+    const ProfilerProbe* parent,
+    size_t level,
+    char* line,
+    ProfilerOutputCallback output,
+    void* context) {
+    for(const ProfilerProbe* probe = profiler.probes; probe; probe = probe->next) {
+        if(probe->parent != parent) continue;
 
-    ProfilerRecordDict_it_t it;
-    for(ProfilerRecordDict_it(it, profiler->records); !ProfilerRecordDict_end_p(it);
-        ProfilerRecordDict_next(it)) {
-        const ProfilerRecordDict_itref_t* itref = ProfilerRecordDict_cref(it);
+        snprintf(
+            line,
+            PROFILER_DUMP_LINE_SIZE,
+            "%*s%s[%" PRIu32 "]: total %" PRIu64 " us, self %" PRIu64 " us, min %" PRIu64
+            " us, max %" PRIu64 " us\r\n",
+            (int)(level * 2),
+            "",
+            probe->name,
+            probe->count,
+            profiler_ticks_to_us(probe->total),
+            profiler_ticks_to_us(profiler_probe_get_self(probe)),
+            profiler_ticks_to_us(probe->count ? probe->min : 0),
+            profiler_ticks_to_us(probe->max));
+        output(line, context);
 
-        uint32_t count = itref->value.count;
+        profiler_dump_text(probe, level + 1, line, output, context);
+    }
+}
 
-        uint32_t clocks = itref->value.length;
-        double us = (double)clocks / (double)64.0;
-        double ms = (double)clocks / (double)64000.0;
-        double s = (double)clocks / (double)64000000.0;
+static void profiler_dump_record(
+    const ProfilerProbe* probe,
+    ProfilerFormat format,
+    char* line,
+    ProfilerOutputCallback output,
+    void* context) {
+    const char* parent = probe->parent ? probe->parent->name : "";
 
-        printf("\t%s[%lu]: %f s, %f ms, %f us, %lu clk\r\n", itref->key, count, s, ms, us, clocks);
+    snprintf(
+        line,
+        PROFILER_DUMP_LINE_SIZE,
+        (format == ProfilerFormatJson) ?
+            "{\"name\":\"%s\",\"parent\":\"%s\",\"count\":%" PRIu32 ",\"total_us\":%" PRIu64
+            ",\"self_us\":%" PRIu64 ",\"min_us\":%" PRIu64 ",\"max_us\":%" PRIu64
+            ",\"histogram\":[" :
+            "%s,%s,%" PRIu32 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64,
+        probe->name,
+        parent,
+        probe->count,
+        profiler_ticks_to_us(probe->total),
+        profiler_ticks_to_us(profiler_probe_get_self(probe)),
+        profiler_ticks_to_us(probe->count ? probe->min : 0),
+        profiler_ticks_to_us(probe->max));
+    output(line, context);
+
+    for(size_t i = 0; i < PROFILER_HISTOGRAM_SIZE; i++) {
+        const char* separator = (format == ProfilerFormatJson && i == 0) ? "" : ",";
+        snprintf(line, PROFILER_DUMP_LINE_SIZE, "%s%" PRIu32, separator, probe->histogram[i]);
+        output(line, context);
+    }
+
+    if(format == ProfilerFormatJson) {
+        output(probe->next ? "]},\r\n" : "]}\r\n", context);
+    } else {
+        output("\r\n", context);
+    }
+}
 
-        if(count > 1) {
-            us /= (double)count;
-            ms /= (double)count;
-            s /= (double)count;
-            clocks /= count;
+void profiler_dump(ProfilerFormat format, ProfilerOutputCallback output, void* context) {
+    char line[PROFILER_DUMP_LINE_SIZE];
 
-            printf("\t%s[1]: %f s, %f ms, %f us, %lu clk\r\n", itref->key, s, ms, us, clocks);
+    if(format == ProfilerFormatText) {
+        output("Profiler:\r\n", context);
+        profiler_dump_text(NULL, 1, line, output, context);
+        return;
+    }
+
+    if(format == ProfilerFormatJson) {
+        output("[\r\n", context);
+    } else {
+        output("name,parent,count,total_us,self_us,min_us,max_us", context);
+        for(size_t i = 0; i < PROFILER_HISTOGRAM_SIZE; i++) {
+            snprintf(line, PROFILER_DUMP_LINE_SIZE, ",hist_%zu", i);
+            output(line, context);
         }
+        output("\r\n", context);
+    }
+
+    for(const ProfilerProbe* probe = profiler.probes; probe; probe = probe->next) {
+        profiler_dump_record(probe, format, line, output, context);
+    }
+
+    if(format == ProfilerFormatJson) {
+        output("]\r\n", context);
     }
 }
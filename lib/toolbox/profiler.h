@@ -1,23 +1,127 @@
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-typedef struct Profiler Profiler;
+/** Number of duration histogram buckets
+ *
+ * Bucket 0 counts calls shorter than 1us, bucket n counts calls in [2^(n-1), 2^n) us,
+ * last bucket is open-ended.
+ */
+#define PROFILER_HISTOGRAM_SIZE (16U)
+
+typedef struct ProfilerProbe ProfilerProbe;
+
+/** Static probe, statistics of a single profiled scope
+ *
+ * Define probes with PROFILER_PROBE_DEFINE(), all fields are managed by the profiler.
+ * Durations are in backend ticks, use profiler_ticks_to_us() to convert them.
+ */
+struct ProfilerProbe {
+    const char* name;
+    ProfilerProbe* next; /**< next registered probe */
+    ProfilerProbe* parent; /**< scope this probe was first entered from, NULL for root */
+    ProfilerProbe* outer; /**< enclosing scope of the current call */
+    bool registered;
+    bool detached; /**< current call is not nested into the active scope stack */
+    uint32_t depth; /**< recursion depth of the current call */
+    uint32_t start;
+    uint32_t count;
+    uint64_t total;
+    uint64_t children; /**< time spent in nested probes */
+    uint32_t min;
+    uint32_t max;
+    uint32_t histogram[PROFILER_HISTOGRAM_SIZE];
+};
 
-Profiler* profiler_alloc();
+#define PROFILER_PROBE_INIT(probe_name) \
+    { .name = (probe_name), .min = UINT32_MAX }
+
+/** Define static probe, probe registers itself on the first use */
+#define PROFILER_PROBE_DEFINE(probe) static ProfilerProbe probe = PROFILER_PROBE_INIT(#probe)
+
+/** Probes placed in firmware hot paths
+ *
+ * Compiled in only with PROFILER_ENABLED defined,
+ * for example `./fbt --extra-define=PROFILER_ENABLED`.
+ */
+#ifdef PROFILER_ENABLED
+#define PROFILER_PROBE(probe) PROFILER_PROBE_DEFINE(probe)
+#define PROFILER_ENTER(probe) profiler_enter(&(probe))
+#define PROFILER_EXIT(probe) profiler_exit(&(probe))
+#else
+#define PROFILER_PROBE(probe) extern ProfilerProbe probe
+#define PROFILER_ENTER(probe)
+#define PROFILER_EXIT(probe)
+#endif
 
-void profiler_free(Profiler* profiler);
+typedef enum {
+    ProfilerFormatText,
+    ProfilerFormatCsv,
+    ProfilerFormatJson,
+} ProfilerFormat;
 
-void profiler_prealloc(Profiler* profiler, const char* key);
+/** Dump output callback, called with consecutive chunks of the dump
+ *
+ * @param      data     zero-terminated chunk
+ * @param      context  callback context
+ */
+typedef void (*ProfilerOutputCallback)(const char* data, void* context);
 
-void profiler_start(Profiler* profiler, const char* key);
+/** Enter profiled scope
+ *
+ * Scopes entered before the matching profiler_exit() are accounted as children.
+ * Nesting is tracked for one thread at a time, scopes entered from other threads
+ * meanwhile are measured standalone. A probe must not be used by several threads
+ * at once.
+ *
+ * @param      probe  probe instance
+ */
+void profiler_enter(ProfilerProbe* probe);
 
-void profiler_stop(Profiler* profiler, const char* key);
+/** Exit profiled scope
+ *
+ * @param      probe  probe instance, same as in profiler_enter()
+ */
+void profiler_exit(ProfilerProbe* probe);
 
-void profiler_dump(Profiler* profiler);
+/** Clear statistics of all registered probes */
+void profiler_reset(void);
+
+/** Get registered probes
+ *
+ * @return     first probe, iterate further with ProfilerProbe::next
+ */
+const ProfilerProbe* profiler_get_probes(void);
+
+/** Get time spent in probe without nested probes
+ *
+ * @param      probe  probe instance
+ *
+ * @return     time in ticks
+ */
+uint64_t profiler_probe_get_self(const ProfilerProbe* probe);
+
+/** Convert backend ticks to microseconds
+ *
+ * @param      ticks  duration in ticks
+ *
+ * @return     duration in microseconds
+ */
+uint64_t profiler_ticks_to_us(uint64_t ticks);
+
+/** Dump statistics of all registered probes
+ *
+ * @param      format    output format
+ * @param      output    output callback
+ * @param      context   output callback context
+ */
+void profiler_dump(ProfilerFormat format, ProfilerOutputCallback output, void* context);
 
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
@@ -18,9 +18,23 @@ typedef LevelDuration (*ProtocolEncoderYield)(void* protocol);
 typedef void (*ProtocolRenderData)(void* protocol, FuriString* result);
 typedef bool (*ProtocolWriteData)(void* protocol, void* data);
 
+/** Pulse timing signature of a decoder, used by ProtocolDict for early rejection
+ *
+ * Pulses with duration outside of [min, max] must not be able to advance the decoder.
+ * Once the decoder got `reject_after` such pulses in a row, further out of range pulses
+ * must not change its state at all, so they are not fed until an in-range pulse arrives.
+ * Zeroed signature (max == 0) disables rejection, decoder gets every pulse.
+ */
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t reject_after;
+} ProtocolDecoderTiming;
+
 typedef struct {
     ProtocolDecoderStart start;
     ProtocolDecoderFeed feed;
+    ProtocolDecoderTiming timing;
 } ProtocolDecoder;
 
 typedef struct {
@@ -5,6 +5,8 @@ struct ProtocolDict {
     const ProtocolBase** base;
     size_t count;
     void** data;
+    // Out of range pulses in a row, per decoder
+    uint32_t* rejected;
 };
 
 ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count) {
@@ -12,6 +14,7 @@ ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count)
     dict->base = protocols;
     dict->count = count;
     dict->data = malloc(sizeof(void*) * dict->count);
+    dict->rejected = malloc(sizeof(uint32_t) * dict->count);
 
     for(size_t i = 0; i < dict->count; i++) {
         dict->data[i] = dict->base[i]->alloc();
@@ -25,6 +28,7 @@ void protocol_dict_free(ProtocolDict* dict) {
         dict->base[i]->free(dict->data[i]);
     }
 
+    free(dict->rejected);
     free(dict->data);
     free(dict);
 }
@@ -85,6 +89,7 @@ const char* protocol_dict_get_manufacturer(ProtocolDict* dict, size_t protocol_i
 void protocol_dict_decoders_start(ProtocolDict* dict) {
     for(size_t i = 0; i < dict->count; i++) {
         ProtocolDecoderStart fn = dict->base[i]->decoder.start;
+        dict->rejected[i] = 0;
 
         if(fn) {
             fn(dict->data[i]);
@@ -97,19 +102,34 @@ uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index) {
     return dict->base[protocol_index]->features;
 }
 
+static inline bool
+    protocol_dict_decoder_feed(ProtocolDict* dict, size_t index, bool level, uint32_t duration) {
+    const ProtocolDecoder* decoder = &dict->base[index]->decoder;
+    if(!decoder->feed) return false;
+
+    const ProtocolDecoderTiming* timing = &decoder->timing;
+    if(timing->max) {
+        if(duration < timing->min || duration > timing->max) {
+            // Decoder is out of sync and stays idle until an in-range pulse re-arms it
+            if(dict->rejected[index] >= timing->reject_after) return false;
+            dict->rejected[index]++;
+        } else {
+            dict->rejected[index] = 0;
+        }
+    }
+
+    return decoder->feed(dict->data[index], level, duration);
+}
+
 ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t duration) {
     bool done = false;
     ProtocolId ready_protocol_id = PROTOCOL_NO;
 
     for(size_t i = 0; i < dict->count; i++) {
-        ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
-
-        if(fn) {
-            if(fn(dict->data[i], level, duration)) {
-                if(!done) {
-                    ready_protocol_id = i;
-                    done = true;
-                }
+        if(protocol_dict_decoder_feed(dict, i, level, duration)) {
+            if(!done) {
+                ready_protocol_id = i;
+                done = true;
             }
         }
     }
@@ -128,14 +148,10 @@ ProtocolId protocol_dict_decoders_feed_by_feature(
     for(size_t i = 0; i < dict->count; i++) {
         uint32_t features = dict->base[i]->features;
         if(features & feature) {
-            ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
-
-            if(fn) {
-                if(fn(dict->data[i], level, duration)) {
-                    if(!done) {
-                        ready_protocol_id = i;
-                        done = true;
-                    }
+            if(protocol_dict_decoder_feed(dict, i, level, duration)) {
+                if(!done) {
+                    ready_protocol_id = i;
+                    done = true;
                 }
             }
         }
@@ -152,12 +168,9 @@ ProtocolId protocol_dict_decoders_feed_by_id(
     furi_assert(protocol_index < dict->count);
 
     ProtocolId ready_protocol_id = PROTOCOL_NO;
-    ProtocolDecoderFeed fn = dict->base[protocol_index]->decoder.feed;
 
-    if(fn) {
-        if(fn(dict->data[protocol_index], level, duration)) {
-            ready_protocol_id = protocol_index;
-        }
+    if(protocol_dict_decoder_feed(dict, protocol_index, level, duration)) {
+        ready_protocol_id = protocol_index;
     }
 
     return ready_protocol_id;
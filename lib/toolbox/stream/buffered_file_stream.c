@@ -8,6 +8,9 @@ typedef struct {
     Stream stream_base;
     Stream* file_stream;
     StreamCache* cache;
+    // File offset of the read cache data, computed on demand for every new cache fill
+    size_t window_start;
+    bool window_start_valid;
     bool sync_pending;
 } BufferedFileStream;
 
@@ -29,6 +32,7 @@ static bool buffered_file_stream_delete_and_insert(
 
 static bool buffered_file_stream_flush(BufferedFileStream* stream);
 static bool buffered_file_stream_unread(BufferedFileStream* stream);
+static size_t buffered_file_stream_window_start(BufferedFileStream* stream);
 
 const StreamVTable buffered_file_stream_vtable = {
     .free = (StreamFreeFn)buffered_file_stream_free,
@@ -43,10 +47,14 @@ const StreamVTable buffered_file_stream_vtable = {
 };
 
 Stream* buffered_file_stream_alloc(Storage* storage) {
+    return buffered_file_stream_alloc_ex(storage, STREAM_CACHE_DEFAULT_SIZE);
+}
+
+Stream* buffered_file_stream_alloc_ex(Storage* storage, size_t cache_size) {
     BufferedFileStream* stream = malloc(sizeof(BufferedFileStream));
 
     stream->file_stream = file_stream_alloc(storage);
-    stream->cache = stream_cache_alloc();
+    stream->cache = stream_cache_alloc_ex(cache_size);
     stream->sync_pending = false;
 
     stream->stream_base.vtable = &buffered_file_stream_vtable;
@@ -130,6 +138,20 @@ static bool buffered_file_stream_seek(
     bool success = true;
     int32_t new_offset = offset;
 
+    if(offset_type == StreamOffsetFromStart && offset >= 0 && !stream->sync_pending) {
+        // Absolute seek that lands inside of the read window does not touch the file
+        const size_t cache_size = stream_cache_size(stream->cache);
+        if(cache_size > 0) {
+            const size_t window_start = buffered_file_stream_window_start(stream);
+            if((size_t)offset >= window_start && (size_t)offset <= window_start + cache_size) {
+                const int32_t cache_offset =
+                    (int32_t)((size_t)offset - window_start - stream_cache_pos(stream->cache));
+                stream_cache_seek(stream->cache, cache_offset);
+                return true;
+            }
+        }
+    }
+
     if(offset_type == StreamOffsetFromCurrent) {
         new_offset -= stream_cache_seek(stream->cache, offset);
         if(new_offset < 0) {
@@ -152,6 +174,10 @@ static bool buffered_file_stream_seek(
 }
 
 static size_t buffered_file_stream_tell(BufferedFileStream* stream) {
+    if(!stream->sync_pending && stream_cache_size(stream->cache) > 0) {
+        return buffered_file_stream_window_start(stream) + stream_cache_pos(stream->cache);
+    }
+
     size_t pos = stream_tell(stream->file_stream) + stream_cache_pos(stream->cache);
     if(!stream->sync_pending) {
         pos -= stream_cache_size(stream->cache);
@@ -200,6 +226,7 @@ static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* dat
             if(stream->sync_pending) {
                 if(!buffered_file_stream_flush(stream)) break;
             }
+            stream->window_start_valid = false;
             if(!stream_cache_fill(stream->cache, stream->file_stream)) break;
         }
     }
@@ -251,3 +278,13 @@ static bool buffered_file_stream_unread(BufferedFileStream* stream) {
     }
     return success;
 }
+
+// Get file offset of the read cache data, must be called only when the cache holds read data
+static size_t buffered_file_stream_window_start(BufferedFileStream* stream) {
+    if(!stream->window_start_valid) {
+        stream->window_start =
+            stream_tell(stream->file_stream) - stream_cache_size(stream->cache);
+        stream->window_start_valid = true;
+    }
+    return stream->window_start;
+}
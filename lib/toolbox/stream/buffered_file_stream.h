@@ -13,6 +13,16 @@ extern "C" {
  */
 Stream* buffered_file_stream_alloc(Storage* storage);
 
+/**
+ * Allocate a file stream with buffered read operations and custom read window size
+ * Larger window means fewer storage accesses when reading big files line by line
+ * and keeps seeks back into recently read data (including absolute ones) in memory.
+ * @param storage pointer to storage instance
+ * @param cache_size read window size in bytes
+ * @return Stream*
+ */
+Stream* buffered_file_stream_alloc_ex(Storage* storage, size_t cache_size);
+
 /**
  * Opens an existing file or creates a new one.
  * @param stream pointer to file stream object.
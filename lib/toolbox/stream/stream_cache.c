@@ -1,15 +1,20 @@
 #include "stream_cache.h"
 
-#define STREAM_CACHE_MAX_SIZE 1024U
-
 struct StreamCache {
-    uint8_t data[STREAM_CACHE_MAX_SIZE];
+    size_t capacity;
     size_t data_size;
     size_t position;
+    uint8_t data[];
 };
 
 StreamCache* stream_cache_alloc() {
-    StreamCache* cache = malloc(sizeof(StreamCache));
+    return stream_cache_alloc_ex(STREAM_CACHE_DEFAULT_SIZE);
+}
+
+StreamCache* stream_cache_alloc_ex(size_t capacity) {
+    furi_check(capacity > 0);
+    StreamCache* cache = malloc(sizeof(StreamCache) + capacity);
+    cache->capacity = capacity;
     cache->data_size = 0;
     cache->position = 0;
     return cache;
@@ -40,7 +45,7 @@ size_t stream_cache_pos(StreamCache* cache) {
 }
 
 size_t stream_cache_fill(StreamCache* cache, Stream* stream) {
-    const size_t size_read = stream_read(stream, cache->data, STREAM_CACHE_MAX_SIZE);
+    const size_t size_read = stream_read(stream, cache->data, cache->capacity);
     cache->data_size = size_read;
     cache->position = 0;
     return size_read;
@@ -66,7 +71,7 @@ size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size) {
 
 size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size) {
     furi_assert(cache->data_size >= cache->position);
-    const size_t size_written = MIN(size, STREAM_CACHE_MAX_SIZE - cache->position);
+    const size_t size_written = MIN(size, cache->capacity - cache->position);
     if(size_written > 0) {
         memcpy(cache->data + cache->position, data, size_written);
         cache->position += size_written;
@@ -6,6 +6,9 @@
 extern "C" {
 #endif
 
+/** Default cache size, used by stream_cache_alloc() */
+#define STREAM_CACHE_DEFAULT_SIZE 1024U
+
 typedef struct StreamCache StreamCache;
 
 /**
@@ -14,6 +17,14 @@ typedef struct StreamCache StreamCache;
  */
 StreamCache* stream_cache_alloc();
 
+/**
+ * Allocate stream cache of given size.
+ * Bigger caches read ahead further and keep more data available for backward seeks.
+ * @param capacity Cache size in bytes, must not be zero
+ * @return StreamCache* pointer to a StreamCache instance
+ */
+StreamCache* stream_cache_alloc_ex(size_t capacity);
+
 /**
  * Free stream cache.
  * @param cache Pointer to a StreamCache instance
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+
+import os
+import random
+
+from fbt.sdk.cache import SdkCache
+from fbt.sdk.hashes import gnu_sym_hash
+from fbt.sdk.perfect_hash import build_perfect_hash, phf_lookup
+from flipper.app import App
+from flipper.utils.host_build import HostBuild
+
+BENCH_SOURCE = """
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+typedef struct {
+    uint32_t hash;
+    uint32_t address;
+} sym_entry;
+
+static const sym_entry sorted_table[] = {%(sorted_table)s};
+static const sym_entry phf_table[] = {%(phf_table)s};
+static const uint16_t displacements[] = {%(displacements)s};
+static const uint32_t queries[] = {%(queries)s};
+
+#define TABLE_SIZE (sizeof(phf_table) / sizeof(phf_table[0]))
+#define BUCKET_COUNT (sizeof(displacements) / sizeof(displacements[0]))
+#define QUERY_COUNT (sizeof(queries) / sizeof(queries[0]))
+#define ROUNDS %(rounds)d
+
+static uint32_t mix(uint32_t value) {
+    value ^= value >> 16;
+    value *= 0x85EBCA6BU;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35U;
+    value ^= value >> 16;
+    return value;
+}
+
+/* Same steps as std::lower_bound in elf_resolve_from_hashtable */
+static uint32_t lookup_sorted(uint32_t hash) {
+    const sym_entry* first = sorted_table;
+    size_t count = TABLE_SIZE;
+    while(count > 0) {
+        size_t step = count / 2;
+        if(first[step].hash < hash) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return (first != sorted_table + TABLE_SIZE && first->hash == hash) ? first->address : 0;
+}
+
+/* Same steps as elf_resolve_from_perfect_hash */
+static uint32_t lookup_phf(uint32_t hash) {
+    size_t bucket = ((uint64_t)mix(hash) * BUCKET_COUNT) >> 32;
+    uint32_t seed = displacements[bucket] * 0x9E3779B9U;
+    size_t slot = ((uint64_t)mix(mix(hash) ^ seed) * TABLE_SIZE) >> 32;
+    return phf_table[slot].hash == hash ? phf_table[slot].address : 0;
+}
+
+static double bench(uint32_t (*lookup)(uint32_t), uint32_t* checksum) {
+    struct timespec start, end;
+    volatile uint32_t sum = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(int round = 0; round < ROUNDS; round++) {
+        for(size_t i = 0; i < QUERY_COUNT; i++) {
+            sum += lookup(queries[i]);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *checksum = sum;
+    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    return ns / ((double)ROUNDS * QUERY_COUNT);
+}
+
+int main(void) {
+    uint32_t sorted_sum, phf_sum;
+    double sorted_ns = bench(lookup_sorted, &sorted_sum);
+    double phf_ns = bench(lookup_phf, &phf_sum);
+    printf("%%.2f %%.2f %%d\\n", sorted_ns, phf_ns, sorted_sum == phf_sum);
+    return 0;
+}
+"""
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument(
+            "-s",
+            "--symbols",
+            help="API symbols file",
+            default="targets/f7/api_symbols.csv",
+        )
+        self.parser.add_argument(
+            "-r", "--rounds", type=int, default=2000, help="Passes over all symbols"
+        )
+        self.parser.add_argument(
+            "-m",
+            "--miss-ratio",
+            type=float,
+            default=0.05,
+            help="Share of lookups for missing symbols",
+        )
+        self.parser.add_argument(
+            "--cc", help="Host C compiler", default=os.environ.get("CC", "cc")
+        )
+        self.parser.set_defaults(func=self.bench)
+
+    def bench(self):
+        host_build = HostBuild(self.logger, self.args.cc)
+        if not host_build.check():
+            return 1
+
+        sdk = SdkCache(self.args.symbols)
+        names = [entry.name for entry in sdk.get_functions()]
+        names += [entry.name for entry in sdk.get_variables()]
+        keys = [gnu_sym_hash(name) for name in names]
+        phf = build_perfect_hash(keys)
+
+        # Same check as is_perfect_hash_valid in firmware
+        for index, key in enumerate(keys):
+            if phf_lookup(phf, keys, key) != index:
+                self.logger.error(f"Perfect hash is broken for {names[index]}")
+                return 1
+
+        def format_table(indexes):
+            return ", ".join(f"{{{keys[i]}u, {i + 1}u}}" for i in indexes)
+
+        rng = random.Random(0)
+        queries = keys.copy()
+        queries += [
+            rng.getrandbits(32) for _ in range(int(len(keys) * self.args.miss_ratio))
+        ]
+        rng.shuffle(queries)
+
+        source = BENCH_SOURCE % {
+            "sorted_table": format_table(
+                sorted(range(len(keys)), key=keys.__getitem__)
+            ),
+            "phf_table": format_table(phf.slots),
+            "displacements": ", ".join(map(str, phf.displacements)),
+            "queries": ", ".join(f"{query}u" for query in queries),
+            "rounds": self.args.rounds,
+        }
+
+        result = host_build.run(source)
+
+        sorted_ns, phf_ns, matches = result.stdout.split()
+        if matches != "1":
+            self.logger.error("Lookup results differ")
+            return 1
+
+        table_bytes = len(keys) * 8
+        print(f"Symbols: {len(keys)}, table: {table_bytes} bytes")
+        print(
+            f"Perfect hash: {phf.bucket_count} buckets, "
+            f"{phf.bucket_count * 2} bytes of displacements, "
+            f"max displacement {max(phf.displacements)}"
+        )
+        print(f"Binary search: {sorted_ns} ns/lookup")
+        print(f"Perfect hash: {phf_ns} ns/lookup")
+        print(f"Speedup: {float(sorted_ns) / float(phf_ns):.2f}x")
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
@@ -0,0 +1,102 @@
+"""Minimal perfect hash over API symbol hashes.
+
+Hash and displace construction: symbol hashes are split into buckets, buckets
+are placed largest first, each one with the smallest displacement that maps all
+of its keys to free slots. Table is emitted in slot order, so a lookup is two
+mixes, one displacement read and one table read.
+
+Must match api_phf_* functions in api_hashtable.h.
+"""
+
+from dataclasses import dataclass
+
+MASK32 = 0xFFFFFFFF
+DISPLACEMENT_MAX = 0xFFFF
+DISPLACEMENT_MULTIPLIER = 0x9E3779B9
+# Average keys per bucket, lower values take more memory and less build time
+BUCKET_LOADS = (4, 3, 2)
+
+
+class PerfectHashError(Exception):
+    pass
+
+
+@dataclass
+class PerfectHash:
+    displacements: list[int]
+    slots: list[int]  # key index for each table slot
+
+    @property
+    def bucket_count(self) -> int:
+        return len(self.displacements)
+
+
+def phf_mix(value: int) -> int:
+    value ^= value >> 16
+    value = (value * 0x85EBCA6B) & MASK32
+    value ^= value >> 13
+    value = (value * 0xC2B2AE35) & MASK32
+    value ^= value >> 16
+    return value
+
+
+def phf_bucket(key: int, bucket_count: int) -> int:
+    return (phf_mix(key) * bucket_count) >> 32
+
+
+def phf_slot(key: int, displacement: int, size: int) -> int:
+    seed = (displacement * DISPLACEMENT_MULTIPLIER) & MASK32
+    return (phf_mix(phf_mix(key) ^ seed) * size) >> 32
+
+
+def _place_buckets(keys: list[int], bucket_count: int) -> PerfectHash | None:
+    size = len(keys)
+    buckets = [[] for _ in range(bucket_count)]
+    for index, key in enumerate(keys):
+        buckets[phf_bucket(key, bucket_count)].append(index)
+
+    slots = [None] * size
+    displacements = [0] * bucket_count
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        indexes = buckets[bucket]
+        if not indexes:
+            break
+
+        for displacement in range(DISPLACEMENT_MAX + 1):
+            placed = [phf_slot(keys[i], displacement, size) for i in indexes]
+            if len(set(placed)) == len(placed) and all(
+                slots[slot] is None for slot in placed
+            ):
+                break
+        else:
+            return None
+
+        displacements[bucket] = displacement
+        for slot, index in zip(placed, indexes):
+            slots[slot] = index
+
+    return PerfectHash(displacements, slots)
+
+
+def build_perfect_hash(keys: list[int]) -> PerfectHash:
+    if len(set(keys)) != len(keys):
+        raise PerfectHashError("Duplicate keys, API symbol hash collision")
+
+    if not keys:
+        return PerfectHash([0], [])
+
+    for load in BUCKET_LOADS:
+        bucket_count = (len(keys) + load - 1) // load
+        if result := _place_buckets(keys, bucket_count):
+            return result
+
+    raise PerfectHashError(f"Can't build perfect hash for {len(keys)} keys")
+
+
+def phf_lookup(phf: PerfectHash, keys: list[int], key: int) -> int | None:
+    """Key index or None, same steps as the firmware resolver"""
+    if not phf.slots:
+        return None
+    displacement = phf.displacements[phf_bucket(key, phf.bucket_count)]
+    index = phf.slots[phf_slot(key, displacement, len(phf.slots))]
+    return index if keys[index] == key else None
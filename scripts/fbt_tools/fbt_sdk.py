@@ -6,6 +6,8 @@ import shutil
 
 from fbt.sdk.cache import SdkCache
 from fbt.sdk.collector import SdkCollector
+from fbt.sdk.hashes import gnu_sym_hash
+from fbt.sdk.perfect_hash import PerfectHashError, build_perfect_hash
 from fbt.util import path_as_posix
 from SCons.Action import Action
 from SCons.Builder import Builder
@@ -201,22 +203,35 @@ def gen_sdk_data(sdk_cache: SdkCache):
 
     api_def.append(f"const int elf_api_version = {sdk_cache.version.as_int()};")
 
-    api_def.append(
-        "static constexpr auto elf_api_table = sort(create_array_t<sym_entry>("
-    )
-
+    api_names = []
     api_lines = []
     for fun_def in sdk_cache.get_functions():
+        api_names.append(fun_def.name)
         api_lines.append(
             f"API_METHOD({fun_def.name}, {fun_def.returns}, ({fun_def.params}))"
         )
 
     for var_def in sdk_cache.get_variables():
+        api_names.append(var_def.name)
         api_lines.append(f"API_VARIABLE({var_def.name}, {var_def.var_type })")
 
-    api_def.append(",\n".join(api_lines))
+    # Table is ordered by perfect hash slots, see api_phf_* in api_hashtable.h
+    try:
+        phf = build_perfect_hash([gnu_sym_hash(name) for name in api_names])
+    except PerfectHashError as e:
+        raise UserError(f"API table generation failed: {e}")
 
-    api_def.append("));")
+    api_def.append("static constexpr auto elf_api_table = create_array_t<sym_entry>(")
+    api_def.append(",\n".join(api_lines[index] for index in phf.slots))
+    api_def.append(");")
+
+    api_def.append(
+        "static constexpr std::array<uint16_t, "
+        f"{phf.bucket_count}> elf_api_phf_displacements = {{"
+    )
+    for row in range(0, phf.bucket_count, 16):
+        api_def.append(", ".join(map(str, phf.displacements[row : row + 16])) + ",")
+    api_def.append("};")
     return api_def
 
 
@@ -87,18 +87,28 @@ class BufferedRead:
             data = self.stream.read(i)
             self.buffer.extend(data)
 
+    def read(self, size: int):
+        """Read exactly size bytes, buffered data first"""
+        if len(self.buffer) < size:
+            self.buffer.extend(self.stream.read(size - len(self.buffer)))
+        read = self.buffer[:size]
+        self.buffer = self.buffer[size:]
+        return read
+
 
 class FlipperStorage:
     CLI_PROMPT = ">: "
     CLI_EOL = "\r\n"
 
-    def __init__(self, portname: str, chunk_size: int = 8192):
+    def __init__(self, portname: str, chunk_size: int = 8192, window: int = 4):
         self.port = serial.Serial()
         self.port.port = portname
         self.port.timeout = 2
         self.port.baudrate = 115200  # Doesn't matter for VCP
         self.read = BufferedRead(self.port)
         self.chunk_size = chunk_size
+        # Chunks requested from Flipper without waiting, 0 for lockstep transfers
+        self.window = window
 
     def __enter__(self):
         self.start()
@@ -228,18 +238,49 @@ class FlipperStorage:
         for new_path in walk_dirs:
             yield from self.walk(new_path)
 
+    def _print_progress(self, direction, done, total, start_time):
+        percent = math.ceil(done / total * 100) if total else 100
+        total_chunks = math.ceil(total / self.chunk_size)
+        current_chunk = math.ceil(done / self.chunk_size)
+        approx_speed = done / (time.time() - start_time + 0.0001)
+        sys.stdout.write(
+            f"\r{direction}{percent:3d}%, chunk {current_chunk:2d} of {total_chunks:2d} @ {approx_speed/1024:.2f} kb/s"
+        )
+        sys.stdout.flush()
+
     def send_file(self, filename_from: str, filename_to: str):
         """Send file from local device to Flipper"""
-        if self.exist_file(filename_to):
-            self.remove(filename_to)
-
         with open(filename_from, "rb") as file:
             filesize = os.fstat(file.fileno()).st_size
 
-            buffer_size = self.chunk_size
             start_time = time.time()
+            # Stream whole file in one command, older firmware prints usage instead
+            self.send_and_wait_eol(f'storage write_chunks "{filename_to}" {filesize}\r')
+            answer = self.read.until(self.CLI_EOL)
+            if self.has_error(answer):
+                last_error = self.get_error(answer)
+                self.read.until(self.CLI_PROMPT)
+                raise FlipperStorageException.from_error_code(filename_to, last_error)
+
+            if answer == b"Ready":
+                while filedata := file.read(self.chunk_size):
+                    self.port.write(filedata)
+                    self._print_progress("<", file.tell(), filesize, start_time)
+                answer = self.read.until(self.CLI_PROMPT)
+                print()
+                if self.has_error(answer):
+                    raise FlipperStorageException.from_error_code(
+                        filename_to, self.get_error(answer.strip())
+                    )
+                return
+
+            self.read.until(self.CLI_PROMPT)
+
+            if self.exist_file(filename_to):
+                self.remove(filename_to)
+
             while True:
-                filedata = file.read(buffer_size)
+                filedata = file.read(self.chunk_size)
                 size = len(filedata)
                 if size == 0:
                     break
@@ -256,15 +297,7 @@ class FlipperStorage:
                 self.port.write(filedata)
                 self.read.until(self.CLI_PROMPT)
 
-                ftell = file.tell()
-                percent = math.ceil(ftell / filesize * 100)
-                total_chunks = math.ceil(filesize / buffer_size)
-                current_chunk = math.ceil(ftell / buffer_size)
-                approx_speed = ftell / (time.time() - start_time + 0.0001)
-                sys.stdout.write(
-                    f"\r<{percent:3d}%, chunk {current_chunk:2d} of {total_chunks:2d} @ {approx_speed/1024:.2f} kb/s"
-                )
-                sys.stdout.flush()
+                self._print_progress("<", file.tell(), filesize, start_time)
         print()
 
     def read_file(self, filename: str):
@@ -272,35 +305,41 @@ class FlipperStorage:
         buffer_size = self.chunk_size
         start_time = time.time()
         self.send_and_wait_eol(
-            'storage read_chunks "' + filename + '" ' + str(buffer_size) + "\r"
+            f'storage read_chunks "{filename}" {buffer_size} {self.window}\r'
         )
         answer = self.read.until(self.CLI_EOL)
         filedata = bytearray()
         if self.has_error(answer):
             last_error = self.get_error(answer)
             self.read.until(self.CLI_PROMPT)
-            raise FlipperStorageException(filename, last_error)
-            # return filedata
+            raise FlipperStorageException.from_error_code(filename, last_error)
         size = int(answer.split(b": ")[1])
         read_size = 0
 
+        # Firmware without windowed transfers ignores window and asks for every chunk
+        windowed = self.read.until(self.CLI_EOL).startswith(b"Window: ")
+
         while read_size < size:
-            self.read.until("Ready?" + self.CLI_EOL)
-            self.send("y")
             chunk_size = min(size - read_size, buffer_size)
-            filedata.extend(self.port.read(chunk_size))
+            if windowed:
+                filedata.extend(self.read.read(chunk_size))
+                # Acknowledge received chunk to let Flipper send the next one
+                self.send("y")
+            else:
+                self.read.until("Ready?" + self.CLI_EOL)
+                self.send("y")
+                filedata.extend(self.port.read(chunk_size))
             read_size = read_size + chunk_size
 
-            percent = math.ceil(read_size / size * 100)
-            total_chunks = math.ceil(size / buffer_size)
-            current_chunk = math.ceil(read_size / buffer_size)
-            approx_speed = read_size / (time.time() - start_time + 0.0001)
-            sys.stdout.write(
-                f"\r>{percent:3d}%, chunk {current_chunk:2d} of {total_chunks:2d} @ {approx_speed/1024:.2f} kb/s"
-            )
-            sys.stdout.flush()
+            self._print_progress(">", read_size, size, start_time)
         print()
-        self.read.until(self.CLI_PROMPT)
+        # Read errors are reported after the data, which is padded to the announced size
+        answer = self.read.until(self.CLI_PROMPT)
+        if self.has_error(answer):
+            error_line = answer[answer.find(b"Storage error:") :].split(b"\r\n")[0]
+            raise FlipperStorageException.from_error_code(
+                filename, self.get_error(error_line)
+            )
         return filedata
 
     def receive_file(self, filename_from: str, filename_to: str):
@@ -0,0 +1,115 @@
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Host stand-in for the parts of furi.h used by firmware sources built on host
+FURI_SHIM = """
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#define furi_assert(x) ((void)(x))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+// Firmware malloc returns zeroed memory
+#define malloc(size) calloc(1, size)
+"""
+
+
+class HostBuild:
+    """Builds firmware sources together with a test program using the host compiler
+
+    Firmware sources can only use the parts of furi.h provided by FURI_SHIM.
+    Paths are relative to the repository root.
+    """
+
+    def __init__(self, logger, cc):
+        self.logger = logger
+        self.cc = cc
+        self.root_dir = os.path.normpath(
+            os.path.join(os.path.dirname(__file__), "..", "..", "..")
+        )
+
+    def path(self, *parts):
+        return os.path.join(self.root_dir, *parts)
+
+    def check(self, submodules=()):
+        """Check that compiler and submodules in lib are available"""
+        if not shutil.which(self.cc):
+            self.logger.error(f"Host compiler '{self.cc}' not found")
+            return False
+        for submodule in submodules:
+            if not glob.glob(self.path("lib", submodule, "*.c")):
+                self.logger.error(
+                    f"{submodule} is missing, run 'git submodule update --init'"
+                )
+                return False
+        return True
+
+    def _generate_protobuf(self, work_dir):
+        nanopb_dir = self.path("lib", "nanopb")
+        proto_dir = self.path("assets", "protobuf")
+        subprocess.run(
+            [
+                sys.executable,
+                os.path.join(nanopb_dir, "generator", "nanopb_generator.py"),
+                "-q",
+                f"-I{proto_dir}",
+                f"-D{work_dir}",
+                *glob.glob(os.path.join(proto_dir, "*.proto")),
+            ],
+            check=True,
+        )
+        return [
+            *glob.glob(os.path.join(work_dir, "*.pb.c")),
+            *glob.glob(os.path.join(nanopb_dir, "pb_*.c")),
+        ]
+
+    def run(
+        self,
+        main_source,
+        sources=(),
+        include_dirs=(),
+        defines=(),
+        protobuf=False,
+        check=True,
+    ):
+        """Compile main_source with firmware sources, run it and return the result
+
+        protobuf adds nanopb and messages generated from assets/protobuf.
+        """
+        with tempfile.TemporaryDirectory() as work_dir:
+            with open(os.path.join(work_dir, "furi.h"), "w") as shim_file:
+                shim_file.write(FURI_SHIM)
+
+            source_paths = [self.path(source) for source in sources]
+            include_paths = [work_dir, self.root_dir]
+            include_paths += [self.path(include_dir) for include_dir in include_dirs]
+            if protobuf:
+                source_paths += self._generate_protobuf(work_dir)
+                include_paths.append(self.path("lib", "nanopb"))
+
+            main_path = os.path.join(work_dir, "main.c")
+            binary_path = os.path.join(work_dir, "main")
+            with open(main_path, "w") as main_file:
+                main_file.write(main_source)
+
+            subprocess.run(
+                [
+                    self.cc,
+                    "-O2",
+                    *(f"-D{define}" for define in defines),
+                    *(f"-I{include_path}" for include_path in include_paths),
+                    "-o",
+                    binary_path,
+                    main_path,
+                    *source_paths,
+                ],
+                check=True,
+            )
+            return subprocess.run(
+                [binary_path], capture_output=True, text=True, check=check
+            )
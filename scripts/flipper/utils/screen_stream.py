@@ -0,0 +1,120 @@
+import logging
+
+
+class HeatshrinkDecoder:
+    """Decoder of heatshrink streams produced by toolbox/compress"""
+
+    def __init__(self, window_sz2=8, lookahead_sz2=4):
+        self.window_sz2 = window_sz2
+        self.lookahead_sz2 = lookahead_sz2
+
+    def decompress(self, data):
+        output = bytearray()
+        bits = int.from_bytes(data, "big")
+        left = len(data) * 8
+
+        def read(count):
+            nonlocal left
+            if left < count:
+                raise EOFError()
+            left -= count
+            return (bits >> left) & ((1 << count) - 1)
+
+        try:
+            while True:
+                if read(1):
+                    output.append(read(8))
+                    continue
+                offset = read(self.window_sz2) + 1
+                count = read(self.lookahead_sz2) + 1
+                if offset > len(output):
+                    raise ValueError("Backref out of window")
+                for _ in range(count):
+                    output.append(output[-offset])
+        except EOFError:
+            # Last byte is padded with zero bits
+            pass
+
+        return bytes(output)
+
+
+class ScreenStreamDecoder:
+    """Reconstructs framebuffers from Gui ScreenFrame data
+
+    Frame data format is described in applications/services/rpc/rpc_gui_frame.h:
+    - framebuffer size: raw framebuffer
+    - shorter: frame type byte, then compress_encode output of payload
+      - key frame payload: framebuffer
+      - delta frame payload: bitmask of changed tiles, LSB first, then
+        framebuffer XOR previous frame for every changed tile
+    """
+
+    FRAME_TYPE_KEY = 0x01
+    FRAME_TYPE_DELTA = 0x02
+    TILE_SIZE = 16
+    COMPRESS_HEADER_SIZE = 4
+
+    def __init__(self, framebuffer_size=1024):
+        self.framebuffer_size = framebuffer_size
+        self.tiles = framebuffer_size // self.TILE_SIZE
+        self.heatshrink = HeatshrinkDecoder()
+        self.logger = logging.getLogger("ScreenStreamDecoder")
+        self.reset()
+
+    def reset(self):
+        self.framebuffer = None
+
+    def _decompress(self, data):
+        if len(data) < 1:
+            raise ValueError("Empty payload")
+        if data[0] == 0x00:
+            return bytes(data[1:])
+        if data[0] != 0x01 or len(data) < self.COMPRESS_HEADER_SIZE:
+            raise ValueError("Invalid compress header")
+        size = int.from_bytes(data[2:4], "little")
+        if size > len(data):
+            raise ValueError("Truncated payload")
+        return self.heatshrink.decompress(data[self.COMPRESS_HEADER_SIZE : size])
+
+    def _apply_delta(self, payload):
+        mask_size = (self.tiles + 7) // 8
+        if self.framebuffer is None:
+            raise ValueError("Delta frame before key frame")
+
+        framebuffer = bytearray(self.framebuffer)
+        cursor = mask_size
+        for tile in range(self.tiles):
+            if not payload[tile // 8] & (1 << (tile % 8)):
+                continue
+            start = tile * self.TILE_SIZE
+            xor = payload[cursor : cursor + self.TILE_SIZE]
+            if len(xor) != self.TILE_SIZE:
+                raise ValueError("Truncated delta frame")
+            for i in range(self.TILE_SIZE):
+                framebuffer[start + i] ^= xor[i]
+            cursor += self.TILE_SIZE
+
+        if cursor != len(payload):
+            raise ValueError("Trailing delta frame data")
+        return bytes(framebuffer)
+
+    def decode(self, data):
+        """Decode frame data and return current framebuffer"""
+        if len(data) == self.framebuffer_size:
+            self.framebuffer = bytes(data)
+            return self.framebuffer
+        if len(data) < 2:
+            raise ValueError("Frame is too short")
+
+        frame_type = data[0]
+        payload = self._decompress(data[1:])
+        if frame_type == self.FRAME_TYPE_KEY:
+            if len(payload) != self.framebuffer_size:
+                raise ValueError("Invalid key frame size")
+            self.framebuffer = payload
+        elif frame_type == self.FRAME_TYPE_DELTA:
+            self.framebuffer = self._apply_delta(payload)
+        else:
+            raise ValueError(f"Unknown frame type {frame_type}")
+
+        return self.framebuffer
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+
+import shutil
+import subprocess
+from collections import defaultdict
+from dataclasses import dataclass
+
+from flipper.app import App
+from flipper.storage import FlipperStorage
+from flipper.utils.cdc import resolve_port
+
+
+@dataclass
+class Allocation:
+    size: int
+    caller: int
+    thread: int
+    tick: int
+
+
+@dataclass
+class Owner:
+    name: str
+    current: int = 0
+    peak: int = 0
+    peak_tick: int = 0
+    allocations: int = 0
+    frees: int = 0
+
+
+@dataclass
+class Site:
+    caller: int
+    count: int = 0
+    bytes: int = 0
+
+
+class HeapTrace:
+    """Replays events printed by `heap_trace dump|stream` CLI command
+
+    Line formats:
+        T <thread> <appid> <name>
+        A <tick> <pointer> <size> <caller> <thread>
+        F <tick> <pointer> <caller> <thread>
+        D <dropped>
+    """
+
+    def __init__(self):
+        self.threads = {}
+        self.live = {}
+        self.owners = {}
+        self.sites = {}
+        self.current = 0
+        self.peak = 0
+        self.peak_tick = 0
+        self.last_tick = 0
+        self.dropped = 0
+        self.unknown_frees = 0
+        self.events = 0
+
+    def owner_name(self, thread: int) -> str:
+        if description := self.threads.get(thread):
+            appid, name = description
+            # Apps run in the thread named after them, services have own names
+            return appid if appid != "unknown" else name
+        return f"thread {thread:08x}"
+
+    def owner(self, thread: int) -> Owner:
+        name = self.owner_name(thread)
+        if name not in self.owners:
+            self.owners[name] = Owner(name)
+        return self.owners[name]
+
+    def feed_line(self, line: str):
+        parts = line.strip().split(" ", 3)
+        if not parts or len(parts[0]) != 1:
+            return
+
+        kind = parts[0]
+        try:
+            if kind == "T" and len(parts) >= 3:
+                name = parts[3] if len(parts) > 3 else ""
+                self.threads[int(parts[1], 16)] = (parts[2], name)
+            elif kind == "A":
+                tick, pointer, size, caller, thread = line.split()[1:6]
+                self.alloc(
+                    int(tick),
+                    int(pointer, 16),
+                    int(size),
+                    int(caller, 16),
+                    int(thread, 16),
+                )
+            elif kind == "F":
+                tick, pointer, _, thread = line.split()[1:5]
+                self.free(int(tick), int(pointer, 16), int(thread, 16))
+            elif kind == "D":
+                self.dropped = int(parts[1])
+        except (IndexError, ValueError):
+            # Not an event, CLI output can be mixed with other text
+            pass
+
+    def alloc(self, tick: int, pointer: int, size: int, caller: int, thread: int):
+        self.events += 1
+        self.last_tick = tick
+        if pointer in self.live:
+            # Free was dropped, account the old block as released
+            self.release(pointer)
+
+        self.live[pointer] = Allocation(size, caller, thread, tick)
+        self.current += size
+        if self.current > self.peak:
+            self.peak, self.peak_tick = self.current, tick
+
+        owner = self.owner(thread)
+        owner.allocations += 1
+        owner.current += size
+        if owner.current > owner.peak:
+            owner.peak, owner.peak_tick = owner.current, tick
+
+        site = self.sites.setdefault(caller, Site(caller))
+        site.count += 1
+        site.bytes += size
+
+    def free(self, tick: int, pointer: int, thread: int):
+        self.events += 1
+        self.last_tick = tick
+        if pointer not in self.live:
+            # Allocated before tracing started
+            self.unknown_frees += 1
+            return
+        self.owner(thread).frees += 1
+        self.release(pointer)
+
+    def release(self, pointer: int):
+        allocation = self.live.pop(pointer)
+        self.current -= allocation.size
+        self.owner(allocation.thread).current -= allocation.size
+
+    def leak_candidates(self, min_age: int):
+        """Live allocations grouped by owner and allocation site, largest first"""
+        groups = defaultdict(lambda: [0, 0])
+        for allocation in self.live.values():
+            if self.last_tick - allocation.tick < min_age:
+                continue
+            key = (self.owner_name(allocation.thread), allocation.caller)
+            groups[key][0] += 1
+            groups[key][1] += allocation.size
+        return sorted(groups.items(), key=lambda item: item[1][1], reverse=True)
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+
+        self.subparsers = self.parser.add_subparsers(help="sub-command help")
+
+        self.parser_capture = self.subparsers.add_parser(
+            "capture", help="Stream heap trace to file until CTRL+C"
+        )
+        self.parser_capture.add_argument(
+            "-e", "--events", type=int, default=512, help="Device ring buffer size"
+        )
+        self.parser_capture.add_argument("output", help="Output file")
+        self.parser_capture.set_defaults(func=self.capture)
+
+        self.parser_analyze = self.subparsers.add_parser(
+            "analyze", help="Analyze captured heap trace"
+        )
+        self.parser_analyze.add_argument("input", help="Captured trace file")
+        self.parser_analyze.add_argument(
+            "--elf", help="Firmware ELF file to resolve allocation sites"
+        )
+        self.parser_analyze.add_argument(
+            "-n", "--top", type=int, default=20, help="Entries per report section"
+        )
+        self.parser_analyze.add_argument(
+            "--min-age",
+            type=int,
+            default=1000,
+            help="Ignore live allocations younger than that many ticks",
+        )
+        self.parser_analyze.set_defaults(func=self.analyze)
+
+    def capture(self):
+        if not (port := resolve_port(self.logger, self.args.port)):
+            self.logger.error("Is Flipper connected via USB and not in DFU mode?")
+            return 1
+
+        with FlipperStorage(port) as flipper, open(self.args.output, "w") as output:
+            flipper.send_and_wait_prompt(f"heap_trace start {self.args.events}\r")
+            flipper.send("heap_trace stream\r")
+            self.logger.info("Capturing, press CTRL+C to stop")
+            lines = 0
+            try:
+                while True:
+                    line = flipper.read.until(flipper.CLI_EOL)
+                    output.write(line.decode("ascii", "replace") + "\n")
+                    lines += 1
+            except KeyboardInterrupt:
+                pass
+            flipper.send("\x03")
+            # Events printed before the interrupt was received are still valid
+            tail = flipper.read.until(flipper.CLI_PROMPT).decode("ascii", "replace")
+            for line in tail.splitlines():
+                output.write(line + "\n")
+            flipper.send_and_wait_prompt("heap_trace stop\r")
+            self.logger.info(f"Captured {lines} lines to {self.args.output}")
+
+        return 0
+
+    def _resolve(self, addresses):
+        names = {address: f"0x{address:08x}" for address in addresses}
+        if not self.args.elf or not addresses:
+            return names
+
+        addr2line = shutil.which("arm-none-eabi-addr2line") or shutil.which("addr2line")
+        if not addr2line:
+            self.logger.warning("addr2line not found, sites are not resolved")
+            return names
+
+        # Return address points after the call instruction
+        ordered = sorted(addresses)
+        result = subprocess.run(
+            [addr2line, "-f", "-s", "-e", self.args.elf]
+            + [f"0x{address - 1:08x}" for address in ordered],
+            capture_output=True,
+            text=True,
+        )
+        output = result.stdout.splitlines()
+        for index, address in enumerate(ordered):
+            if 2 * index + 1 < len(output):
+                function, location = output[2 * index], output[2 * index + 1]
+                names[address] = f"0x{address:08x} {function} {location}"
+        return names
+
+    def analyze(self):
+        trace = HeapTrace()
+        with open(self.args.input, errors="replace") as trace_file:
+            for line in trace_file:
+                trace.feed_line(line)
+
+        top = self.args.top
+        leaks = trace.leak_candidates(self.args.min_age)
+        sites = sorted(trace.sites.values(), key=lambda site: site.bytes, reverse=True)
+        callers = {caller for _, caller in (key for key, _ in leaks[:top])}
+        callers |= {site.caller for site in sites[:top]}
+        names = self._resolve(callers)
+
+        print(f"Events: {trace.events}, dropped on device: {trace.dropped}")
+        if trace.dropped:
+            print("Warning: events were dropped, increase buffer size with --events")
+        print(f"Frees of blocks allocated before capture: {trace.unknown_frees}")
+        print(f"Peak traced usage: {trace.peak} bytes at tick {trace.peak_tick}")
+        print(f"Live at the end: {trace.current} bytes in {len(trace.live)} blocks")
+
+        print("\nPer application:")
+        print(f"{'Owner':<24} {'Allocs':>8} {'Frees':>8} {'Peak':>10} {'Live':>10}")
+        owners = sorted(
+            trace.owners.values(), key=lambda owner: owner.peak, reverse=True
+        )
+        for owner in owners:
+            print(
+                f"{owner.name:<24} {owner.allocations:>8} {owner.frees:>8} "
+                f"{owner.peak:>10} {owner.current:>10}"
+            )
+
+        print("\nAllocation sites by total bytes:")
+        for site in sites[:top]:
+            name = names[site.caller]
+            print(f"{site.bytes:>10} bytes {site.count:>7} allocs  {name}")
+
+        print(f"\nLeak candidates, live for at least {self.args.min_age} ticks:")
+        if not leaks:
+            print("None")
+        for (owner, caller), (count, size) in leaks[:top]:
+            print(f"{size:>10} bytes {count:>7} blocks  {owner:<20} {names[caller]}")
+
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+
+import glob
+import os
+
+from flipper.app import App
+from flipper.assets.icon import file2image
+from flipper.utils.host_build import HostBuild
+
+BENCH_SOURCE = """
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <lib/toolbox/compress.h>
+
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    const uint8_t* data;
+} BenchIcon;
+
+%(icon_data)s
+
+static const BenchIcon icons[] = {%(icons)s};
+
+#define ICON_COUNT (sizeof(icons) / sizeof(icons[0]))
+#define ICONS_PER_FRAME %(per_frame)d
+#define FRAMES %(frames)d
+
+static uint8_t framebuffer[128 * 64 / 8];
+
+/* XBM blit, close to what u8g2 does for canvas_draw_icon */
+static void draw(uint8_t x, uint8_t y, const BenchIcon* icon, const uint8_t* bitmap) {
+    const size_t stride = (icon->width + 7) / 8;
+    for(size_t row = 0; row < icon->height && y + row < 64; row++) {
+        for(size_t col = 0; col < icon->width && x + col < 128; col++) {
+            if(bitmap[row * stride + col / 8] & (1 << (col %% 8))) {
+                framebuffer[((y + row) / 8) * 128 + x + col] |= 1 << ((y + row) %% 8);
+            }
+        }
+    }
+}
+
+/* Each frame draws a window of icons sliding by one per frame, like a scrolled menu */
+static double bench(CompressIcon* compress_icon, bool cached, uint32_t* checksum) {
+    struct timespec start, end;
+    uint32_t sum = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(size_t frame = 0; frame < FRAMES; frame++) {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        for(size_t i = 0; i < ICONS_PER_FRAME; i++) {
+            const BenchIcon* icon = &icons[(frame + i) %% ICON_COUNT];
+            uint8_t* bitmap = NULL;
+            if(cached) {
+                compress_icon_decode_cached(compress_icon, icon->data, &bitmap);
+            } else {
+                compress_icon_decode(compress_icon, icon->data, &bitmap);
+            }
+            draw((i * 32) %% 128, (i / 4) * 16, icon, bitmap);
+        }
+        for(size_t i = 0; i < sizeof(framebuffer); i++) {
+            sum = sum * 31 + framebuffer[i];
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *checksum = sum;
+    double us = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3;
+    return us / FRAMES;
+}
+
+int main(void) {
+    CompressIcon* compress_icon = compress_icon_alloc();
+    uint32_t plain_sum, cached_sum;
+    double plain_us = bench(compress_icon, false, &plain_sum);
+    compress_icon_set_cache_size(compress_icon, %(cache_size)d);
+    double cached_us = bench(compress_icon, true, &cached_sum);
+
+    CompressIconCacheStats stats;
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    printf(
+        "%%.2f %%.2f %%lu %%lu %%zu %%d\\n",
+        plain_us,
+        cached_us,
+        (unsigned long)stats.hits,
+        (unsigned long)stats.misses,
+        stats.used,
+        plain_sum == cached_sum);
+    compress_icon_free(compress_icon);
+    return 0;
+}
+"""
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument(
+            "-i",
+            "--icons",
+            nargs="+",
+            default=["MainMenu", "StatusBar", "Interface"],
+            help="Icon folders in assets/icons",
+        )
+        self.parser.add_argument(
+            "-c",
+            "--cache-size",
+            type=int,
+            default=4 * 1024,
+            help="Cache RAM budget, CANVAS_ICON_CACHE_SIZE in canvas_i.h",
+        )
+        self.parser.add_argument(
+            "-n", "--per-frame", type=int, default=12, help="Icons drawn per frame"
+        )
+        self.parser.add_argument(
+            "-f", "--frames", type=int, default=20000, help="Frames to draw"
+        )
+        self.parser.add_argument(
+            "--cc", help="Host C compiler", default=os.environ.get("CC", "cc")
+        )
+        self.parser.set_defaults(func=self.bench)
+
+    def bench(self):
+        host_build = HostBuild(self.logger, self.args.cc)
+        if not host_build.check(["heatshrink"]):
+            return 1
+
+        images = []
+        for folder in self.args.icons:
+            for png in sorted(
+                glob.glob(host_build.path("assets", "icons", folder, "*.png"))
+            ):
+                images.append(file2image(png))
+        if not images:
+            self.logger.error("No icons found")
+            return 1
+        compressed = sum(1 for image in images if image.data[0])
+        self.logger.info(f"{len(images)} icons, {compressed} compressed")
+
+        icon_data = "\n".join(
+            f"static const uint8_t icon_{index}[] = {image.data_as_carray()};"
+            for index, image in enumerate(images)
+        )
+        icons = ", ".join(
+            f"{{{image.width}, {image.height}, icon_{index}}}"
+            for index, image in enumerate(images)
+        )
+
+        result = host_build.run(
+            BENCH_SOURCE
+            % {
+                "icon_data": icon_data,
+                "icons": icons,
+                "per_frame": self.args.per_frame,
+                "frames": self.args.frames,
+                "cache_size": self.args.cache_size,
+            },
+            sources=[
+                "lib/toolbox/compress.c",
+                "lib/heatshrink/heatshrink_encoder.c",
+                "lib/heatshrink/heatshrink_decoder.c",
+            ],
+            include_dirs=["lib/heatshrink"],
+        )
+
+        plain_us, cached_us, hits, misses, used, match = result.stdout.split()
+        print(f"Redraw without cache: {plain_us} us/frame")
+        print(f"Redraw with {self.args.cache_size} bytes cache: {cached_us} us/frame")
+        print(f"Cache hits {hits}, misses {misses}, {used} bytes used")
+        if match != "1":
+            self.logger.error("Frames drawn with cache differ")
+            return 1
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
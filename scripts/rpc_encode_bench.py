@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+
+import os
+
+from flipper.app import App
+from flipper.utils.host_build import HostBuild
+
+BENCH_SOURCE = """
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <pb_encode.h>
+#include <flipper.pb.h>
+#include <rpc_encoder.h>
+
+#define ROUNDS %(rounds)d
+
+typedef struct {
+    RpcEncoder encoder;
+    uint8_t sink[%(sink_size)d];
+    size_t sink_used;
+} Session;
+
+/* Transport stand-in, copies data like the CLI and BLE serial transports do */
+static void send_bytes(void* context, uint8_t* bytes, size_t size) {
+    Session* session = context;
+    if(session->sink_used + size > sizeof(session->sink)) {
+        session->sink_used = 0;
+    }
+    memcpy(&session->sink[session->sink_used], bytes, size);
+    session->sink_used += size;
+}
+
+/* Encoding as it was before: sizing pass, allocation, second pass */
+static void send_two_pass(Session* session, PB_Main* message) {
+    pb_ostream_t ostream = PB_OSTREAM_SIZING;
+    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+
+    uint8_t* buffer = malloc(ostream.bytes_written);
+    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    send_bytes(session, buffer, ostream.bytes_written);
+    free(buffer);
+}
+
+/* Encoder used by rpc_send */
+static void send_single_pass(Session* session, PB_Main* message) {
+    rpc_encoder_send(&session->encoder, message);
+}
+
+static void fill_storage_read(PB_Main* message, size_t size) {
+    memset(message, 0, sizeof(PB_Main));
+    message->command_id = 1234;
+    message->has_next = true;
+    message->which_content = PB_Main_storage_read_response_tag;
+    message->content.storage_read_response.has_file = true;
+    message->content.storage_read_response.file.data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(size));
+    message->content.storage_read_response.file.data->size = size;
+    for(size_t i = 0; i < size; i++) {
+        message->content.storage_read_response.file.data->bytes[i] = i * 7;
+    }
+}
+
+static void fill_gui_frame(PB_Main* message, size_t size) {
+    memset(message, 0, sizeof(PB_Main));
+    message->which_content = PB_Main_gui_screen_frame_tag;
+    message->content.gui_screen_frame.data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(size));
+    message->content.gui_screen_frame.data->size = size;
+    for(size_t i = 0; i < size; i++) {
+        message->content.gui_screen_frame.data->bytes[i] = i * 13;
+    }
+}
+
+static double bench(void (*send)(Session*, PB_Main*), Session* session, PB_Main* message) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(int round = 0; round < ROUNDS; round++) {
+        send(session, message);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    return ROUNDS / seconds;
+}
+
+static int run(const char* name, PB_Main* message) {
+    static Session reference, session;
+    session.encoder = (RpcEncoder){
+        .buffer = malloc(%(tx_buffer_size)d),
+        .buffer_size = %(tx_buffer_size)d,
+        .send_bytes_callback = send_bytes,
+        .context = &session,
+    };
+
+    reference.sink_used = session.sink_used = 0;
+    send_two_pass(&reference, message);
+    send_single_pass(&session, message);
+    int match = reference.sink_used == session.sink_used &&
+                memcmp(reference.sink, session.sink, session.sink_used) == 0;
+
+    double two_pass = bench(send_two_pass, &reference, message);
+    double single_pass = bench(send_single_pass, &session, message);
+    printf("%%s %%zu %%.0f %%.0f %%d\\n", name, session.sink_used, two_pass, single_pass, match);
+
+    free(session.encoder.buffer);
+    pb_release(&PB_Main_msg, message);
+    return match;
+}
+
+int main(void) {
+    PB_Main message;
+    int match = 1;
+    fill_storage_read(&message, 512);
+    match &= run("storage_read_512", &message);
+    fill_storage_read(&message, %(large_chunk)d);
+    match &= run("storage_read_%(large_chunk)d", &message);
+    fill_gui_frame(&message, 1024);
+    match &= run("gui_frame", &message);
+    return !match;
+}
+"""
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument(
+            "-r", "--rounds", type=int, default=200000, help="Messages per test"
+        )
+        self.parser.add_argument(
+            "-b",
+            "--tx-buffer-size",
+            type=int,
+            default=1280,
+            help="Session transmit buffer size, RPC_TX_BUFFER_SIZE in rpc.c",
+        )
+        self.parser.add_argument(
+            "-l",
+            "--large-chunk",
+            type=int,
+            default=4096,
+            help="Storage read size that doesn't fit into the transmit buffer",
+        )
+        self.parser.add_argument(
+            "--cc", help="Host C compiler", default=os.environ.get("CC", "cc")
+        )
+        self.parser.set_defaults(func=self.bench)
+
+    def bench(self):
+        host_build = HostBuild(self.logger, self.args.cc)
+        if not host_build.check(["nanopb"]):
+            return 1
+
+        result = host_build.run(
+            BENCH_SOURCE
+            % {
+                "tx_buffer_size": self.args.tx_buffer_size,
+                "rounds": self.args.rounds,
+                "large_chunk": self.args.large_chunk,
+                "sink_size": 4 * (self.args.large_chunk + 64),
+            },
+            sources=["applications/services/rpc/rpc_encoder.c"],
+            include_dirs=["applications/services/rpc"],
+            defines=["PB_ENABLE_MALLOC"],
+            protobuf=True,
+            check=False,
+        )
+
+        for line in result.stdout.splitlines():
+            name, size, two_pass, single_pass, match = line.split()
+            print(
+                f"{name}: {size} bytes, "
+                f"two pass {two_pass} msg/s, single pass {single_pass} msg/s, "
+                f"speedup {float(single_pass) / float(two_pass):.2f}x"
+            )
+            if match != "1":
+                self.logger.error(f"{name}: encoded data differs")
+
+        return result.returncode
+
+
+if __name__ == "__main__":
+    Main()()
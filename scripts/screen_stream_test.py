@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+
+import os
+
+from flipper.app import App
+from flipper.utils.host_build import HostBuild
+from flipper.utils.screen_stream import ScreenStreamDecoder
+
+TEST_SOURCE = """
+#include <stdio.h>
+#include <string.h>
+
+#include <rpc_gui_frame.h>
+
+#define FRAMEBUFFER_SIZE (1024)
+#define FRAMES %(frames)d
+#define KEYFRAME_INTERVAL %(keyframe_interval)d
+
+static uint8_t framebuffers[2][FRAMEBUFFER_SIZE];
+static uint8_t delta_buffer[RPC_GUI_FRAME_DELTA_BUFFER_SIZE(FRAMEBUFFER_SIZE)];
+static uint8_t frame[RPC_GUI_FRAME_CAPACITY(FRAMEBUFFER_SIZE)];
+static uint32_t seed = %(seed)d;
+
+static uint32_t random_next(void) {
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+/* Screen like changes: a few boxes redrawn, sometimes the whole screen is noise */
+static void draw(uint8_t* framebuffer, size_t index) {
+    if(index %% 13 == 12) {
+        for(size_t i = 0; i < FRAMEBUFFER_SIZE; i++) {
+            framebuffer[i] = random_next();
+        }
+        return;
+    }
+
+    const size_t boxes = random_next() %% 4;
+    for(size_t box = 0; box < boxes; box++) {
+        const size_t start = random_next() %% FRAMEBUFFER_SIZE;
+        const size_t length = 1 + random_next() %% 64;
+        const uint8_t pattern = random_next();
+        for(size_t i = start; i < start + length && i < FRAMEBUFFER_SIZE; i++) {
+            framebuffer[i] = pattern;
+        }
+    }
+}
+
+static void print_hex(const uint8_t* data, size_t size) {
+    for(size_t i = 0; i < size; i++) {
+        printf("%%02x", data[i]);
+    }
+}
+
+/* Prints sent data and framebuffer the host must reconstruct, one frame per line */
+int main(void) {
+    Compress* compress = compress_alloc(16);
+
+    for(size_t index = 0; index < FRAMES; index++) {
+        uint8_t* current = framebuffers[index %% 2];
+        const uint8_t* previous = framebuffers[(index + 1) %% 2];
+        memcpy(current, previous, FRAMEBUFFER_SIZE);
+        draw(current, index);
+
+        const int keyframe = index %% KEYFRAME_INTERVAL == 0;
+        size_t size = rpc_gui_frame_encode(
+            compress, current, keyframe ? NULL : previous, FRAMEBUFFER_SIZE, delta_buffer, frame);
+        if(size) {
+            print_hex(frame, size);
+        } else {
+            print_hex(current, FRAMEBUFFER_SIZE);
+        }
+        printf(" ");
+        print_hex(current, FRAMEBUFFER_SIZE);
+        printf("\\n");
+    }
+
+    compress_free(compress);
+    return 0;
+}
+"""
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument(
+            "-f", "--frames", type=int, default=200, help="Frames to encode"
+        )
+        self.parser.add_argument(
+            "-k",
+            "--keyframe-interval",
+            type=int,
+            default=16,
+            help="Encode every Nth frame as key frame",
+        )
+        self.parser.add_argument(
+            "-s", "--seed", type=int, default=1, help="Screen content generator seed"
+        )
+        self.parser.add_argument(
+            "--cc", help="Host C compiler", default=os.environ.get("CC", "cc")
+        )
+        self.parser.set_defaults(func=self.test)
+
+    def test(self):
+        host_build = HostBuild(self.logger, self.args.cc)
+        if not host_build.check(["heatshrink"]):
+            return 1
+
+        result = host_build.run(
+            TEST_SOURCE
+            % {
+                "frames": self.args.frames,
+                "keyframe_interval": self.args.keyframe_interval,
+                "seed": self.args.seed,
+            },
+            sources=[
+                "applications/services/rpc/rpc_gui_frame.c",
+                "lib/toolbox/compress.c",
+                "lib/heatshrink/heatshrink_encoder.c",
+                "lib/heatshrink/heatshrink_decoder.c",
+            ],
+            include_dirs=["applications/services/rpc", "lib", "lib/heatshrink"],
+        )
+
+        decoder = ScreenStreamDecoder()
+        frame_types = {"key": 0, "delta": 0, "raw": 0}
+        sent_bytes = 0
+        for index, line in enumerate(result.stdout.splitlines()):
+            data, expected = map(bytes.fromhex, line.split())
+            sent_bytes += len(data)
+            if len(data) == decoder.framebuffer_size:
+                frame_types["raw"] += 1
+            elif data[0] == ScreenStreamDecoder.FRAME_TYPE_KEY:
+                frame_types["key"] += 1
+            else:
+                frame_types["delta"] += 1
+
+            try:
+                framebuffer = decoder.decode(data)
+            except ValueError as error:
+                self.logger.error(f"Frame {index}: {error}")
+                return 1
+            if framebuffer != expected:
+                self.logger.error(f"Frame {index}: decoded framebuffer differs")
+                return 1
+
+        frames = sum(frame_types.values())
+        if frames != self.args.frames:
+            self.logger.error(f"Got {frames} of {self.args.frames} frames")
+            return 1
+
+        print(
+            f"{frames} frames decoded: {frame_types['key']} key, "
+            f"{frame_types['delta']} delta, {frame_types['raw']} raw"
+        )
+        print(
+            f"Sent {sent_bytes} bytes, "
+            f"{sent_bytes / (frames * decoder.framebuffer_size):.1%} of raw frames"
+        )
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
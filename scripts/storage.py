@@ -4,6 +4,7 @@ import binascii
 import filecmp
 import os
 import tempfile
+import time
 
 from flipper.app import App
 from flipper.storage import FlipperStorage, FlipperStorageOperations
@@ -83,6 +84,25 @@ class Main(App):
         )
         self.parser_stress.set_defaults(func=self.stress)
 
+        self.parser_speed = self.subparsers.add_parser(
+            "speed", help="Measure transfer speed"
+        )
+        self.parser_speed.add_argument(
+            "-b", "--chunk-size", type=int, default=8192, help="Chunk size in bytes"
+        )
+        self.parser_speed.add_argument(
+            "-w",
+            "--window",
+            type=int,
+            default=4,
+            help="Chunks in flight for windowed reads",
+        )
+        self.parser_speed.add_argument("flipper_path", help="Flipper path")
+        self.parser_speed.add_argument(
+            "file_size", type=int, help="Test file size in bytes"
+        )
+        self.parser_speed.set_defaults(func=self.speed)
+
     def _get_port(self):
         if not (port := resolve_port(self.logger, self.args.port)):
             raise Exception("Failed to resolve port")
@@ -180,6 +200,41 @@ class Main(App):
                     os.unlink(receive_file_name)
                     self.args.count -= 1
 
+    @WrapStorageOp
+    def speed(self):
+        data = os.urandom(self.args.file_size)
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            send_file_name = os.path.join(tmpdirname, "send")
+            with open(send_file_name, "wb") as fout:
+                fout.write(data)
+
+            with FlipperStorage(
+                self._get_port(), chunk_size=self.args.chunk_size
+            ) as storage:
+                if storage.exist_file(self.args.flipper_path):
+                    self.logger.error("File exists, remove it first")
+                    return
+
+                start_time = time.monotonic()
+                storage.send_file(send_file_name, self.args.flipper_path)
+                results = [("write", time.monotonic() - start_time, True)]
+
+                for name, window in (
+                    ("read, lockstep", 0),
+                    (f"read, window {self.args.window}", self.args.window),
+                ):
+                    storage.window = window
+                    start_time = time.monotonic()
+                    received = storage.read_file(self.args.flipper_path)
+                    elapsed = time.monotonic() - start_time
+                    results.append((name, elapsed, received == data))
+
+                storage.remove(self.args.flipper_path)
+
+        for name, elapsed, match in results:
+            speed = self.args.file_size / elapsed / 1024
+            print(f"{name}: {speed:.2f} kb/s{'' if match else ', data mismatch'}")
+
 
 if __name__ == "__main__":
     Main()()
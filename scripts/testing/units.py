@@ -36,20 +36,27 @@ def main():
         time_re = r"Consumed: \d{0,}"
         leak_re = r"Leaked: \d{0,}"
         status_re = r"Status: \w{3,}"
+        bench_re = r"\[bench\] (.+): (\d+) (\w+) in (\d+) us, (\d+) \w+/s"
 
         tests_pattern = re.compile(tests_re)
         time_pattern = re.compile(time_re)
         leak_pattern = re.compile(leak_re)
         status_pattern = re.compile(status_re)
+        bench_pattern = re.compile(bench_re)
 
         tests, time, leak, status = None, None, None, None
         total = 0
+        benchmarks = []
 
         for line in lines:
             logging.info(line)
             if "()" in line:
                 total += 1
 
+            bench = re.match(bench_pattern, line)
+            if bench:
+                benchmarks.append(bench)
+
             if not tests:
                 tests = re.match(tests_pattern, line)
             if not time:
@@ -75,6 +82,12 @@ def main():
             logging.error(f"Time: {time/1000} seconds")
             sys.exit(1)
 
+        for bench in benchmarks:
+            name, items, unit, elapsed_us, rate = bench.groups()
+            logging.info(
+                f"Benchmark {name}: {rate} {unit}/s ({items} in {elapsed_us} us)"
+            )
+
         logging.info(f"Leaked (not failing on this stat): {leak}")
         logging.info(
             f"Tests ran successfully! Time elapsed {time/1000} seconds. Passed {total} tests."